@@ -284,6 +284,9 @@ class JobWriter():
             file.write('  // Getting pointer to the analyzer devoted to merging plots\n')
             file.write('  std::map<std::string, std::string> parametersA2;\n')
             file.write('  parametersA2["njets"]="'+str(self.main.merging.njets)+'";\n')
+            file.write('  parametersA2["engine"]="'+self.main.merging.engine+'";\n')
+            if self.main.merging.engine=="native":
+                file.write('  parametersA2["kt_mode"]="'+self.main.merging.kt_mode+'";\n')
             file.write('  AnalyzerBase* analyzer2 = \n')
             file.write('      manager.InitializeAnalyzer("MergingPlots","MergingPlots.saf",parametersA2);\n')
             file.write('  if (analyzer2==0) return 1;\n\n')
@@ -294,6 +297,10 @@ class JobWriter():
                 file.write('      manager.InitializeWriter("lhe","'+self.output+'");\n')
             elif self.output.lower().endswith('lhco') or self.output.lower().endswith('lhco.gz'):
                 file.write('      manager.InitializeWriter("lhco","'+self.output+'");\n')
+            elif self.output.lower().endswith('ma5bin') or self.output.lower().endswith('ma5bin.gz'):
+                file.write('      manager.InitializeWriter("ma5bin","'+self.output+'");\n')
+            elif self.output.lower().endswith('ma5store'):
+                file.write('      manager.InitializeWriter("ma5store","'+self.output+'");\n')
             file.write('  if (writer1==0) return 1;\n\n')
 
         # Fast-Simulation detector
@@ -345,8 +352,23 @@ class JobWriter():
         file.write('  //                      EXECUTION\n')
         file.write('  // ---------------------------------------------------\n')
         file.write('  INFO << "    * Running over files ..." << endmsg;\n\n')
+        file.write('  // Merging the results of shards (no event is read)\n')
+        file.write('  if (manager.IsMergingShards())\n')
+        file.write('  {\n')
+        file.write('    if (!manager.MergeShards(mySamples)) return 1;\n')
+        file.write('  }\n\n')
+        file.write('  // Loop over files (multi-threaded mode)\n')
+        file.write('  else if (manager.IsThreaded())\n')
+        file.write('  {\n')
+        file.write('    if (!manager.ThreadedLoop(mySamples)) return 1;\n')
+        file.write('  }\n\n')
+        file.write('  // Loop over files (multi-process mode)\n')
+        file.write('  else if (manager.IsMultiProcess())\n')
+        file.write('  {\n')
+        file.write('    if (!manager.MultiProcessLoop(mySamples,myEvent)) return 1;\n')
+        file.write('  }\n\n')
         file.write('  // Loop over files\n')
-        file.write('  while(1)\n')
+        file.write('  else while(1)\n')
         file.write('  {\n')
         file.write('    // Opening input file\n')
         file.write('    mySamples.push_back(SampleFormat());\n')
@@ -490,6 +512,8 @@ class JobWriter():
         if self.libFastjet:
             file.write(' -DFASTJET_USE')
             file.write(' $(CXXFASTJET)')
+        if self.main.singlePrecision:
+            file.write(' -DSINGLE_PRECISION_USE')
         file.write('\n')
         file.write('\n')
 
@@ -606,6 +630,8 @@ class JobWriter():
             options.extend(['-DROOT_USE','-DDELFES_USE'])
         if self.libFastjet:
             options.extend(['-DROOT_USE','-DFASTJET_USE'])#,'$(shell fastjet-config --cxxflags --plugins)'])
+        if self.main.singlePrecision:
+            options.extend(['-DSINGLE_PRECISION_USE'])
         file.write('CXXFLAGS = '+' '.join(options))
         file.write('\n')
 
@@ -141,6 +141,8 @@ class LibraryWriter():
                 file.write(' -I'+header)
         if package=='fastjet':
             file.write(' $(CXXFASTJET)')
+        if self.main.singlePrecision:
+            file.write(' -DSINGLE_PRECISION_USE')
         file.write('\n')
 
         # Options for C++ compilation
@@ -315,6 +317,10 @@ class LibraryWriter():
         if self.libFastJet:
             file.write(' -DFASTJET_USE')
  #           file.write(' $(CXXFASTJET)')
+        if self.fortran:
+            file.write(' -DFORTRAN_USE')
+        if self.main.singlePrecision:
+            file.write(' -DSINGLE_PRECISION_USE')
         file.write('\n')
         if self.fortran:
             file.write('FC = gfortran\n')
@@ -323,7 +329,7 @@ class LibraryWriter():
 
         # Files for analyzers
         file.write('# Files\n')
-        file.write('SRCS = $(wildcard */*.cpp)\n')
+        file.write('SRCS = $(filter-out Test/% Benchmark/%,$(wildcard */*.cpp))\n')
 #        file.write('SRCS += $(wildcard */*/*.cpp)\n')
         file.write('HDRS = $(wildcard */*.h)\n')
         file.write('OBJS = $(SRCS:.cpp=.o)\n')
@@ -631,10 +637,86 @@ class LibraryWriter():
         return True
 
 
+    def WritePdgPropertyData(self):
+
+        # Reading the particle table (the first three lines are comments)
+        tblname  = self.path + "/SampleAnalyzer/particle.tbl"
+        filename = self.path + "/SampleAnalyzer/DataFormat/PdgPropertyData.cpp"
+        try:
+            input = open(tblname,"r")
+        except:
+            logging.error('impossible to read the file '+tblname)
+            return False
+        particles = {}
+        for line in input.readlines()[3:]:
+            words = line.split()
+            if len(words)==0:
+                continue
+            try:
+                # ID name charge(e+/3) mass(GeV) width(GeV) ctau(mm)
+                if len(words)!=6 or '"' in words[1] or '\\' in words[1]:
+                    raise ValueError
+                int(words[2])
+                for word in words[3:]:
+                    float(word)
+                particles[int(words[0])] = words[1:]
+            except:
+                logging.error('the line "'+line.strip()+'" of the file '+\
+                              tblname+' is not valid')
+                input.close()
+                return False
+        input.close()
+
+        # Open the file
+        try:
+            file = open(filename,"w")
+        except:
+            logging.error('impossible to write the file '+filename)
+            return False
+
+        # Writing the table sorted by PDG id
+        file.write('// This file is generated from particle.tbl by MadAnalysis 5\n')
+        file.write('// when the SampleAnalyzer library is built: do not edit it.\n')
+        file.write('\n')
+        file.write('// SampleAnalyzer headers\n')
+        file.write('#include "SampleAnalyzer/DataFormat/PdgPropertyData.h"\n')
+        file.write('\n')
+        file.write('using namespace MA5;\n')
+        file.write('\n')
+        file.write('const UInt_t MA5::PdgPropertyDataSize = '+str(len(particles))+';\n')
+        file.write('\n')
+        file.write('const PdgRecord MA5::PdgPropertyData['+str(len(particles))+'] =\n')
+        file.write('{\n')
+        ids = sorted(particles.keys())
+        for i in range(0,len(ids)):
+            words = particles[ids[i]]
+            file.write('  { '+str(ids[i]).rjust(11)+', '+\
+                       ('"'+words[0]+'",').ljust(22)+' '+words[1].rjust(2)+', '+\
+                       words[2]+', '+words[3]+', '+words[4]+' }')
+            if i!=len(ids)-1:
+                file.write(',')
+            file.write('\n')
+        file.write('};\n')
+        file.close()
+        return True
+
+
     def WriteMakefileForTest(self):
+        return self.WriteMakefileForProgram('Test','test','Test.cpp',\
+                                            'SampleAnalyzerTest')
+
+
+    def WriteMakefileForBenchmark(self):
+        return self.WriteMakefileForProgram('Benchmark','benchmark','*.cpp',\
+                                            'SampleAnalyzerBenchmark',\
+                                            fastjetHeaders=True)
+
+
+    def WriteMakefileForProgram(self,folder,package,sources,program,\
+                                fastjetHeaders=False):
 
         # Open the file
-        filename = self.path + "/SampleAnalyzer/Test/Makefile_test"
+        filename = self.path + "/SampleAnalyzer/"+folder+"/Makefile_"+package
         try:
             file = open(filename,"w")
         except:
@@ -643,7 +725,7 @@ class LibraryWriter():
 
         # Writing header
         file.write(StringTools.Fill('#',80)+'\n')
-        file.write('#'+StringTools.Center('MAKEFILE FOR SAMPLEANALYZER TEST',78)+'#\n')
+        file.write('#'+StringTools.Center('MAKEFILE FOR SAMPLEANALYZER '+package.upper(),78)+'#\n')
         file.write(StringTools.Fill('#',80)+'\n')
         file.write('\n')
 
@@ -664,6 +746,12 @@ class LibraryWriter():
             options.extend(['-DROOT_USE','-DDELFES_USE'])
         if self.libFastJet:
             options.extend(['-DROOT_USE','-DFASTJET_USE'])
+            if fastjetHeaders:
+                options.extend(['$(shell fastjet-config --cxxflags)'])
+        if self.fortran:
+            options.extend(['-DFORTRAN_USE'])
+        if self.main.singlePrecision:
+            options.extend(['-DSINGLE_PRECISION_USE'])
         file.write('CXXFLAGS = '+' '.join(options))
         file.write('\n')
 
@@ -694,13 +782,13 @@ class LibraryWriter():
 
         # Files to process
         file.write('# Files to process\n')
-        file.write('SRCS  = $(wildcard Test.cpp)\n')
+        file.write('SRCS  = $(wildcard '+sources+')\n')
         file.write('\n')
 
         # Files to generate
         file.write('# Files to generate\n')
         file.write('OBJS    = $(SRCS:.cpp=.o)\n')
-        file.write('PROGRAM = SampleAnalyzerTest\n')
+        file.write('PROGRAM = '+program+'\n')
         file.write('\n')
 
         # Lib to check
@@ -821,8 +909,9 @@ class LibraryWriter():
         file.write('\n')
         file.write('# Do Mr Proper target \n')
         file.write('do_mrproper: do_clean\n')
-        file.write('\t@rm -f $(PROGRAM) compilation_test.log' + \
-                   ' linking_test.log cleanup_test.log mrproper_test.log *~ */*~ */*~ \n')
+        file.write('\t@rm -f $(PROGRAM) compilation_'+package+'.log' + \
+                   ' linking_'+package+'.log cleanup_'+package+'.log' + \
+                   ' mrproper_'+package+'.log *~ */*~ */*~ \n')
         file.write('\n')
 
         # Phony target
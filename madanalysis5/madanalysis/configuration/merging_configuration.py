@@ -35,18 +35,25 @@ import logging
 
 class MergingConfiguration:
 
-    userVariables = { "check" : ["true","false"],\
-                      "njets" : ["4"] }
+    userVariables = { "check"   : ["true","false"],\
+                      "njets"   : ["4"],\
+                      "engine"  : ["fastjet","native"],\
+                      "kt_mode" : ["fastjet","4313"] }
 
     def __init__(self):
-        self.enable = False
-        self.njets  = 4
+        self.enable  = False
+        self.njets   = 4
+        self.engine  = "fastjet"
+        self.kt_mode = "fastjet"
 
         
     def Display(self):
         self.user_DisplayParameter("check")
         if self.enable:
             self.user_DisplayParameter("njets")
+            self.user_DisplayParameter("engine")
+            if self.engine=="native":
+                self.user_DisplayParameter("kt_mode")
 
         
     def user_DisplayParameter(self,parameter):
@@ -58,6 +65,10 @@ class MergingConfiguration:
             logging.info(" enabling merging plots : "+value)
         elif parameter=="njets":
             logging.info("  + njets = "+str(self.njets))
+        elif parameter=="engine":
+            logging.info("  + engine = "+self.engine)
+        elif parameter=="kt_mode":
+            logging.info("  + kt_mode = "+self.kt_mode)
         else:
             logging.error("'merging' has no parameter called '"+parameter+"'")
             return
@@ -96,6 +107,36 @@ class MergingConfiguration:
                 return
             self.njets=njets
 
+        # engine
+        elif parameter=="engine":
+            if value in ["fastjet","native"]:
+                self.engine=value
+            else:
+                logging.error("only possible values are 'fastjet' and 'native'")
+                return
+
+        # kt_mode (native engine): kt_algorithm of FastJet or IMODE of KTCLUS
+        elif parameter=="kt_mode":
+            if value=="fastjet":
+                self.kt_mode=value
+                return
+            try:
+                imode = int(value)
+            except:
+                logging.error("the value for 'kt_mode' must be 'fastjet' or an IMODE of KTCLUS.")
+                return
+            digits = str(imode)
+            if not (1<=imode<=6 or \
+                    (len(digits)==4 and digits[0] in "1234" and \
+                     digits[1] in "123" and digits[2]=="1" and \
+                     digits[3] in "123")):
+                logging.error("the IMODE "+value+" is not supported: 1 to 6 or "+\
+                              "<TYPE 1-4><ANGLE 1-3><MONO 1><RECOM 1-3>.")
+                return
+            if self.engine!="native":
+                logging.warning("'kt_mode' is only used by the native engine.")
+            self.kt_mode=str(imode)
+
         # other
         else:
             logging.error("no parameter called '"+parameter+"' is found.")
@@ -115,6 +115,8 @@ class ConfigChecker:
                 self.configLinux.useroptions.latex_veto=words[1]
             elif words[0]=='dvipdf_veto':
                 self.configLinux.useroptions.dvipdf_veto=words[1]
+            elif words[0]=='single_precision':
+                self.configLinux.useroptions.single_precision=words[1]
             else:
                 logging.warning(filename+': the options called "'+words[0]+'" is not found')
 
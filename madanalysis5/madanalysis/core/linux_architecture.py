@@ -43,6 +43,7 @@ class UserOptions:
         self.pdflatex_veto    = '0'
         self.latex_veto       = '0'
         self.dvipdf_veto      = '0'
+        self.single_precision = '0'
         
     def Dump(self):
         logging.info(" ROOT header path     = " + str(self.root_includes))
@@ -61,6 +62,7 @@ class UserOptions:
         logging.info(" PDFLATEX veto        = " + str(self.pdflatex_veto))
         logging.info(" LATEX veto           = " + str(self.latex_veto))
         logging.info(" DVIPDF veto          = " + str(self.dvipdf_veto))
+        logging.info(" Single precision     = " + str(self.single_precision))
 
     def Export(self,file):
         file.write(self.root_includes+"\n")
@@ -79,6 +81,7 @@ class UserOptions:
         file.write(self.pdflatex_veto+"\n")
         file.write(self.latex_veto+"\n")
         file.write(self.dvipdf_veto+"\n")
+        file.write(self.single_precision+"\n")
 
     def Import(self,file):
         self.root_includes    = file.readline().replace('\n','')
@@ -97,6 +100,7 @@ class UserOptions:
         self.pdflatex_veto    = file.readline().replace('\n','')
         self.latex_veto       = file.readline().replace('\n','')
         self.dvipdf_veto      = file.readline().replace('\n','')
+        self.single_precision = file.readline().replace('\n','')
 
     def Compare(self,other):
         if self.root_includes != other.root_includes:
@@ -125,6 +129,8 @@ class UserOptions:
             return False
         if self.fastjet_bin_path != other.fastjet_bin_path:
             return False
+        if self.single_precision != other.single_precision:
+            return False
         return True
 
 class LinuxArchitecture:
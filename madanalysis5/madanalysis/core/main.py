@@ -84,6 +84,7 @@ class Main():
         self.latex          = False
         self.dvipdf         = False
         self.libFastJet     = False
+        self.singlePrecision = False
         self.fortran        = False
         self.observables    = ObservableManager(self.mode)
         self.mcatnloutils   = False
@@ -138,6 +139,9 @@ class Main():
                 samples.append('.hep')
                 samples.append('.hepmc')
 
+        # Native binary cache (valid at any level)
+        samples.append('.ma5bin')
+
         # Adding gzip file
         if self.libZIP:
             zipsamples=[]
@@ -145,6 +149,9 @@ class Main():
                 zipsamples.append(item+'.gz')
             samples.extend(zipsamples)
 
+        # Event store (mapped in memory, never compressed)
+        samples.append('.ma5store')
+
         return samples     
 
 
@@ -311,6 +318,16 @@ class Main():
                 self.output = value
                 return
 
+            # MA5 binary event cache
+            elif valuemin.endswith(".ma5bin") or valuemin.endswith(".ma5bin.gz"):
+                self.output = value
+                return
+
+            # MA5 event store (random access)
+            elif valuemin.endswith(".ma5store"):
+                self.output = value
+                return
+
             # LHCO
             elif valuemin.endswith(".lhco") or valuemin.endswith(".lhco.gz"):
                 if self.mode == MA5RunningType.RECO:
@@ -330,7 +347,7 @@ class Main():
 
             else:
                 logging.error("Output format is not available. Extension allowed: " +\
-                              ".lhe .lhe.gz .lhco .lhco.gz")
+                              ".lhe .lhe.gz .lhco .lhco.gz .ma5bin .ma5bin.gz .ma5store")
                 return False
 
         # other    
@@ -477,6 +494,11 @@ class Main():
         if self.latex:
             self.dvipdf = checker.checkdvipdf()
 
+        # Storage precision of the momenta in SampleAnalyzer
+        self.singlePrecision = (self.configLinux.useroptions.single_precision=='1')
+        if self.singlePrecision:
+            logging.info("Momenta stored in single precision (option single_precision).")
+
         # Set PATH variable
         self.configLinux.toPATH=[]
         self.configLinux.toLDPATH=[]
@@ -591,6 +613,10 @@ class Main():
             # Writing a Makefile
             logging.info("     - Writing a Makefile ...")
             if libraries[ind][0]=='SampleAnalyzer':
+                logging.info("     - Writing the PDG property table ...")
+                if not compiler.WritePdgPropertyData():
+                    logging.error("library building aborted.")
+                    sys.exit()
                 if not compiler.WriteMakefile():
                     logging.error("library building aborted.")
                     sys.exit()
@@ -689,6 +715,17 @@ class Main():
         sys.stdout.write("     => Status: ")
         self.PrintOK()
 
+        # Benchmark program: only its Makefile is written, the program
+        # is built and run on demand (make --file=Makefile_benchmark)
+        logging.info("   **********************************************************")
+        logging.info("   Benchmark program ")
+        logging.info("     - Writing a Makefile ...")
+        if not compiler.WriteMakefileForBenchmark():
+            logging.warning("the Makefile of the benchmark program is not written.")
+        else:
+            logging.info("     => to build it: make --file=Makefile_benchmark in the folder")
+            logging.info("        "+self.ma5dir+'/tools/SampleAnalyzer/Benchmark')
+
 
         logging.info("")
 
@@ -388,7 +388,9 @@ class CmdImport(CmdBase.CmdBase):
         logging.info("     - LHE (lhe or lhe.gz),")
         logging.info("     - HEPMC (hepmc or hepmc.gz),")
         logging.info("     - STDHEP (hep or hep.gz),") 
-        logging.info("     - LHCO (lhco or lhco.gz).") 
+        logging.info("     - LHCO (lhco or lhco.gz),") 
+        logging.info("     - MA5 binary event cache (ma5bin or ma5bin.gz),") 
+        logging.info("     - MA5 random-access event store (ma5store).") 
         logging.info("   If the dataset does not exist, it is created.")
 
 
@@ -344,9 +344,22 @@ def WriteContainer(file,main,part_list):
                 WriteFillWithMETContainerMC(item[0],file,item[1],item[2]) 
                 WriteFillWithMHTContainerMC(item[0],file,item[1],item[2])
 
-        # Ordinary particles
-        file.write('    for (UInt_t i=0;i<event.mc()->particles().size();i++)\n')
-        file.write('    {\n')
+        # Ordinary particles: if they are all final-state particles, only
+        # the view on the final-state particles is scanned
+        finalstate=True
+        for item in part_list:
+            if item[0].particle.Find(99) or item[0].particle.Find(100):
+                pass
+            elif item[2]!='finalstate':
+                finalstate=False
+        if finalstate:
+            file.write('    MCParticleSpan finalstate = event.mc()->classes().finalState();\n')
+            file.write('    for (UInt_t j=0;j<finalstate.size();j++)\n')
+            file.write('    {\n')
+            file.write('      UInt_t i = finalstate.index(j);\n')
+        else:
+            file.write('    for (UInt_t i=0;i<event.mc()->particles().size();i++)\n')
+            file.write('    {\n')
         for item in part_list:
             if item[0].particle.Find(99) or item[0].particle.Find(100):
                 pass
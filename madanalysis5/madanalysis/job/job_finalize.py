@@ -58,4 +58,26 @@ def WriteJobFinalize(file,main):
     #file.write('  delete output;\n')
     file.write('}\n')
 
+    # Merging the results of a replica (multi-threaded mode)
+    file.write('\n')
+    file.write('bool user::Merge(const AnalyzerBase& other)\n{\n')
+    file.write('  // Adding histos and cuts of a replica of the analysis\n')
+    file.write('  const user& replica = dynamic_cast<const user&>(other);\n')
+    file.write('  if (!plots_.Merge(replica.plots_)) return false;\n')
+    file.write('  if (!cuts_.Merge(replica.cuts_)) return false;\n')
+    file.write('  return AnalyzerBase::Merge(other);\n')
+    file.write('}\n')
 
+    # Exchanging the results between processes (multi-process mode)
+    file.write('\n')
+    file.write('void user::Write_BinaryFormat(std::ostream& output) const\n{\n')
+    file.write('  plots_.Write_BinaryFormat(output);\n')
+    file.write('  cuts_.Write_BinaryFormat(output);\n')
+    file.write('  AnalyzerBase::Write_BinaryFormat(output);\n')
+    file.write('}\n')
+    file.write('\n')
+    file.write('bool user::Read_BinaryFormat(std::istream& input)\n{\n')
+    file.write('  if (!plots_.Read_BinaryFormat(input)) return false;\n')
+    file.write('  if (!cuts_.Read_BinaryFormat(input)) return false;\n')
+    file.write('  return AnalyzerBase::Read_BinaryFormat(input);\n')
+    file.write('}\n')
@@ -40,7 +40,11 @@ def WriteHeader(file,main):
     file.write('  virtual bool Initialize(const MA5::Configuration& cfg,\n')
     file.write('                          const std::map<std::string,std::string>& parameters);\n')
     file.write('  virtual void Finalize(const SampleFormat& summary, const std::vector<SampleFormat>& files);\n')
-    file.write('  virtual void Execute(SampleFormat& sample, const EventFormat& event);\n\n')
+    file.write('  virtual void Execute(SampleFormat& sample, const EventFormat& event);\n')
+    file.write('  virtual AnalyzerBase* Clone() const {return new user();}\n')
+    file.write('  virtual bool Merge(const AnalyzerBase& other);\n')
+    file.write('  virtual void Write_BinaryFormat(std::ostream& output) const;\n')
+    file.write('  virtual bool Read_BinaryFormat(std::istream& input);\n\n')
     file.write(' private : \n')
 
 
@@ -69,11 +69,15 @@ def WriteJobNPID(file,main,iabs,ihisto):
 
     # PARTON or HADRON mode
     if main.mode!=MA5RunningType.RECO:
-        file.write('  for (unsigned int i=0;i<event.mc()->particles().size();i++)\n')
-        file.write('  {\n')
         if main.selection[iabs].statuscode=="finalstate":
-            file.write('    if (!PHYSICS->Id->IsFinalState(event.mc()->particles()[i])) continue;\n')
-        elif main.selection[iabs].statuscode=="initialstate":
+            file.write('  MCParticleSpan finalstate = event.mc()->classes().finalState();\n')
+            file.write('  for (unsigned int j=0;j<finalstate.size();j++)\n')
+            file.write('  {\n')
+            file.write('    unsigned int i = finalstate.index(j);\n')
+        else:
+            file.write('  for (unsigned int i=0;i<event.mc()->particles().size();i++)\n')
+            file.write('  {\n')
+        if main.selection[iabs].statuscode=="initialstate":
             file.write('    if (!PHYSICS->Id->IsInitialState(event.mc()->particles()[i])) continue;\n')
         elif main.selection[iabs].statuscode=="interstate":
             file.write('    if (!PHYSICS->Id->IsInterState(event.mc()->particles()[i])) continue;\n')
@@ -134,16 +134,38 @@ class AnalyzerBase
   }
 
   /// Execute
+  /// The initial and final states (status codes of the first and of the 
+  /// last particles) are stored in the classification of the particles of
+  /// the event, which the Identification service reads first: the service 
+  /// is shared by the threads and is not modified here.
   void PreExecute(const SampleFormat& mySample,
                   const EventFormat& myEvent)
   { 
-    PHYSICS->Id->SetFinalState(myEvent.mc());
-    PHYSICS->Id->SetInitialState(myEvent.mc());
+    if (myEvent.mc()!=0) myEvent.mc()->classes();
   }
 
   virtual void Execute(SampleFormat& mySample,
                        const EventFormat& myEvent)=0;
 
+  /// Creating a new instance of the analysis (multi-threaded/process modes)
+  /// A null pointer means that the analysis cannot be replicated
+  virtual AnalyzerBase* Clone() const
+  { return 0; }
+
+  /// Adding the results of a replica of the analysis
+  /// Analyses storing their own counters or plots must extend this method
+  virtual bool Merge(const AnalyzerBase& other)
+  { return manager_.Merge(other.manager_); }
+
+  /// Dumping the results in a binary stream (multi-process mode)
+  /// Analyses storing their own counters or plots must extend this method
+  virtual void Write_BinaryFormat(std::ostream& output) const
+  { manager_.Write_BinaryFormat(output); }
+
+  /// Restoring the results from a binary stream (multi-process mode)
+  virtual bool Read_BinaryFormat(std::istream& input)
+  { return manager_.Read_BinaryFormat(input); }
+
   /// Accessor to analysis name
   const std::string name() const {return name_;}
 
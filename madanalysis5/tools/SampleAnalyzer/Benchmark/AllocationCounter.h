@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+
+// STL headers
+#include <cstddef>
+
+// ROOT headers
+#include <Rtypes.h> 
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Counting the heap allocations of the program, in order to check that the
+/// event loop does not allocate once the buffers have been warmed up.
+///
+/// The counter is only fed when the replacement operators new/delete of
+/// AllocationHooks.h are compiled in the program (include that header in
+/// exactly one source file, e.g. the one with the main function). 
+//////////////////////////////////////////////////////////////////////////////
+class AllocationCounter
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private:
+
+  /// Number of allocations
+  static volatile ULong64_t nallocations_;
+
+  /// Number of allocated bytes
+  static volatile ULong64_t nbytes_;
+
+  /// Are the hooks compiled in the program ?
+  static bool enabled_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public:
+
+  /// Recording one allocation (thread-safe)
+  static void Count(std::size_t size)
+  {
+    __sync_fetch_and_add(&nallocations_, static_cast<ULong64_t>(1));
+    __sync_fetch_and_add(&nbytes_, static_cast<ULong64_t>(size));
+  }
+
+  /// Declaring that the allocations are counted
+  static void Enable()
+  { enabled_=true; }
+
+  /// Are the allocations counted ?
+  static bool IsEnabled()
+  { return enabled_; }
+
+  /// Number of allocations since the beginning of the program
+  static ULong64_t GetAllocations()
+  { return nallocations_; }
+
+  /// Number of bytes allocated since the beginning of the program
+  static ULong64_t GetBytes()
+  { return nbytes_; }
+
+};
+
+}
+
+#endif
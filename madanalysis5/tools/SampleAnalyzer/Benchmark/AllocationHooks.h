@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ALLOCATION_HOOKS_H
+#define ALLOCATION_HOOKS_H
+
+//////////////////////////////////////////////////////////////////////////////
+/// Replacement of the global operators new/delete feeding the 
+/// AllocationCounter. This header defines functions: it must be included 
+/// in one source file of the program only.
+//////////////////////////////////////////////////////////////////////////////
+
+// STL headers
+#include <new>
+#include <cstdlib>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Benchmark/AllocationCounter.h"
+
+#if __cplusplus >= 201103L
+  #define MA5_THROW_BAD_ALLOC
+  #define MA5_NO_THROW noexcept
+#else
+  #define MA5_THROW_BAD_ALLOC throw(std::bad_alloc)
+  #define MA5_NO_THROW throw()
+#endif
+
+void* operator new(std::size_t size) MA5_THROW_BAD_ALLOC
+{
+  MA5::AllocationCounter::Count(size);
+  void* ptr = std::malloc(size==0 ? 1 : size);
+  if (ptr==0) throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](std::size_t size) MA5_THROW_BAD_ALLOC
+{ return operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) MA5_NO_THROW
+{
+  MA5::AllocationCounter::Count(size);
+  return std::malloc(size==0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) MA5_NO_THROW
+{ return operator new(size,tag); }
+
+void operator delete(void* ptr) MA5_NO_THROW
+{ std::free(ptr); }
+
+void operator delete[](void* ptr) MA5_NO_THROW
+{ std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) MA5_NO_THROW
+{ std::free(ptr); }
+
+void operator delete[](void* ptr, const std::nothrow_t&) MA5_NO_THROW
+{ std::free(ptr); }
+
+#undef MA5_THROW_BAD_ALLOC
+#undef MA5_NO_THROW
+
+namespace
+{
+  // Declaring the counting at the start of the program
+  struct AllocationHooksEnabler
+  { AllocationHooksEnabler() { MA5::AllocationCounter::Enable(); } };
+  AllocationHooksEnabler allocationHooksEnabler;
+}
+
+#endif
@@ -0,0 +1,282 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+// STL headers
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Benchmark/ExclusiveKtBenchmark.h"
+#include "SampleAnalyzer/JetClustering/ExclusiveKt.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+// FastJet headers
+#ifdef FASTJET_USE
+  #include <fastjet/ClusterSequence.hh>
+  #include <fastjet/PseudoJet.hh>
+#endif
+
+using namespace MA5;
+
+
+#ifdef FORTRAN_USE
+extern "C"
+{
+  // KTCLUS of ktclusdble.f (non-zero if the event could not be processed)
+  int ktclus_(int* imode, double* pp, int* nn, double* ecut, double* y);
+}
+#endif
+
+
+namespace
+{
+
+  const Double_t pi = 3.14159265358979323846;
+
+  // Jet of the brute-force clustering
+  struct BruteForceJet
+  {
+    Double_t px, py, pz, e, kt2, rap, phi;
+
+    // Rapidity and azimuth as in fastjet::PseudoJet
+    void SetKinematics()
+    {
+      kt2 = px*px + py*py;
+      phi = (kt2==0.) ? 0. : std::atan2(py,px);
+      if (phi<0.)     phi += 2*pi;
+      if (phi>=2*pi)  phi -= 2*pi;
+      if (e==std::fabs(pz) && kt2==0.)
+      {
+        Double_t maxrap = 1e5 + std::fabs(pz);
+        rap = (pz>=0.) ? maxrap : -maxrap;
+      }
+      else
+      {
+        Double_t m2 = std::max(0., (e+pz)*(e-pz)-kt2);
+        Double_t ep = e + std::fabs(pz);
+        rap = 0.5*std::log((kt2+m2)/(ep*ep));
+        if (pz>0.) rap = -rap;
+      }
+    }
+  };
+
+  // FastJet kt_algorithm with R=1 and the E scheme: the smallest of all
+  // the distances is searched at each step
+  void BruteForce(Int_t, const std::vector<Double_t>& momenta,
+                  std::vector<Double_t>& dmerge)
+  {
+    std::vector<BruteForceJet> jets(momenta.size()/4);
+    for (UInt_t i=0;i<jets.size();i++)
+    {
+      jets[i].px = momenta[4*i];
+      jets[i].py = momenta[4*i+1];
+      jets[i].pz = momenta[4*i+2];
+      jets[i].e  = momenta[4*i+3];
+      jets[i].SetKinematics();
+    }
+    dmerge.assign(jets.size(),0.);
+
+    while (!jets.empty())
+    {
+      UInt_t n = jets.size();
+      Double_t best = jets[0].kt2;
+      UInt_t ibest = 0, jbest = 0;
+      for (UInt_t i=0;i<n;i++)
+      {
+        if (jets[i].kt2<best) { best=jets[i].kt2; ibest=i; jbest=i; }
+        for (UInt_t j=i+1;j<n;j++)
+        {
+          Double_t drap = jets[i].rap - jets[j].rap;
+          Double_t dphi = std::fabs(jets[i].phi - jets[j].phi);
+          if (dphi>pi) dphi = 2*pi - dphi;
+          Double_t d = std::min(jets[i].kt2,jets[j].kt2)*(drap*drap+dphi*dphi);
+          if (d<best) { best=d; ibest=i; jbest=j; }
+        }
+      }
+      dmerge[n-1] = best;
+      if (jbest!=ibest)
+      {
+        jets[ibest].px += jets[jbest].px;
+        jets[ibest].py += jets[jbest].py;
+        jets[ibest].pz += jets[jbest].pz;
+        jets[ibest].e  += jets[jbest].e;
+        jets[ibest].SetKinematics();
+      }
+      jets.erase(jets.begin()+jbest);
+    }
+  }
+
+#ifdef FASTJET_USE
+  // FastJet kt_algorithm with R=1, as used by MergingPlots
+  void FastJet(Int_t, const std::vector<Double_t>& momenta,
+               std::vector<Double_t>& dmerge)
+  {
+    std::vector<fastjet::PseudoJet> inputs;
+    for (UInt_t i=0;i+3<momenta.size();i+=4)
+      inputs.push_back(fastjet::PseudoJet(momenta[i],momenta[i+1],
+                                          momenta[i+2],momenta[i+3]));
+    fastjet::JetDefinition definition(fastjet::kt_algorithm,1.0);
+    fastjet::ClusterSequence sequence(inputs,definition);
+    dmerge.resize(inputs.size());
+    for (UInt_t i=0;i<dmerge.size();i++)
+      dmerge[i]=sequence.exclusive_dmerge(i);
+  }
+#endif
+
+#ifdef FORTRAN_USE
+  // KTCLUS with ECUT=1: Y(J) is the distance from J to J-1 jets
+  void Ktclus(Int_t mode, const std::vector<Double_t>& momenta,
+              std::vector<Double_t>& dmerge)
+  {
+    std::vector<double> pp(momenta.begin(),momenta.end());
+    int imode = mode;
+    int nn = momenta.size()/4;
+    double ecut = 1.;
+    std::vector<double> y(nn+1,0.);
+    dmerge.clear();
+    if (ktclus_(&imode,&pp[0],&nn,&ecut,&y[0])!=0) return;
+    dmerge.assign(y.begin(),y.begin()+nn);
+  }
+#endif
+
+  // Random event of 2 to 41 particles (one event out of 5: 2 to 401), 
+  // generated by a linear congruential generator for reproducibility
+  void Randomize(std::vector<Double_t>& momenta, UInt_t event, ULong64_t& seed)
+  {
+    Double_t r[5];
+    for (UInt_t j=0;j<5;j++)
+    {
+      seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+      r[j] = static_cast<Double_t>(seed>>11)/9007199254740992.;
+    }
+    UInt_t n = 2 + static_cast<UInt_t>(r[0]*((event%5==0) ? 400 : 40));
+    momenta.resize(4*n);
+    for (UInt_t i=0;i<n;i++)
+    {
+      for (UInt_t j=0;j<5;j++)
+      {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        r[j] = static_cast<Double_t>(seed>>11)/9007199254740992.;
+      }
+      Double_t pt  = 1. + 100.*r[0]*r[0]*r[0];
+      Double_t eta = 9.*(r[1]-0.5);
+      Double_t phi = 2*pi*r[2];
+      Double_t m   = (r[3]<0.5) ? 0. : 5.*r[4];
+      momenta[4*i]   = pt*std::cos(phi);
+      momenta[4*i+1] = pt*std::sin(phi);
+      momenta[4*i+2] = pt*std::sinh(eta);
+      momenta[4*i+3] = std::sqrt(momenta[4*i+2]*momenta[4*i+2]+pt*pt+m*m);
+    }
+  }
+
+}
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+bool ExclusiveKtBenchmark::Run(UInt_t nevents)
+{
+  bool ok = Compare("brute force",BruteForce,ExclusiveKt::FASTJET,nevents);
+
+#ifdef FASTJET_USE
+  if (!Compare("FastJet",FastJet,ExclusiveKt::FASTJET,nevents)) ok = false;
+#endif
+
+#ifdef FORTRAN_USE
+  const Int_t modes[] = { 1111, 2111, 3111, 4111, 4211, 4212, 4213, 4311, 
+                          4312, 4313, 1211, 1313, 4112, 4113, 2312 };
+  for (UInt_t i=0;i<sizeof(modes)/sizeof(Int_t);i++)
+    if (!Compare("KTCLUS",Ktclus,modes[i],nevents)) ok = false;
+#endif
+
+  return ok;
+}
+
+
+// -----------------------------------------------------------------------------
+// Compare
+// -----------------------------------------------------------------------------
+bool ExclusiveKtBenchmark::Compare(const std::string& name, 
+                                   Reference reference, Int_t mode,
+                                   UInt_t nevents)
+{
+  ExclusiveKt kt;
+  if (!kt.SetMode(mode)) return false;
+
+  ULong64_t seed = 12345;
+  std::vector<Double_t> momenta;
+  std::vector<Double_t> dmerge;
+  std::clock_t native = 0, other = 0;
+  Double_t worst = 0.;
+  UInt_t skipped = 0;
+
+  for (UInt_t e=0;e<nevents;e++)
+  {
+    Randomize(momenta,e,seed);
+    UInt_t n = momenta.size()/4;
+
+    std::clock_t start = std::clock();
+    kt.Clear();
+    for (UInt_t i=0;i<n;i++)
+      kt.Add(momenta[4*i],momenta[4*i+1],momenta[4*i+2],momenta[4*i+3]);
+    kt.Cluster();
+    std::clock_t middle = std::clock();
+    reference(mode,momenta,dmerge);
+    std::clock_t stop = std::clock();
+    native += middle-start;
+    other  += stop-middle;
+
+    if (dmerge.size()<n) { skipped++; continue; }
+    for (UInt_t i=0;i<n && i<12;i++)
+    {
+      Double_t diff = std::fabs(kt.dmerge(i)-dmerge[i]);
+      if (diff==0.) continue;
+      diff /= std::max(std::fabs(dmerge[i]),1e-300);
+      if (diff>worst) worst = diff;
+    }
+  }
+
+  Double_t time1 = 1e3*static_cast<Double_t>(native)/CLOCKS_PER_SEC/nevents;
+  Double_t time2 = 1e3*static_cast<Double_t>(other)/CLOCKS_PER_SEC/nevents;
+  std::stringstream str;
+  str << std::setw(12) << std::left << name << std::right 
+      << " mode " << std::setw(4) << mode 
+      << ": worst relative difference " << std::scientific 
+      << std::setprecision(2) << worst << std::fixed << std::setprecision(3)
+      << ", " << time1 << " ms (native) vs " << time2 << " ms per event";
+  INFO << "    " << str.str() << endmsg;
+  if (skipped!=0)
+    WARNING << skipped << " events not clustered by the reference" << endmsg;
+
+  if (worst>1e-6)
+  {
+    ERROR << "the merging scales of ExclusiveKt differ from the reference"
+          << endmsg;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef EXCLUSIVE_KT_BENCHMARK_H
+#define EXCLUSIVE_KT_BENCHMARK_H
+
+// STL headers
+#include <string>
+#include <vector>
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Checking the merging scales of ExclusiveKt against reference clusterings
+/// of the same random events, and comparing their costs:
+///  - a brute-force N^3 clustering written with the definitions of the 
+///    ClusterSequence of FastJet (mode FASTJET),
+///  - FastJet itself (exclusive_dmerge of a ClusterSequence with the
+///    kt_algorithm and R=1, as in MergingPlots), with FASTJET_USE,
+///  - KTCLUS (ktclusdble.f) for its modes, when the library is compiled 
+///    with the Fortran (FORTRAN_USE).
+//////////////////////////////////////////////////////////////////////////////
+class ExclusiveKtBenchmark
+{
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Reference clustering: 'momenta' contains (px,py,pz,E) for each 
+  /// particle, dmerge[n] is the distance at which the event goes from 
+  /// n+1 to n jets (empty if the event could not be clustered)
+  typedef void (*Reference)(Int_t mode, const std::vector<Double_t>& momenta,
+                            std::vector<Double_t>& dmerge);
+
+  /// Comparison with the brute-force clustering, FastJet and KTCLUS. False
+  /// if a merging scale differs.
+  static bool Run(UInt_t nevents=300);
+
+  /// Comparison with a reference clustering in a given mode of ExclusiveKt
+  /// (worst relative difference of the 12 lowest merging scales, time per
+  /// event). False if a merging scale differs by more than 1e-6.
+  static bool Compare(const std::string& name, Reference reference,
+                      Int_t mode, UInt_t nevents=300);
+
+};
+
+}
+
+#endif
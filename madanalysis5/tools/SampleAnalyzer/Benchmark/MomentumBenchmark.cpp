@@ -0,0 +1,200 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Benchmark/MomentumBenchmark.h"
+#include "SampleAnalyzer/DataFormat/MALorentzVector.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+
+namespace
+{
+
+  // Accessors to measure
+  struct PtAccessor
+  {
+    template <typename V> static Double_t Get(const V& v) { return v.Pt(); }
+  };
+  struct EtaAccessor
+  {
+    template <typename V> static Double_t Get(const V& v) { return v.Eta(); }
+  };
+  struct PhiAccessor
+  {
+    template <typename V> static Double_t Get(const V& v) { return v.Phi(); }
+  };
+
+  // Time spent per call in ns
+  Double_t PerCall(std::clock_t start, std::clock_t stop, ULong64_t ncalls)
+  { 
+    return 1e9*static_cast<Double_t>(stop-start)/CLOCKS_PER_SEC/
+           static_cast<Double_t>(ncalls);
+  }
+
+  // Calling the accessor on all the vectors
+  template <typename A, typename V>
+  Double_t Measure(const std::vector<V>& vectors, UInt_t passes, Double_t& sum)
+  {
+    std::clock_t start = std::clock();
+    for (UInt_t k=0;k<passes;k++)
+      for (UInt_t i=0;i<vectors.size();i++) sum+=A::Get(vectors[i]);
+    return PerCall(start,std::clock(),
+                   static_cast<ULong64_t>(passes)*vectors.size());
+  }
+
+  // Same after modifying each vector (the modification is included)
+  template <typename A, typename V>
+  Double_t MeasureModified(std::vector<V>& vectors, UInt_t passes, 
+                           Double_t& sum)
+  {
+    std::clock_t start = std::clock();
+    for (UInt_t k=0;k<passes;k++)
+      for (UInt_t i=0;i<vectors.size();i++)
+      {
+        V& v = vectors[i];
+        v.SetPxPyPzE(v.Px(),v.Py(),v.Pz(),v.E());
+        sum+=A::Get(v);
+      }
+    return PerCall(start,std::clock(),
+                   static_cast<ULong64_t>(passes)*vectors.size());
+  }
+
+  // Delta R between all the pairs of vectors
+  template <typename V>
+  Double_t MeasureDeltaR(std::vector<V>& vectors, UInt_t passes, 
+                         bool modified, Double_t& sum)
+  {
+    std::clock_t start = std::clock();
+    for (UInt_t k=0;k<passes;k++)
+    {
+      if (modified)
+        for (UInt_t i=0;i<vectors.size();i++)
+        {
+          V& v = vectors[i];
+          v.SetPxPyPzE(v.Px(),v.Py(),v.Pz(),v.E());
+        }
+      for (UInt_t i=0;i<vectors.size();i++)
+        for (UInt_t j=i+1;j<vectors.size();j++) 
+          sum+=vectors[i].DeltaR(vectors[j]);
+    }
+    ULong64_t npairs = static_cast<ULong64_t>(vectors.size())*
+                       (vectors.size()-1)/2;
+    return PerCall(start,std::clock(),passes*npairs);
+  }
+
+  // Displaying one line of the table
+  void Display(const std::string& name, Double_t root, 
+               Double_t modified, Double_t cached)
+  {
+    std::stringstream str;
+    str << std::fixed << std::setprecision(1)
+        << std::setw(10) << std::left << name << std::right
+        << std::setw(16) << root 
+        << std::setw(16) << modified 
+        << std::setw(16) << cached;
+    if (cached>0) str << std::setw(10) << root/cached << "x";
+    INFO << "    " << str.str() << endmsg;
+  }
+
+}
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+void MomentumBenchmark::Run(UInt_t ncalls)
+{
+  // Random vectors (pt in [5,500], |eta|<4, masses up to 10), generated 
+  // by a linear congruential generator for reproducibility
+  const UInt_t n = 1000;
+  std::vector<TLorentzVector>  root(n);
+  std::vector<MALorentzVector> ma5(n);
+  ULong64_t seed = 12345;
+  for (UInt_t i=0;i<n;i++)
+  {
+    Double_t r[4];
+    for (UInt_t j=0;j<4;j++)
+    {
+      seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+      r[j] = static_cast<Double_t>(seed>>11)/9007199254740992.;
+    }
+    Double_t pt  = 5.+495.*r[0];
+    Double_t eta = -4.+8.*r[1];
+    Double_t phi = 3.14159265358979323846*(2.*r[2]-1.);
+    Double_t m   = 10.*r[3];
+    root[i].SetPtEtaPhiM(pt,eta,phi,m);
+    ma5[i].SetPtEtaPhiM(pt,eta,phi,m);
+  }
+
+  // Single-vector accessors
+  UInt_t passes = ncalls/n;
+  if (passes==0) passes=1;
+  Double_t sum = 0;
+  Double_t table[3][3];
+  table[0][0] = Measure<PtAccessor>(root,passes,sum);
+  table[0][1] = MeasureModified<PtAccessor>(ma5,passes,sum);
+  table[0][2] = Measure<PtAccessor>(ma5,passes,sum);
+  table[1][0] = Measure<EtaAccessor>(root,passes,sum);
+  table[1][1] = MeasureModified<EtaAccessor>(ma5,passes,sum);
+  table[1][2] = Measure<EtaAccessor>(ma5,passes,sum);
+  table[2][0] = Measure<PhiAccessor>(root,passes,sum);
+  table[2][1] = MeasureModified<PhiAccessor>(ma5,passes,sum);
+  table[2][2] = Measure<PhiAccessor>(ma5,passes,sum);
+
+  // Delta R between the pairs of the first 200 vectors
+  root.resize(200);
+  ma5.resize(200);
+  UInt_t drpasses = ncalls/(200*199/2);
+  if (drpasses==0) drpasses=1;
+  Double_t dr[3];
+  dr[0] = MeasureDeltaR(root,drpasses,false,sum);
+  dr[1] = MeasureDeltaR(ma5, drpasses,true, sum);
+  dr[2] = MeasureDeltaR(ma5, drpasses,false,sum);
+
+  // Table
+  std::stringstream header;
+  header << std::setw(10) << std::left << "accessor" << std::right
+         << std::setw(16) << "TLorentzVector"
+         << std::setw(16) << "MA5 (modified)"
+         << std::setw(16) << "MA5 (cached)"
+         << std::setw(11) << "speed-up";
+  INFO << "    Cost of the kinematic accessors (ns per call):" << endmsg;
+  INFO << "    " << header.str() << endmsg;
+  Display("pt()",  table[0][0],table[0][1],table[0][2]);
+  Display("eta()", table[1][0],table[1][1],table[1][2]);
+  Display("phi()", table[2][0],table[2][1],table[2][2]);
+  Display("dr()",  dr[0],dr[1],dr[2]);
+
+  // Using the sum so that the loops are not optimized away
+  if (sum==0.12345) INFO << sum << endmsg;
+}
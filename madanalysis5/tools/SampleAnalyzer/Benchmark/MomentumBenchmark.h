@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MOMENTUM_BENCHMARK_H
+#define MOMENTUM_BENCHMARK_H
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Measuring the cost of the kinematic accessors (pt, eta, phi, delta R)
+/// of TLorentzVector and of MALorentzVector, in ns per call. For 
+/// MALorentzVector, the cost is given just after a modification of the 
+/// vector (the value is computed) and when the value is cached.
+//////////////////////////////////////////////////////////////////////////////
+class MomentumBenchmark
+{
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Running the measurements on a set of random vectors and displaying
+  /// the table (each accessor is called about ncalls times)
+  static void Run(UInt_t ncalls=2000000);
+
+};
+
+}
+
+#endif
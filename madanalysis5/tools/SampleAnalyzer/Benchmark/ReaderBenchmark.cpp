@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Benchmark/ReaderBenchmark.h"
+#include "SampleAnalyzer/Service/LogService.h"
+#include "SampleAnalyzer/Benchmark/AllocationCounter.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+bool ReaderBenchmark::Run(ReaderBase* reader, const std::string& filename,
+                          UInt_t nevents)
+{
+  if (reader==0)
+  {
+    ERROR << "no reader is available for the file " << filename << endmsg;
+    return false;
+  }
+
+  // Opening the file
+  Configuration cfg;
+  if (!reader->Initialize(filename,cfg)) return false;
+  Long64_t length = reader->GetFileSize();
+
+  // Reading the header
+  SampleFormat mySample;
+  EventFormat  myEvent;
+  std::clock_t start = std::clock();
+  if (!reader->ReadHeader(mySample))
+  {
+    ERROR << "No header has been found in the file " << filename << endmsg;
+    reader->Finalize();
+    return false;
+  }
+  reader->FinalizeHeader(mySample);
+
+  // Reading the events
+  UInt_t n=0;
+  ULong64_t nallocations=0;
+  while (nevents==0 || n<nevents)
+  {
+    if (n==WarmUp) nallocations = AllocationCounter::GetAllocations();
+    StatusCode::Type test = reader->ReadEvent(myEvent,mySample);
+    if (test==StatusCode::FAILURE) break;
+    if (test==StatusCode::KEEP) reader->FinalizeEvent(mySample,myEvent);
+    n++;
+  }
+  Long64_t position = reader->GetPosition();
+  std::clock_t stop = std::clock();
+  if (n>WarmUp) nallocations = AllocationCounter::GetAllocations()-nallocations;
+  reader->Finalize();
+
+  // Throughput (the position is used when the file is not read until the end)
+  Double_t seconds = static_cast<Double_t>(stop-start)/CLOCKS_PER_SEC;
+  if (position<=0 || position>length) position=length;
+  INFO << "    * " << filename << endmsg;
+  INFO << "        => " << n << " events in " << seconds << " s" << endmsg;
+  if (seconds>0)
+  {
+    std::stringstream str;
+    str << std::fixed << std::setprecision(1)
+        << static_cast<Double_t>(n)/seconds << " events/s, "
+        << static_cast<Double_t>(position)/(1024.*1024.)/seconds << " Mo/s";
+    INFO << "        => " << str.str() << endmsg;
+  }
+  if (AllocationCounter::IsEnabled() && n>WarmUp)
+  {
+    std::stringstream str;
+    str << nallocations << " heap allocations after the first " << WarmUp 
+        << " events (" << std::fixed << std::setprecision(3)
+        << static_cast<Double_t>(nallocations)/(n-WarmUp) << " per event)";
+    INFO << "        => " << str.str() << endmsg;
+  }
+  return true;
+}
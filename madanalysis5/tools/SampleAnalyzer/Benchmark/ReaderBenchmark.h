@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef READER_BENCHMARK_H
+#define READER_BENCHMARK_H
+
+// STL headers
+#include <string>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Measuring the throughput of a reader (events/s and Mo/s) on a sample:
+/// the file is read and each event is finalized, without any analysis.
+/// When the allocations are counted (see AllocationCounter), the number of
+/// heap allocations done after the first WarmUp events is also displayed.
+//////////////////////////////////////////////////////////////////////////////
+class ReaderBenchmark
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Number of events read before counting the allocations
+  static const UInt_t WarmUp = 100;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Reading the file with the reader and displaying the throughput
+  /// (at most nevents events if nevents is not zero)
+  static bool Run(ReaderBase* reader, const std::string& filename,
+                  UInt_t nevents=0);
+
+};
+
+}
+
+#endif
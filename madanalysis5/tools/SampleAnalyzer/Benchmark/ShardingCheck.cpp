@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <sstream>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Benchmark/ShardingCheck.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Tag
+// -----------------------------------------------------------------------------
+bool ShardingCheck::Tag(ReaderBase* reader, JetClustererBase* clusterer,
+                        const std::string& filename, UInt_t index, 
+                        UInt_t nshards, std::map<ULong64_t,std::string>& tags)
+{
+  // Opening the file
+  Configuration cfg;
+  if (!reader->Initialize(filename,cfg)) return false;
+  SampleFormat mySample;
+  EventFormat  myEvent;
+  if (!reader->ReadHeader(mySample))
+  {
+    ERROR << "No header has been found in the file " << filename << endmsg;
+    reader->Finalize();
+    return false;
+  }
+  reader->FinalizeHeader(mySample);
+
+  // Selecting the shard
+  if (nshards>1 && !reader->SelectShard(index,nshards))
+  {
+    reader->Finalize();
+    return false;
+  }
+  ULong64_t first  = 0;
+  ULong64_t stride = 1;
+  reader->GetSelection(first,stride);
+
+  // Clustering and tagging the jets, as SampleAnalyzer::NextEvent does
+  ULong64_t n = 0;
+  while (true)
+  {
+    StatusCode::Type test = reader->ReadEvent(myEvent,mySample);
+    if (test==StatusCode::FAILURE) break;
+    Long64_t key = reader->GetEventKey();
+    ULong64_t number = (key>=0) ? static_cast<ULong64_t>(key) : first+stride*n;
+    n++;
+    if (test!=StatusCode::KEEP) continue;
+    myEvent.random().Initialize(cfg.GetRandomSeed(), 0, number);
+    if (!reader->FinalizeEvent(mySample,myEvent)) continue;
+    clusterer->Execute(mySample,myEvent);
+
+    std::stringstream str;
+    for (UInt_t i=0;i<myEvent.rec()->jets().size();i++)
+    {
+      const RecJetFormat& jet = myEvent.rec()->jets()[i];
+      str << jet.btag() << jet.true_btag() << jet.true_ctag() << " ";
+    }
+    str << "taus=" << myEvent.rec()->taus().size();
+    tags[number] = str.str();
+  }
+  reader->Finalize();
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+bool ShardingCheck::Run(ReaderBase* reader, JetClustererBase* clusterer,
+                        const std::string& filename, UInt_t nshards)
+{
+  if (reader==0 || clusterer==0) return false;
+
+  // Reference: the whole file
+  std::map<ULong64_t,std::string> serial;
+  if (!Tag(reader,clusterer,filename,0,1,serial)) return false;
+
+  // The same file in shards
+  std::map<ULong64_t,std::string> sharded;
+  for (UInt_t i=0;i<nshards;i++)
+  {
+    std::map<ULong64_t,std::string> shard;
+    if (!Tag(reader,clusterer,filename,i,nshards,shard))
+    {
+      INFO << "    * " << filename << ": the file cannot be split" << endmsg;
+      return true;
+    }
+    for (std::map<ULong64_t,std::string>::const_iterator 
+         it=shard.begin();it!=shard.end();it++)
+    {
+      if (!sharded.insert(*it).second)
+      {
+        ERROR << "the event " << it->first << " of the file " << filename
+              << " is read by several shards" << endmsg;
+        return false;
+      }
+    }
+  }
+
+  // Comparing the tags event by event
+  UInt_t nmismatches = 0;
+  std::map<ULong64_t,std::string>::const_iterator it1 = serial.begin();
+  std::map<ULong64_t,std::string>::const_iterator it2 = sharded.begin();
+  for (;it1!=serial.end() && it2!=sharded.end();it1++,it2++)
+    if (it1->first!=it2->first || it1->second!=it2->second) nmismatches++;
+  if (serial.size()!=sharded.size() || nmismatches!=0)
+  {
+    ERROR << "the " << nshards << " shards of the file " << filename 
+          << " do not tag the jets as the whole file (" << sharded.size()
+          << " events instead of " << serial.size() << ", " << nmismatches
+          << " different events)" << endmsg;
+    return false;
+  }
+  INFO << "    * " << filename << ": " << serial.size() 
+       << " events tagged identically in " << nshards << " shards" << endmsg;
+  return true;
+}
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SHARDING_CHECK_H
+#define SHARDING_CHECK_H
+
+// STL headers
+#include <string>
+#include <map>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+#include "SampleAnalyzer/JetClustering/JetClustererBase.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Checking that a sample analyzed in shards gives the same tagged jets as
+/// when it is analyzed in one go: the efficiencies are drawn from the random
+/// stream of each event, which must not depend on the shard: it is keyed by
+/// the position of the event in the file (ReaderBase::GetEventKey), or by 
+/// its index when the reader gives no position.
+//////////////////////////////////////////////////////////////////////////////
+class ShardingCheck
+{
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Clustering and tagging the jets of the file read at once, then in
+  /// nshards shards, and comparing the tags event by event
+  static bool Run(ReaderBase* reader, JetClustererBase* clusterer,
+                  const std::string& filename, UInt_t nshards=4);
+
+ private :
+
+  /// Tags of the jets of the events of a shard, indexed by the key of the
+  /// events (nshards=1 for the whole file)
+  static bool Tag(ReaderBase* reader, JetClustererBase* clusterer,
+                  const std::string& filename, UInt_t index, UInt_t nshards,
+                  std::map<ULong64_t,std::string>& tags);
+
+};
+
+}
+
+#endif
@@ -0,0 +1,641 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Benchmark/TaggerBenchmark.h"
+#include "SampleAnalyzer/JetClustering/bTagger.h"
+#include "SampleAnalyzer/JetClustering/cTagger.h"
+#include "SampleAnalyzer/JetClustering/TauTagger.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+
+namespace
+{
+
+  // Exclusive selection of Method2 before DeltaRMatcher::KeepClosest. With
+  // fixed, the DeltaR of the kept candidate is updated after a swap.
+  void OldKeepClosest(std::vector<RecJetFormat*>& Candidates, bool fixed)
+  {
+    UInt_t i = 0;
+    UInt_t n = Candidates.size();
+
+    while (i<n)
+    {
+      UInt_t j = i+1;
+
+      Float_t DeltaR = Candidates[i]->mc()->dr(Candidates[i]);
+
+      while (j<n)
+      {
+        if (Candidates[i]->mc()==Candidates[j]->mc())
+        {
+          Float_t DeltaR2 = Candidates[j]->mc()->dr(Candidates[j]);
+
+          if (DeltaR2<DeltaR) 
+          {
+            std::swap(Candidates[i], Candidates[j]);
+            if (fixed) DeltaR = DeltaR2;
+          }
+
+          Candidates.erase(Candidates.begin()+j);
+          n--;
+        }
+        else j++;
+      }
+
+      i++;
+    }
+  }
+
+  // Matching of a quark in Method3 before DeltaRMatcher: the matched 
+  // candidates are moved to the end and removed
+  void OldMatch3(const MCParticleFormat& quark, 
+                 std::vector<RecJetFormat*>& Candidates, Float_t DeltaRmax, 
+                 Bool_t Exclusive, std::vector<RecJetFormat*>& tagged)
+  {
+    UInt_t k = 0;
+
+    for (unsigned int j=Candidates.size();j>0;j--)
+    {
+      Float_t DeltaR = quark.dr(Candidates[j-1]);
+
+      if (DeltaR <= DeltaRmax)
+      {
+        k++;
+        std::swap (Candidates[j-1], Candidates[Candidates.size()-k]);
+      }
+    }
+
+    if (Exclusive)
+    {
+      while (k>1)
+      {
+        if (Candidates[Candidates.size()-1]->e() > 
+            Candidates[Candidates.size()-2]->e()) 
+          std::swap(Candidates[Candidates.size()-1], 
+                    Candidates[Candidates.size()-2]);
+        Candidates.pop_back();
+        k--;
+      }
+    }
+
+    for (unsigned int j=0;j<k;j++)
+    {
+      tagged.push_back(Candidates[Candidates.size()-1]);
+      Candidates.pop_back();
+    }
+  }
+
+  // Configuration of the comparison: a tagger, the same one with the 
+  // nested loops, and with the nested loops where the reference DeltaR of
+  // the exclusive Method2 is updated after a swap
+  struct TaggerSet
+  {
+    std::string name;
+    UInt_t      flavour;
+    TaggerBase* tagger[3];
+  };
+
+  // Tags of the jets and of the taus of the event
+  std::string Tags(const EventFormat& myEvent)
+  {
+    std::stringstream str;
+    str << std::fixed << std::setprecision(3);
+    for (UInt_t i=0;i<myEvent.rec()->jets().size();i++)
+    {
+      const RecJetFormat& jet = myEvent.rec()->jets()[i];
+      str << jet.pt() << ":" << jet.btag() << jet.true_btag() 
+          << jet.true_ctag() << " ";
+    }
+    str << "|";
+    for (UInt_t i=0;i<myEvent.rec()->taus().size();i++)
+      str << " " << myEvent.rec()->taus()[i].pt();
+    return str.str();
+  }
+
+  // Random (eta,phi) of the particles (|eta|<2.5), generated by a linear
+  // congruential generator for reproducibility
+  template <typename T>
+  void Randomize(std::vector<T>& particles, ULong64_t& seed)
+  {
+    for (UInt_t i=0;i<particles.size();i++)
+    {
+      Double_t r[2];
+      for (UInt_t j=0;j<2;j++)
+      {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        r[j] = static_cast<Double_t>(seed>>11)/9007199254740992.;
+      }
+      particles[i].momentum().SetPtEtaPhiE(50., 5.*r[0]-2.5, 
+                                 3.14159265358979323846*(2.*r[1]-1.), 100.);
+    }
+  }
+
+}
+
+
+// -----------------------------------------------------------------------------
+// Taggers with the nested loops
+// -----------------------------------------------------------------------------
+
+// b-tagger with the nested loops (the efficiencies are not used here)
+class TaggerBenchmark::OldbTagger : public bTagger
+{
+ public:
+  bool fixed_;
+  OldbTagger(bool fixed) { fixed_=fixed; }
+
+  virtual void Method1(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    for (unsigned int i=0;i<myEvent.rec()->MCBquarks().size();i++)
+      Match1(*myEvent.rec()->MCBquarks()[i], myEvent, Candidates);
+    for (unsigned int i=0;i<Candidates.size();i++)
+      Candidates[i]->true_btag_ = true;
+    Candidates.clear();
+    for (unsigned int i=0;i<myEvent.rec()->MCCquarks().size();i++)
+      Match1(*myEvent.rec()->MCCquarks()[i], myEvent, Candidates);
+    for (unsigned int i=0;i<Candidates.size();i++)
+      if (!Candidates[i]->true_btag_) Candidates[i]->true_ctag_ = true;
+    for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
+      myEvent.rec()->jets()[i].btag_ = myEvent.rec()->jets()[i].true_btag_;
+  }
+
+  void Match1(const MCParticleFormat& quark, EventFormat& myEvent,
+              std::vector<RecJetFormat*>& Candidates)
+  {
+    RecJetFormat* tag = 0;
+    Double_t DeltaRmax = DeltaRmax_;
+    for (unsigned int j=0;j<myEvent.rec()->jets().size();j++)
+    {
+      if (myEvent.rec()->jets()[j].pt()<1e-10) continue;
+      Float_t DeltaR = quark.dr(myEvent.rec()->jets()[j]);
+      if (DeltaR <= DeltaRmax) 
+      {
+        if (Exclusive_)
+        {
+          tag = &(myEvent.rec()->jets()[j]);
+          DeltaRmax = DeltaR;
+        }
+        else Candidates.push_back(& myEvent.rec()->jets()[j]);
+      }
+    }
+    if (Exclusive_ && tag!=0) Candidates.push_back(tag);
+  }
+
+  // Jets with a B hadron in their history (unchanged inclusive Method2)
+  void Preselect(SampleFormat& mySample, EventFormat& myEvent,
+                 std::vector<RecJetFormat*>& Candidates)
+  {
+    Bool_t exclusive = Exclusive_;
+    Exclusive_ = false;
+    bTagger::Method2(mySample,myEvent);
+    Exclusive_ = exclusive;
+    for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
+    {
+      if (!myEvent.rec()->jets()[i].btag_) continue;
+      myEvent.rec()->jets()[i].btag_ = false;
+      Candidates.push_back(&myEvent.rec()->jets()[i]);
+    }
+  }
+
+  virtual void Method2(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    Preselect(mySample,myEvent,Candidates);
+    if (Exclusive_) OldKeepClosest(Candidates,fixed_);
+    for (unsigned int i=0;i<Candidates.size();i++)
+      Candidates[i]->btag_ = true;
+  }
+
+  virtual void Method3(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    std::vector<RecJetFormat*> tagged;
+    Preselect(mySample,myEvent,Candidates);
+    for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
+    {
+      if (fabs(myEvent.mc()->particles()[i].pdgid())!=5) continue;
+      if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+      OldMatch3(myEvent.mc()->particles()[i], Candidates, DeltaRmax_,
+                Exclusive_, tagged);
+    }
+    for (unsigned int i=0;i<tagged.size();i++) tagged[i]->btag_ = true;
+  }
+};
+
+// c-tagger with the nested loops
+class TaggerBenchmark::OldcTagger : public cTagger
+{
+ public:
+  bool fixed_;
+  OldcTagger(bool fixed) { fixed_=fixed; }
+
+  virtual void Method1(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
+    {
+      if (PHYSICS->Id->IsInitialState(myEvent.mc()->particles()[i])) continue;
+      if (fabs(myEvent.mc()->particles()[i].pdgid())!=4) continue;
+      if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+
+      Bool_t tag = false;
+      Double_t DeltaRmax = DeltaRmax_;
+      for (unsigned int j=0;j<myEvent.rec()->jets().size();j++)
+      {
+        if (myEvent.rec()->jets()[j].btag()) continue;
+        Float_t DeltaR = 
+          myEvent.mc()->particles()[i].dr(myEvent.rec()->jets()[j]);
+        if (DeltaR <= DeltaRmax) 
+        {
+          if (Exclusive_)
+          {
+            if (tag) Candidates.pop_back();
+            tag = true;
+            DeltaRmax = DeltaR;
+          }
+          Candidates.push_back(& myEvent.rec()->jets()[j]);
+        }
+      }
+      for (unsigned int j=0;j<Candidates.size();j++)
+        Candidates[j]->true_ctag_ = true;
+      Candidates.clear();
+    }
+  }
+
+  // Jets with a C hadron in their history (unchanged inclusive Method2)
+  void Preselect(SampleFormat& mySample, EventFormat& myEvent,
+                 std::vector<RecJetFormat*>& Candidates)
+  {
+    Bool_t exclusive = Exclusive_;
+    Exclusive_ = false;
+    cTagger::Method2(mySample,myEvent);
+    Exclusive_ = exclusive;
+    for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
+    {
+      if (!myEvent.rec()->jets()[i].true_ctag_) continue;
+      myEvent.rec()->jets()[i].true_ctag_ = false;
+      Candidates.push_back(&myEvent.rec()->jets()[i]);
+    }
+  }
+
+  virtual void Method2(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    Preselect(mySample,myEvent,Candidates);
+    if (Exclusive_) OldKeepClosest(Candidates,fixed_);
+    for (unsigned int i=0;i<Candidates.size();i++)
+      Candidates[i]->true_ctag_ = true;
+  }
+
+  virtual void Method3(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    std::vector<RecJetFormat*> tagged;
+    Preselect(mySample,myEvent,Candidates);
+    for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
+    {
+      if (fabs(myEvent.mc()->particles()[i].pdgid())!=4) continue;
+      if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+      OldMatch3(myEvent.mc()->particles()[i], Candidates, DeltaRmax_,
+                Exclusive_, tagged);
+    }
+    for (unsigned int i=0;i<tagged.size();i++) tagged[i]->true_ctag_ = true;
+  }
+};
+
+// tau-tagger with the nested loops
+class TaggerBenchmark::OldTauTagger : public TauTagger
+{
+ public:
+  bool fixed_;
+  OldTauTagger(bool fixed) { fixed_=fixed; }
+
+  // Jets with a tau in their history (unchanged)
+  void Preselect(EventFormat& myEvent, std::vector<RecJetFormat*>& Candidates)
+  {
+    const MCDecayGraph& graph = myEvent.mc()->decays();
+    for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
+    {
+      RecJetFormat& jet = myEvent.rec()->jets()[i];
+      if (jet.ntracks()!=1 && jet.ntracks()!=3) continue;
+      Bool_t tag = false;
+      for (unsigned int j=0;j<jet.constituents().size() && !tag;j++)
+      {
+        MCParticleFormat* particle = 
+          & myEvent.mc()->particles()[jet.constituents()[j]];
+        while (particle!=0 && particle->statuscode()!=3)
+        {
+          if (fabs(particle->pdgid())==15)
+          {
+            tag = true;
+            jet.setMc(particle);
+            break;
+          }
+          MCIndexSpan mothers = graph.parents(particle->index());
+          if (graph.HasSeveralParents(particle->index())) break;
+          particle = mothers.empty() ? 0 : 
+                     &myEvent.mc()->particles()[mothers[0]];
+        }
+      }
+      if (tag) Candidates.push_back(&jet);
+    }
+  }
+
+  // Converting the jets into taus, as the tagger does
+  void Convert(EventFormat& myEvent, std::vector<RecJetFormat*>& Taus)
+  {
+    sort(Taus.begin(),Taus.end());
+    for (unsigned int i=Taus.size();i>0;i--)
+    {
+      RecTauFormat* myTau = myEvent.rec()->GetNewTau();
+      Jet2Tau(Taus[i-1], myTau, myEvent);
+      std::vector<RecJetFormat>& jets = myEvent.rec()->jets();
+      jets.erase(jets.begin()+(Taus[i-1]-&jets[0]));
+    }
+  }
+
+  virtual void Method2(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    Preselect(myEvent,Candidates);
+    if (Exclusive_) OldKeepClosest(Candidates,fixed_);
+    Convert(myEvent,Candidates);
+  }
+
+  virtual void Method3(SampleFormat& mySample, EventFormat& myEvent)
+  {
+    std::vector<RecJetFormat*> Candidates;
+    std::vector<RecJetFormat*> Taus;
+    Preselect(myEvent,Candidates);
+    for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
+    {
+      if (fabs(myEvent.mc()->particles()[i].pdgid())!=15) continue;
+      if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+
+      Double_t DeltaRmax = DeltaRmax_; 
+      Bool_t tag = false;
+
+      for (unsigned int j=Candidates.size();j>0;j--)
+      {
+        Float_t DeltaR = myEvent.mc()->particles()[i].dr(Candidates[j-1]);
+
+        if (DeltaR <= DeltaRmax)
+        {
+          if (Exclusive_)
+          {
+            if (tag) Taus.pop_back();
+            tag = true;
+            DeltaRmax = DeltaR;
+          }
+          Taus.push_back(Candidates[j-1]);
+          Candidates.erase(Candidates.begin()+j-1);
+        }
+      }
+    }
+    Convert(myEvent,Taus);
+  }
+};
+
+
+// -----------------------------------------------------------------------------
+// ResetTags
+// -----------------------------------------------------------------------------
+void TaggerBenchmark::ResetTags(std::vector<RecJetFormat>& jets, UInt_t flavour)
+{
+  for (UInt_t i=0;i<jets.size();i++)
+  {
+    if (flavour==0)
+    { jets[i].btag_=false; jets[i].true_btag_=false; jets[i].true_ctag_=false; }
+    else if (flavour==1) jets[i].true_ctag_=false;
+    jets[i].mc_=0;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+void TaggerBenchmark::Run(UInt_t npasses)
+{
+  const UInt_t nevents = 200;
+  const UInt_t sizes[2][2] = { {4,12}, {8,30} };
+  ULong64_t seed = 12345;
+
+  INFO << "    Cost of the DeltaR matching of the taggers "
+       << "(ns per quark-jet pair):" << endmsg;
+  std::stringstream header;
+  header << std::setw(14) << std::left << "quarks x jets" << std::right
+         << std::setw(14) << "nested loops" << std::setw(14) << "matcher"
+         << std::setw(11) << "speed-up";
+  INFO << "    " << header.str() << endmsg;
+
+  for (UInt_t k=0;k<2;k++)
+  {
+    const UInt_t nquarks = sizes[k][0];
+    const UInt_t njets   = sizes[k][1];
+    std::vector< std::vector<MCParticleFormat> > quarks(nevents);
+    std::vector< std::vector<RecJetFormat> >     jets(nevents);
+    for (UInt_t e=0;e<nevents;e++)
+    {
+      quarks[e].resize(nquarks); Randomize(quarks[e],seed);
+      jets[e].resize(njets);     Randomize(jets[e],seed);
+    }
+
+    // Closest jet to each quark with the nested loops of the taggers
+    Long64_t sum1 = 0;
+    std::clock_t start = std::clock();
+    for (UInt_t p=0;p<npasses;p++)
+      for (UInt_t e=0;e<nevents;e++)
+        for (UInt_t i=0;i<nquarks;i++)
+        {
+          Int_t tag = -1;
+          Double_t DeltaRmax = 0.5;
+          for (UInt_t j=0;j<njets;j++)
+          {
+            Float_t DeltaR = quarks[e][i].dr(jets[e][j]);
+            if (DeltaR <= DeltaRmax) { tag=j; DeltaRmax=DeltaR; }
+          }
+          sum1 += tag;
+        }
+    std::clock_t middle = std::clock();
+
+    // Same with the matcher
+    Long64_t sum2 = 0;
+    DeltaRMatcher matcher;
+    for (UInt_t p=0;p<npasses;p++)
+      for (UInt_t e=0;e<nevents;e++)
+      {
+        matcher.Clear();
+        for (UInt_t j=0;j<njets;j++)   matcher.AddColumn(jets[e][j]);
+        for (UInt_t i=0;i<nquarks;i++) matcher.AddRow(quarks[e][i]);
+        matcher.Compute();
+        for (UInt_t i=0;i<nquarks;i++) sum2 += matcher.Closest(i,0.5);
+      }
+    std::clock_t stop = std::clock();
+
+    Double_t npairs = static_cast<Double_t>(npasses)*nevents*nquarks*njets;
+    Double_t loops  = 1e9*static_cast<Double_t>(middle-start)/CLOCKS_PER_SEC/npairs;
+    Double_t shared = 1e9*static_cast<Double_t>(stop-middle)/CLOCKS_PER_SEC/npairs;
+    std::stringstream size;
+    size << nquarks << " x " << njets;
+    std::stringstream str;
+    str << std::fixed << std::setprecision(2)
+        << std::setw(14) << std::left << size.str() << std::right
+        << std::setw(14) << loops << std::setw(14) << shared;
+    if (shared>0) str << std::setw(10) << loops/shared << "x";
+    INFO << "    " << str.str() << endmsg;
+    if (sum1!=sum2) 
+      ERROR << "the matcher and the nested loops do not match the same jets"
+            << endmsg;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Compare
+// -----------------------------------------------------------------------------
+bool TaggerBenchmark::Compare(ReaderBase* reader, JetClustererBase* clusterer,
+                              const std::string& filename)
+{
+  if (reader==0 || clusterer==0) return false;
+
+  // Taggers: b and c with the methods 1 to 3, tau with the methods 2 and 3
+  // (the method 1 of the tau-tagger does no matching)
+  std::vector<TaggerSet> sets;
+  for (UInt_t flavour=0;flavour<3;flavour++)
+    for (UInt_t method=(flavour==2?2:1);method<=3;method++)
+      for (UInt_t exclusive=0;exclusive<2;exclusive++)
+      {
+        TaggerSet set;
+        std::stringstream name;
+        name << (flavour==0 ? "b" : (flavour==1 ? "c" : "tau")) 
+             << "-tagger, method " << method << ", " 
+             << (exclusive ? "exclusive" : "inclusive");
+        set.name    = name.str();
+        set.flavour = flavour;
+        for (UInt_t k=0;k<3;k++)
+        {
+          if (flavour==0)
+            set.tagger[k] = (k==0) ? static_cast<TaggerBase*>(new bTagger) 
+                                   : new OldbTagger(k==2);
+          else if (flavour==1)
+            set.tagger[k] = (k==0) ? static_cast<TaggerBase*>(new cTagger) 
+                                   : new OldcTagger(k==2);
+          else
+            set.tagger[k] = (k==0) ? static_cast<TaggerBase*>(new TauTagger)
+                                   : new OldTauTagger(k==2);
+          std::stringstream m, x;
+          m << method; x << exclusive;
+          set.tagger[k]->SetParameter("method",m.str());
+          set.tagger[k]->SetParameter("exclusive",x.str());
+        }
+        sets.push_back(set);
+      }
+
+  // Number of events tagged differently by the nested loops, without and
+  // with the DeltaR update, on the jets and on the duplicated jets
+  std::vector< std::vector<UInt_t> > differences(sets.size(),
+                                                 std::vector<UInt_t>(4,0));
+
+  // Opening the file
+  Configuration cfg;
+  bool ok = reader->Initialize(filename,cfg);
+  SampleFormat mySample;
+  EventFormat  myEvent;
+  if (ok && !reader->ReadHeader(mySample))
+  {
+    ERROR << "No header has been found in the file " << filename << endmsg;
+    ok = false;
+  }
+  if (ok) reader->FinalizeHeader(mySample);
+
+  // Clustering the jets, then tagging them with each tagger
+  UInt_t nevents = 0;
+  while (ok)
+  {
+    StatusCode::Type test = reader->ReadEvent(myEvent,mySample);
+    if (test==StatusCode::FAILURE) break;
+    if (test!=StatusCode::KEEP) continue;
+    if (!reader->FinalizeEvent(mySample,myEvent)) continue;
+    myEvent.random().Initialize(cfg.GetRandomSeed(),0,nevents);
+    clusterer->Execute(mySample,myEvent);
+    nevents++;
+
+    std::vector<RecJetFormat> jets[2];
+    jets[0] = myEvent.rec()->jets();
+    jets[1] = jets[0];
+    jets[1].insert(jets[1].end(),jets[0].begin(),jets[0].end());
+    std::vector<RecTauFormat> taus = myEvent.rec()->taus();
+
+    for (UInt_t i=0;i<sets.size();i++)
+      for (UInt_t d=0;d<2;d++)
+      {
+        std::string tags[3];
+        for (UInt_t k=0;k<3;k++)
+        {
+          myEvent.rec()->jets() = jets[d];
+          myEvent.rec()->taus() = taus;
+          ResetTags(myEvent.rec()->jets(),sets[i].flavour);
+          sets[i].tagger[k]->Execute(mySample,myEvent);
+          tags[k] = Tags(myEvent);
+        }
+        if (tags[1]!=tags[0]) differences[i][2*d]++;
+        if (tags[2]!=tags[0]) differences[i][2*d+1]++;
+      }
+  }
+  reader->Finalize();
+
+  // Results
+  bool equivalent = true;
+  INFO << "    * " << filename << ": " << nevents << " events" << endmsg;
+  INFO << "      events tagged differently by the nested loops "
+       << "(with the DeltaR update in Method2):" << endmsg;
+  for (UInt_t i=0;i<sets.size();i++)
+  {
+    std::stringstream str;
+    str << std::setw(34) << std::left << sets[i].name << std::right
+        << std::setw(6) << differences[i][0] 
+        << " (" << differences[i][1] << ") ; duplicated jets: " 
+        << std::setw(6) << differences[i][2] 
+        << " (" << differences[i][3] << ")";
+    INFO << "      " << str.str() << endmsg;
+    if (differences[i][0]!=0 || differences[i][2]!=0) equivalent=false;
+    for (UInt_t k=0;k<3;k++) delete sets[i].tagger[k];
+  }
+  if (!equivalent)
+    ERROR << "the taggers and the nested loops do not tag the same jets"
+          << endmsg;
+  return ok && equivalent;
+}
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TAGGER_BENCHMARK_H
+#define TAGGER_BENCHMARK_H
+
+// STL headers
+#include <string>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+#include "SampleAnalyzer/DataFormat/RecJetFormat.h"
+#include "SampleAnalyzer/JetClustering/JetClustererBase.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Measuring the DeltaR matching of the taggers, and checking that the 
+/// b-, c- and tau-taggers built on DeltaRMatcher tag the jets exactly as 
+/// the nested loops over ParticleBaseFormat::dr they replaced. The loops 
+/// are also run with the reference DeltaR of the exclusive Method2 updated
+/// after a swap (the closest jet to each hadron is then kept even when 
+/// three jets or more share it), to count the events it would change.
+//////////////////////////////////////////////////////////////////////////////
+class TaggerBenchmark
+{
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Cost of the closest-jet matching of random quarks and jets, with the
+  /// nested loops and with DeltaRMatcher (ns per quark-jet pair)
+  static void Run(UInt_t npasses=200);
+
+  /// Tagging the jets of the events of the file clustered by the 
+  /// clusterer, with each method in inclusive and exclusive modes, by the 
+  /// taggers and by the nested loops (also on the jets followed by a copy 
+  /// of them, so that ties are met after the candidates were reordered by
+  /// the loops). False if a tagging differs from the one of the loops.
+  static bool Compare(ReaderBase* reader, JetClustererBase* clusterer,
+                      const std::string& filename);
+
+ private :
+
+  /// Taggers with the nested loops (defined in the source file)
+  class OldbTagger;
+  class OldcTagger;
+  class OldTauTagger;
+
+  /// Removing the results of a tagger (0: b, 1: c, 2: tau) from the jets
+  static void ResetTags(std::vector<RecJetFormat>& jets, UInt_t flavour);
+
+};
+
+}
+
+#endif
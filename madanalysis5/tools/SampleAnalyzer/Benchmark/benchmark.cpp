@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+// SampleHeader header
+#include "SampleAnalyzer/Core/SampleAnalyzer.h"
+#include "SampleAnalyzer/Benchmark/ReaderBenchmark.h"
+#include "SampleAnalyzer/Benchmark/MomentumBenchmark.h"
+#include "SampleAnalyzer/Benchmark/TaggerBenchmark.h"
+#include "SampleAnalyzer/Benchmark/ShardingCheck.h"
+#include "SampleAnalyzer/Benchmark/ExclusiveKtBenchmark.h"
+#include "SampleAnalyzer/Benchmark/AllocationHooks.h"
+using namespace MA5;
+
+// -----------------------------------------------------------------------
+// main program
+//
+// Benchmarks and consistency checks of SampleAnalyzer. They are not run
+// by the test program of the installation: this program is built in this
+// folder with 'make --file=Makefile_benchmark' and takes as arguments the
+// samples to read.
+// -----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  // Creating a manager
+  SampleAnalyzer manager;
+
+  // Cost of the kinematic accessors
+  MomentumBenchmark::Run();
+  INFO << endmsg;
+
+  // Cost of the DeltaR matching of the taggers
+  TaggerBenchmark::Run();
+  INFO << endmsg;
+
+  // Merging scales of the native exclusive kt clustering (DJR plots)
+  INFO << "Merging scales of ExclusiveKt compared with the references:" 
+       << endmsg;
+  ExclusiveKtBenchmark::Run();
+  INFO << endmsg;
+
+  // Throughput of the readers on the samples given as arguments
+  if (argc>1)
+  {
+    INFO << "Throughput of the readers:" << endmsg;
+    manager.ReaderList().BuildTable();
+    for (int i=1;i<argc;i++)
+    {
+      std::string filename = argv[i];
+      ReaderBenchmark::Run(manager.ReaderList().GetByFileExtension(filename),
+                           filename);
+    }
+    INFO << endmsg;
+
+    // Checks of the jet tagging (available with FastJet)
+    manager.JetClustererList().BuildTable();
+    JetClustererBase* clusterer = manager.JetClustererList().Get("antikt");
+    std::map<std::string,std::string> options;
+    options["bjet_id.efficiency"]="0.7";
+    options["bjet_id.misid_cjet"]="0.2";
+    options["bjet_id.misid_ljet"]="0.1";
+    options["tau_id.efficiency"] ="0.6";
+    options["tau_id.misid_ljet"] ="0.05";
+    if (clusterer!=0 && clusterer->Initialize(options))
+    {
+      INFO << "Taggers compared with the nested loops they replaced:" << endmsg;
+      for (int i=1;i<argc;i++)
+      {
+        std::string filename = argv[i];
+        TaggerBenchmark::Compare(
+                           manager.ReaderList().GetByFileExtension(filename),
+                           clusterer, filename);
+      }
+      INFO << endmsg;
+
+      INFO << "Tagging of the events read in shards:" << endmsg;
+      for (int i=1;i<argc;i++)
+      {
+        std::string filename = argv[i];
+        ShardingCheck::Run(manager.ReaderList().GetByFileExtension(filename),
+                           clusterer, filename);
+      }
+      clusterer->Finalize();
+      INFO << endmsg;
+    }
+  }
+
+  return 0;
+}
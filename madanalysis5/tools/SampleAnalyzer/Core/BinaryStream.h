@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BINARY_STREAM_H
+#define BINARY_STREAM_H
+
+// STL headers
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstring>
+
+// ROOT headers
+#include <Rtypes.h> 
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Static helpers for dumping and restoring plain data in a binary stream
+/// or in a memory buffer. The format is the native memory layout: the data
+/// can only be read back on a machine with the same architecture.
+//////////////////////////////////////////////////////////////////////////////
+class BinaryStream
+{
+ public :
+
+  /// Writing a plain value
+  template <typename T>
+  static void Write(std::ostream& output, const T& value)
+  { output.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+  /// Writing a pair of values
+  template <typename T1, typename T2>
+  static void Write(std::ostream& output, const std::pair<T1,T2>& value)
+  {
+    Write(output, value.first);
+    Write(output, value.second);
+  }
+
+  /// Writing a string (size followed by the characters)
+  static void Write(std::ostream& output, const std::string& value)
+  {
+    UInt_t size = value.size();
+    Write(output, size);
+    output.write(value.data(), size);
+  }
+
+  /// Reading a plain value
+  template <typename T>
+  static bool Read(std::istream& input, T& value)
+  {
+    input.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return input.good();
+  }
+
+  /// Reading a pair of values
+  template <typename T1, typename T2>
+  static bool Read(std::istream& input, std::pair<T1,T2>& value)
+  { return Read(input, value.first) && Read(input, value.second); }
+
+  /// Reading a string
+  static bool Read(std::istream& input, std::string& value)
+  {
+    UInt_t size = 0;
+    if (!Read(input, size)) return false;
+    value.resize(size);
+    if (size!=0) input.read(&value[0], size);
+    return input.good();
+  }
+
+  /// Appending a plain value to a buffer
+  template <typename T>
+  static void Write(std::vector<char>& output, const T& value)
+  {
+    const char* data = reinterpret_cast<const char*>(&value);
+    output.insert(output.end(), data, data+sizeof(T));
+  }
+
+  /// Appending a pair of values to a buffer
+  template <typename T1, typename T2>
+  static void Write(std::vector<char>& output, const std::pair<T1,T2>& value)
+  {
+    Write(output, value.first);
+    Write(output, value.second);
+  }
+
+  /// Appending a string to a buffer
+  static void Write(std::vector<char>& output, const std::string& value)
+  {
+    UInt_t size = value.size();
+    Write(output, size);
+    output.insert(output.end(), value.begin(), value.end());
+  }
+
+  /// Extracting a plain value from a buffer (the cursor is moved forward)
+  template <typename T>
+  static bool Read(const char*& input, const char* end, T& value)
+  {
+    if (input+sizeof(T)>end) return false;
+    std::memcpy(&value, input, sizeof(T));
+    input+=sizeof(T);
+    return true;
+  }
+
+  /// Extracting a pair of values from a buffer
+  template <typename T1, typename T2>
+  static bool Read(const char*& input, const char* end, 
+                   std::pair<T1,T2>& value)
+  { return Read(input, end, value.first) && Read(input, end, value.second); }
+
+  /// Extracting a string from a buffer
+  static bool Read(const char*& input, const char* end, std::string& value)
+  {
+    UInt_t size = 0;
+    if (!Read(input, end, size)) return false;
+    if (input+size>end) return false;
+    value.assign(input, size);
+    input+=size;
+    return true;
+  }
+
+};
+
+}
+
+#endif
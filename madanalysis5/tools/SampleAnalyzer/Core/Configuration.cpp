@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <fstream>
 #include <locale>
+#include <sstream>
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/Core/Configuration.h"
@@ -57,6 +58,26 @@ void Configuration::PrintSyntax()
        << endmsg;
   INFO << "   --no_event_weight  : the event weights are not used"
        << endmsg;
+  INFO << "   --threads=N        : analyze the events with N threads"
+       << endmsg;
+  INFO << "   --jobs=N           : share the input files between N processes"
+       << endmsg;
+  INFO << "   --no_prefetch      : read the events in the analysis thread"
+       << endmsg;
+  INFO << "   --first_event=K    : start at the event K (random-access files)"
+       << endmsg;
+  INFO << "   --event_stride=N   : read one event every N (random-access files)"
+       << endmsg;
+  INFO << "   --shard=i/N        : analyze the part i (0<=i<N) of each file"
+       << endmsg;
+  INFO << "   --merge_shards     : <filelist> contains the results of shards"
+       << endmsg;
+  INFO << "   --particle_arrays  : fill the arrays of particle properties when"
+       << " reading" << endmsg;
+  INFO << "   --no_global_sums   : do not compute MET, MHT, TET, THT of the"
+       << " generated particles" << endmsg;
+  INFO << "   --random_seed=S    : seed of the random numbers (efficiencies)"
+       << endmsg;
   INFO << endmsg;
 }
 
@@ -105,6 +126,119 @@ bool Configuration::Initialize(int &argc, char *argv[], const bool &useRSM)
     // weighted event
     else if (option=="--no_event_weight") no_event_weight_ = true;
 
+    // reading in the analysis thread
+    else if (option=="--no_prefetch") no_prefetch_ = true;
+
+    // number of threads
+    else if (option.find("--threads=")==0)
+    {
+      std::stringstream str;
+      str << option.substr(10,std::string::npos);
+      Int_t nthreads=0;
+      str >> nthreads;
+      if (nthreads<1)
+      {
+        ERROR << "number of threads '" << option.substr(10,std::string::npos)
+              << "' is not valid." << endmsg;
+        return false;
+      }
+      nthreads_ = static_cast<UInt_t>(nthreads);
+    }
+
+    // number of processes
+    else if (option.find("--jobs=")==0)
+    {
+      std::stringstream str;
+      str << option.substr(7,std::string::npos);
+      Int_t njobs=0;
+      str >> njobs;
+      if (njobs<1)
+      {
+        ERROR << "number of jobs '" << option.substr(7,std::string::npos)
+              << "' is not valid." << endmsg;
+        return false;
+      }
+      njobs_ = static_cast<UInt_t>(njobs);
+    }
+
+    // first event
+    else if (option.find("--first_event=")==0)
+    {
+      std::stringstream str;
+      str << option.substr(14,std::string::npos);
+      Long64_t first=-1;
+      str >> first;
+      if (first<0)
+      {
+        ERROR << "first event '" << option.substr(14,std::string::npos)
+              << "' is not valid." << endmsg;
+        return false;
+      }
+      first_event_ = static_cast<ULong64_t>(first);
+    }
+
+    // seed of the random streams
+    else if (option.find("--random_seed=")==0)
+    {
+      std::stringstream str;
+      str << option.substr(14,std::string::npos);
+      Long64_t seed=-1;
+      str >> seed;
+      if (seed<0)
+      {
+        ERROR << "random seed '" << option.substr(14,std::string::npos)
+              << "' is not valid." << endmsg;
+        return false;
+      }
+      random_seed_ = static_cast<ULong64_t>(seed);
+    }
+
+    // stride between events
+    else if (option.find("--event_stride=")==0)
+    {
+      std::stringstream str;
+      str << option.substr(15,std::string::npos);
+      Long64_t stride=0;
+      str >> stride;
+      if (stride<1)
+      {
+        ERROR << "event stride '" << option.substr(15,std::string::npos)
+              << "' is not valid." << endmsg;
+        return false;
+      }
+      event_stride_ = static_cast<ULong64_t>(stride);
+    }
+
+    // part of the files to analyze
+    else if (option.find("--shard=")==0)
+    {
+      std::string value = option.substr(8,std::string::npos);
+      std::string::size_type slash = value.find('/');
+      Int_t index=-1, nshards=0;
+      if (slash!=std::string::npos)
+      {
+        std::stringstream str;
+        str << value.substr(0,slash) << " " << value.substr(slash+1);
+        str >> index >> nshards;
+      }
+      if (nshards<1 || index<0 || index>=nshards)
+      {
+        ERROR << "shard '" << value << "' is not valid." << endmsg;
+        return false;
+      }
+      shard_index_ = static_cast<UInt_t>(index);
+      nshards_     = static_cast<UInt_t>(nshards);
+    }
+
+    // merging the results of shards
+    else if (option=="--merge_shards") merge_shards_ = true;
+
+    // filling the structure-of-arrays copy of the particles
+    else if (option=="--particle_arrays") particle_arrays_ = true;
+
+    // skipping the MET, MHT, TET, THT of the generated particles
+    else if (option=="--no_global_sums") no_global_sums_ = true;
+
     // version
     else if (option.find("--ma5_version=")==0)
     {
@@ -130,6 +264,21 @@ bool Configuration::Initialize(int &argc, char *argv[], const bool &useRSM)
     }
   }
 
+  // The two parallel modes cannot be combined
+  if (nthreads_>1 && njobs_>1)
+  {
+    ERROR << "the options --threads and --jobs cannot be used together." 
+          << endmsg;
+    return false;
+  }
+
+  if (nshards_>1 && merge_shards_)
+  {
+    ERROR << "the options --shard and --merge_shards cannot be used together."
+          << endmsg;
+    return false;
+  }
+
   // Extracting the input list
   input_list_name_ = std::string(argv[static_cast<unsigned int>(argc-1)]);
 
@@ -153,7 +302,9 @@ void Configuration::Display()
   INFO << "      - general: ";
 
   // Is there option ?
-  if (!check_event_ && !no_event_weight_)
+  if (!check_event_ && !no_event_weight_ && nthreads_==1 && njobs_==1 &&
+      !no_prefetch_ && !IsEventSelection() && nshards_==1 && !merge_shards_ &&
+      !particle_arrays_ && !no_global_sums_)
   {
     INFO << "everything is default." << endmsg;
     return;
@@ -168,4 +319,31 @@ void Configuration::Display()
     INFO << "     -> checking the event file format." << endmsg;
   if (no_event_weight_) 
     INFO << "     -> event weights are not used." << endmsg;
+  if (nthreads_>1)
+    INFO << "     -> events are analyzed with " << nthreads_ 
+         << " threads." << endmsg;
+  if (njobs_>1)
+    INFO << "     -> input files are shared between " << njobs_ 
+         << " processes." << endmsg;
+  if (no_prefetch_)
+    INFO << "     -> events are not read in a separate thread." << endmsg;
+  if (first_event_!=0)
+    INFO << "     -> reading starts at the event " << first_event_ << "." 
+         << endmsg;
+  if (event_stride_!=1)
+    INFO << "     -> one event every " << event_stride_ << " is read." 
+         << endmsg;
+  if (nshards_>1)
+    INFO << "     -> only the shard " << shard_index_ << "/" << nshards_
+         << " of each file is analyzed." << endmsg;
+  if (merge_shards_)
+    INFO << "     -> the results of shards are merged." << endmsg;
+  if (particle_arrays_)
+    INFO << "     -> the particle arrays are filled by the reader." << endmsg;
+  if (no_global_sums_)
+    INFO << "     -> MET, MHT, TET and THT of the generated particles are not"
+         << " computed." << endmsg;
+  if (random_seed_!=0)
+    INFO << "     -> the random numbers are generated with the seed " 
+         << random_seed_ << "." << endmsg;
 }
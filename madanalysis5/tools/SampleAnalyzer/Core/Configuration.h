@@ -63,6 +63,39 @@ class Configuration
 
     /// Use the RegionSelectionManager structure and its output
     bool useRSM_;
+
+    /// option : number of threads used for the event loop
+    UInt_t nthreads_;
+
+    /// option : number of processes sharing the list of input files
+    UInt_t njobs_;
+
+    /// option : veto to the reading of the events in a separate thread
+    Bool_t no_prefetch_;
+
+    /// option : index of the first event to read (random-access files)
+    ULong64_t first_event_;
+
+    /// option : reading one event every N (random-access files)
+    ULong64_t event_stride_;
+
+    /// option : analyzing only the part index/N of each file
+    UInt_t shard_index_;
+    UInt_t nshards_;
+
+    /// option : the input list contains results of shards to merge
+    Bool_t merge_shards_;
+
+    /// option : the readers fill the structure-of-arrays copy of the 
+    /// generated particles
+    Bool_t particle_arrays_;
+
+    /// option : MET, MHT, TET and THT of the generated particles are not 
+    /// computed
+    Bool_t no_global_sums_;
+
+    /// option : seed of the random streams of the events
+    ULong64_t random_seed_;
   
 
   // -------------------------------------------------------------
@@ -136,6 +169,17 @@ class Configuration
       no_event_weight_ = false;
       check_event_     = false;
       input_list_name_ = "";
+      nthreads_        = 1;
+      njobs_           = 1;
+      no_prefetch_     = false;
+      first_event_     = 0;
+      event_stride_    = 1;
+      shard_index_     = 0;
+      nshards_         = 1;
+      merge_shards_    = false;
+      particle_arrays_ = false;
+      no_global_sums_  = false;
+      random_seed_     = 0;
     }
  
     /// Accessor to Input Name
@@ -150,6 +194,54 @@ class Configuration
     Bool_t IsCheckEvent() const
     { return check_event_; }
 
+    /// Accessor to the number of threads
+    UInt_t GetNumberOfThreads() const
+    { return nthreads_; }
+
+    /// Accessor to the number of processes
+    UInt_t GetNumberOfJobs() const
+    { return njobs_; }
+
+    /// Accessor to NoPrefetch
+    Bool_t IsNoPrefetch() const
+    { return no_prefetch_; }
+
+    /// Accessor to the first event to read
+    ULong64_t GetFirstEvent() const
+    { return first_event_; }
+
+    /// Accessor to the stride between two read events
+    ULong64_t GetEventStride() const
+    { return event_stride_; }
+
+    /// Is a subset of the events selected ?
+    Bool_t IsEventSelection() const
+    { return first_event_!=0 || event_stride_!=1; }
+
+    /// Accessor to the index of the shard
+    UInt_t GetShardIndex() const
+    { return shard_index_; }
+
+    /// Accessor to the number of shards
+    UInt_t GetNumberOfShards() const
+    { return nshards_; }
+
+    /// Accessor to MergeShards
+    Bool_t IsMergeShards() const
+    { return merge_shards_; }
+
+    /// Accessor to ParticleArrays
+    Bool_t IsParticleArrays() const
+    { return particle_arrays_; }
+
+    /// Accessor to NoGlobalSums
+    Bool_t IsNoGlobalSums() const
+    { return no_global_sums_; }
+
+    /// Accessor to the seed of the random streams
+    ULong64_t GetRandomSeed() const
+    { return random_seed_; }
+
 };
 
 }
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Core/EventPrefetcher.h"
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+EventPrefetcher::EventPrefetcher(UInt_t nslots)
+{
+  if (nslots<2) nslots=2;
+  slots_.resize(nslots);
+  write_=0; read_=0; nfilled_=0;
+  reader_=0; sample_=0;
+  position_=0; key_=-1;
+  started_=false; stop_=false;
+  pthread_mutex_init(&mutex_,0);
+  pthread_cond_init(&not_empty_,0);
+  pthread_cond_init(&not_full_,0);
+}
+
+
+// -----------------------------------------------------------------------------
+// Destructor
+// -----------------------------------------------------------------------------
+EventPrefetcher::~EventPrefetcher()
+{
+  Stop();
+  for (unsigned int i=0;i<slots_.size();i++) slots_[i].event.Delete();
+  pthread_cond_destroy(&not_full_);
+  pthread_cond_destroy(&not_empty_);
+  pthread_mutex_destroy(&mutex_);
+}
+
+
+// -----------------------------------------------------------------------------
+// Start
+// -----------------------------------------------------------------------------
+bool EventPrefetcher::Start(ReaderBase* reader, SampleFormat& mySample)
+{
+  Stop();
+  reader_   = reader;
+  sample_   = &mySample;
+  position_ = 0;
+  key_      = -1;
+  write_=0; read_=0; nfilled_=0;
+  stop_=false;
+  if (pthread_create(&thread_,0,EventPrefetcher::Run,this)!=0)
+  {
+    WARNING << "impossible to create the thread reading the events: "
+            << "they are read in the analysis thread." << endmsg;
+    return false;
+  }
+  started_=true;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Stop
+// -----------------------------------------------------------------------------
+void EventPrefetcher::Stop()
+{
+  if (!started_) return;
+  pthread_mutex_lock(&mutex_);
+  stop_=true;
+  pthread_cond_broadcast(&not_full_);
+  pthread_mutex_unlock(&mutex_);
+  pthread_join(thread_,0);
+  started_=false;
+}
+
+
+// -----------------------------------------------------------------------------
+// Next
+// -----------------------------------------------------------------------------
+StatusCode::Type EventPrefetcher::Next(EventFormat& myEvent, bool& finalized)
+{
+  // Waiting for the next event
+  pthread_mutex_lock(&mutex_);
+  while (nfilled_==0) pthread_cond_wait(&not_empty_,&mutex_);
+  EventSlot& slot = slots_[read_];
+  pthread_mutex_unlock(&mutex_);
+
+  // Taking the event: the slot receives the previous buffers of myEvent
+  StatusCode::Type status = slot.status;
+  finalized = slot.finalized;
+  position_ = slot.position;
+  key_      = slot.key;
+  if (status!=StatusCode::FAILURE) myEvent.Swap(slot.event);
+
+  // Releasing the slot
+  pthread_mutex_lock(&mutex_);
+  read_ = (read_+1) % slots_.size();
+  nfilled_--;
+  pthread_cond_signal(&not_full_);
+  pthread_mutex_unlock(&mutex_);
+  return status;
+}
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+void* EventPrefetcher::Run(void* prefetcher)
+{
+  static_cast<EventPrefetcher*>(prefetcher)->Execute();
+  return 0;
+}
+
+
+// -----------------------------------------------------------------------------
+// Execute
+// -----------------------------------------------------------------------------
+void EventPrefetcher::Execute()
+{
+  while(1)
+  {
+    // Waiting for a free slot
+    pthread_mutex_lock(&mutex_);
+    while (nfilled_==slots_.size() && !stop_) 
+      pthread_cond_wait(&not_full_,&mutex_);
+    if (stop_)
+    {
+      pthread_mutex_unlock(&mutex_);
+      return;
+    }
+    EventSlot& slot = slots_[write_];
+    pthread_mutex_unlock(&mutex_);
+
+    // Reading and finalizing the event
+    slot.status    = reader_->ReadEvent(slot.event, *sample_);
+    slot.key       = reader_->GetEventKey();
+    slot.finalized = false;
+    if (slot.status==StatusCode::KEEP) 
+      slot.finalized = reader_->FinalizeEvent(*sample_, slot.event);
+    slot.position  = reader_->GetPosition();
+
+    // Handing the slot to the consumer
+    pthread_mutex_lock(&mutex_);
+    write_ = (write_+1) % slots_.size();
+    nfilled_++;
+    pthread_cond_signal(&not_empty_);
+    pthread_mutex_unlock(&mutex_);
+
+    // End of file
+    if (slot.status==StatusCode::FAILURE) return;
+  }
+}
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EVENT_PREFETCHER_H
+#define EVENT_PREFETCHER_H
+
+// STL headers
+#include <vector>
+
+// POSIX headers
+#include <pthread.h>
+
+// ROOT headers
+#include <Rtypes.h> 
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Core/StatusCode.h"
+#include "SampleAnalyzer/DataFormat/EventFormat.h"
+#include "SampleAnalyzer/DataFormat/SampleFormat.h"
+
+
+namespace MA5
+{
+
+class ReaderBase;
+
+class EventPrefetcher
+{
+
+  // -------------------------------------------------------------
+  //                        slot of the ring
+  // -------------------------------------------------------------
+ private :
+
+  struct EventSlot
+  {
+    /// Event read in advance
+    EventFormat event;
+
+    /// Status returned by ReaderBase::ReadEvent
+    StatusCode::Type status;
+
+    /// Result of ReaderBase::FinalizeEvent
+    bool finalized;
+
+    /// Position in the file after the reading of the event
+    Long64_t position;
+
+    /// Key of the event given by ReaderBase::GetEventKey
+    Long64_t key;
+  };
+
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Ring of recycled events
+  std::vector<EventSlot> slots_;
+
+  /// Next slot to fill, next slot to consume, number of filled slots
+  UInt_t write_;
+  UInt_t read_;
+  UInt_t nfilled_;
+
+  /// Reader and sample used by the reading thread
+  ReaderBase*   reader_;
+  SampleFormat* sample_;
+
+  /// Position in the file and key of the last consumed event
+  Long64_t position_;
+  Long64_t key_;
+
+  /// Reading thread
+  pthread_t thread_;
+  bool started_;
+  bool stop_;
+
+  /// Synchronization between the reading thread and the consumer
+  pthread_mutex_t mutex_;
+  pthread_cond_t  not_empty_;
+  pthread_cond_t  not_full_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor with the number of events read in advance
+  EventPrefetcher(UInt_t nslots=16);
+
+  /// Destructor
+  ~EventPrefetcher();
+
+  /// Launching the reading thread for the current file
+  bool Start(ReaderBase* reader, SampleFormat& mySample);
+
+  /// Stopping the reading thread (before closing the file)
+  void Stop();
+
+  /// Is the reading thread running ?
+  bool IsRunning() const
+  { return started_; }
+
+  /// Taking the next event in the reading order 
+  /// (its content is exchanged with the one of myEvent)
+  StatusCode::Type Next(EventFormat& myEvent, bool& finalized);
+
+  /// Position in the file of the last consumed event
+  Long64_t GetPosition() const
+  { return position_; }
+
+  /// Key of the last consumed event (see ReaderBase::GetEventKey)
+  Long64_t GetEventKey() const
+  { return key_; }
+
+ private :
+
+  /// Entry point of the reading thread
+  static void* Run(void* prefetcher);
+
+  /// Loop of the reading thread
+  void Execute();
+
+};
+
+}
+
+#endif
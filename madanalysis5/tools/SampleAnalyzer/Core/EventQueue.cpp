@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Core/EventQueue.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+EventQueue::EventQueue()
+{
+  closed_=false;
+  pthread_mutex_init(&mutex_,0);
+  pthread_cond_init(&cond_,0);
+}
+
+
+// -----------------------------------------------------------------------------
+// Destructor
+// -----------------------------------------------------------------------------
+EventQueue::~EventQueue()
+{
+  pthread_cond_destroy(&cond_);
+  pthread_mutex_destroy(&mutex_);
+}
+
+
+// -----------------------------------------------------------------------------
+// Push
+// -----------------------------------------------------------------------------
+void EventQueue::Push(EventFormat* myEvent, SampleFormat* mySample)
+{
+  pthread_mutex_lock(&mutex_);
+  items_.push_back(std::make_pair(myEvent,mySample));
+  pthread_cond_broadcast(&cond_);
+  pthread_mutex_unlock(&mutex_);
+}
+
+
+// -----------------------------------------------------------------------------
+// Pop
+// -----------------------------------------------------------------------------
+bool EventQueue::Pop(EventFormat*& myEvent, SampleFormat*& mySample)
+{
+  pthread_mutex_lock(&mutex_);
+  while (items_.empty() && !closed_) pthread_cond_wait(&cond_,&mutex_);
+
+  // Closed and empty queue
+  if (items_.empty())
+  {
+    pthread_mutex_unlock(&mutex_);
+    return false;
+  }
+
+  // Taking the first event
+  myEvent  = items_.front().first;
+  mySample = items_.front().second;
+  items_.pop_front();
+  pthread_cond_broadcast(&cond_);
+  pthread_mutex_unlock(&mutex_);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WaitForSize
+// -----------------------------------------------------------------------------
+void EventQueue::WaitForSize(UInt_t n)
+{
+  pthread_mutex_lock(&mutex_);
+  while (items_.size()!=n) pthread_cond_wait(&cond_,&mutex_);
+  pthread_mutex_unlock(&mutex_);
+}
+
+
+// -----------------------------------------------------------------------------
+// Close
+// -----------------------------------------------------------------------------
+void EventQueue::Close()
+{
+  pthread_mutex_lock(&mutex_);
+  closed_=true;
+  pthread_cond_broadcast(&cond_);
+  pthread_mutex_unlock(&mutex_);
+}
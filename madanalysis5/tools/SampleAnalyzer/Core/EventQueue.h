@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+// STL headers
+#include <deque>
+#include <utility>
+
+// POSIX headers
+#include <pthread.h>
+
+// ROOT headers
+#include <Rtypes.h> 
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/EventFormat.h"
+#include "SampleAnalyzer/DataFormat/SampleFormat.h"
+
+
+namespace MA5
+{
+
+class EventQueue
+{
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Queued events with the sample they belong to (first in, first out)
+  std::deque< std::pair<EventFormat*,SampleFormat*> > items_;
+
+  /// No more event will be pushed
+  bool closed_;
+
+  /// Synchronization between the reading thread and the workers
+  pthread_mutex_t mutex_;
+  pthread_cond_t  cond_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  EventQueue();
+
+  /// Destructor
+  ~EventQueue();
+
+  /// Adding an event at the end of the queue
+  void Push(EventFormat* myEvent, SampleFormat* mySample);
+
+  /// Taking the first event of the queue (waiting if the queue is empty)
+  /// Returns false when the queue is closed and empty
+  bool Pop(EventFormat*& myEvent, SampleFormat*& mySample);
+
+  /// Waiting until the queue contains n events
+  void WaitForSize(UInt_t n);
+
+  /// Closing the queue: waiting threads are released
+  void Close();
+
+};
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Core/EventWorker.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Start
+// -----------------------------------------------------------------------------
+bool EventWorker::Start()
+{
+  if (pthread_create(&thread_,0,EventWorker::Run,this)!=0)
+  {
+    ERROR << "impossible to create a new thread" << endmsg;
+    return false;
+  }
+  started_=true;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Join
+// -----------------------------------------------------------------------------
+void EventWorker::Join()
+{
+  if (!started_) return;
+  pthread_join(thread_,0);
+  started_=false;
+}
+
+
+// -----------------------------------------------------------------------------
+// Run
+// -----------------------------------------------------------------------------
+void* EventWorker::Run(void* worker)
+{
+  static_cast<EventWorker*>(worker)->Execute();
+  return 0;
+}
+
+
+// -----------------------------------------------------------------------------
+// Execute
+// -----------------------------------------------------------------------------
+void EventWorker::Execute()
+{
+  EventFormat*  myEvent  = 0;
+  SampleFormat* mySample = 0;
+
+  while (input_->Pop(myEvent,mySample))
+  {
+    // Same sequence as the serial event loop
+    for (unsigned int i=0;i<clusters_.size();i++)
+      clusters_[i]->Execute(*mySample,*myEvent);
+    for (unsigned int i=0;i<analyzers_.size();i++)
+      analyzers_[i]->Execute(*mySample,*myEvent);
+
+    // Giving the event slot back to the reading thread
+    output_->Push(myEvent,0);
+  }
+}
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EVENT_WORKER_H
+#define EVENT_WORKER_H
+
+// STL headers
+#include <vector>
+
+// POSIX headers
+#include <pthread.h>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Core/EventQueue.h"
+#include "SampleAnalyzer/Analyzer/AnalyzerBase.h"
+#include "SampleAnalyzer/JetClustering/JetClustererBase.h"
+
+
+namespace MA5
+{
+
+class EventWorker
+{
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Thread running the worker
+  pthread_t thread_;
+  bool started_;
+
+  /// Jet clusterers and analyzers owned by this worker
+  std::vector<JetClustererBase*> clusters_;
+  std::vector<AnalyzerBase*>     analyzers_;
+
+  /// Events to analyze
+  EventQueue* input_;
+
+  /// Analyzed events (given back to the reading thread)
+  EventQueue* output_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor
+  EventWorker(EventQueue* input, EventQueue* output)
+  { input_=input; output_=output; started_=false; }
+
+  /// Destructor
+  ~EventWorker()
+  { }
+
+  /// Adding a jet clusterer (executed before the analyzers)
+  void AddJetClusterer(JetClustererBase* myClusterer)
+  { clusters_.push_back(myClusterer); }
+
+  /// Adding an analyzer
+  void AddAnalyzer(AnalyzerBase* myAnalyzer)
+  { analyzers_.push_back(myAnalyzer); }
+
+  /// Accessors to the clusterers and analyzers
+  const std::vector<JetClustererBase*>& JetClusterers() const
+  { return clusters_; }
+  const std::vector<AnalyzerBase*>& Analyzers() const
+  { return analyzers_; }
+
+  /// Launching the thread
+  bool Start();
+
+  /// Waiting for the end of the thread
+  void Join();
+
+  /// Event loop: analyzing events until the input queue is closed
+  void Execute();
+
+ private :
+
+  /// Thread entry point
+  static void* Run(void* worker);
+
+};
+
+}
+
+#endif
@@ -23,6 +23,14 @@
 
 //STL headers
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
 #include <string>
 
 // SampleAnalyzer headers
@@ -35,6 +43,10 @@
 #include "SampleAnalyzer/Service/CompilationService.h"
 #include "SampleAnalyzer/Core/ProgressBar.h"
 #include "SampleAnalyzer/Core/Configuration.h"
+#include "SampleAnalyzer/Core/EventQueue.h"
+#include "SampleAnalyzer/Core/EventWorker.h"
+#include "SampleAnalyzer/Core/EventPrefetcher.h"
+#include "SampleAnalyzer/Core/BinaryStream.h"
 
 
 using namespace MA5;
@@ -51,7 +63,14 @@ SampleAnalyzer::SampleAnalyzer()
 
   // Initializing pointer to 0
   progressBar_=0;
+  prefetcher_=0;
   LastFileFail_=false;
+  queued_events_=0;
+  free_events_=0;
+  job_queue_=0;
+  child_process_=false;
+  event_first_=0;
+  event_stride_=1;
 
   // Header
   INFO << "    * SampleAnalyzer for MadAnalysis 5 - Welcome.";
@@ -72,8 +91,19 @@ bool SampleAnalyzer::Initialize(int argc, char **argv,
   // Displaying configuration
   cfg_.Display();
   
-  // Treating PDG MA5 : to do
-  if (pdgFileName=="") {}
+  // Particle table: the table embedded in the library is overridden by 
+  // the file pdgFileName if it exists
+  if (pdgFileName!="")
+  {
+    std::ifstream pdgfile(pdgFileName.c_str());
+    if (pdgfile.good())
+    {
+      pdgfile.close();
+      INFO << "      - reading the particle table '" << pdgFileName 
+           << "'..." << endmsg;
+      if (!PDG->LoadTable(pdgFileName)) return false;
+    }
+  }
 
   // Getting the list of input files
   std::string filename = cfg_.GetInputListName();
@@ -159,6 +189,7 @@ AnalyzerBase* SampleAnalyzer::InitializeAnalyzer(const std::string& name,
 
   // Putting the analysis in container
   analyzers_.push_back(myAnalysis);
+  analyzers_parameters_.push_back(parameters);
 
   // Initialize (common part to all analyses)
   if (!myAnalysis->PreInitialize(outputname,
@@ -238,11 +269,708 @@ bool SampleAnalyzer::PostInitialize()
     }
   }
 
+  // Merging the results of shards: no event is read
+  if (cfg_.IsMergeShards()) return true;
+
+  // Sharding: the shards would write the same output files
+  if (cfg_.GetNumberOfShards()>1 && !writers_.empty())
+  {
+    ERROR << "the option --shard cannot be used with writers" << endmsg;
+    return false;
+  }
+
+  // Multi-threaded mode
+  if (cfg_.GetNumberOfThreads()>1)
+  {
+    if (!InitializeThreads()) return false;
+  }
+
+  // Multi-process mode
+  if (cfg_.GetNumberOfJobs()>1)
+  {
+    if (!InitializeJobs()) return false;
+  }
+
   // Everything was fine
   return true;
 }
 
 
+/// Creating the replicas of analyzers and clusterers for each thread
+bool SampleAnalyzer::InitializeThreads()
+{
+  UInt_t nthreads = cfg_.GetNumberOfThreads();
+
+  // Writers and detectors must see the events in the reading order
+  if (!writers_.empty() || !detectors_.empty())
+  {
+    WARNING << "the multi-threaded mode is not available with writers "
+            << "or detector simulations: the events are analyzed "
+            << "with a single thread." << endmsg;
+    return true;
+  }
+
+  // Checking that all the components can be replicated
+  for (unsigned int i=0;i<analyzers_.size();i++)
+  {
+    AnalyzerBase* test = analyzers_[i]->Clone();
+    if (test==0)
+    {
+      WARNING << "the analyzer '" << analyzers_[i]->name() << "' cannot be "
+              << "replicated: the events are analyzed with a single thread."
+              << endmsg;
+      return true;
+    }
+    delete test;
+  }
+  for (unsigned int i=0;i<clusters_.size();i++)
+  {
+    JetClustererBase* test = clusters_[i]->Clone();
+    if (test==0)
+    {
+      WARNING << "the jet clusterer '" << clusters_[i]->GetName() << "' cannot be "
+              << "replicated: the events are analyzed with a single thread."
+              << endmsg;
+      return true;
+    }
+    delete test;
+  }
+
+  INFO << "      - creating " << nthreads << " threads for the event loop" << endmsg;
+
+  // Queues of event slots
+  queued_events_ = new EventQueue();
+  free_events_   = new EventQueue();
+  for (unsigned int i=0;i<2*nthreads;i++)
+  {
+    event_slots_.push_back(new EventFormat());
+    free_events_->Push(event_slots_.back(),0);
+  }
+
+  // The first worker uses the original analyzers and clusterers
+  workers_.push_back(new EventWorker(queued_events_,free_events_));
+  for (unsigned int i=0;i<clusters_.size();i++)
+    workers_.back()->AddJetClusterer(clusters_[i]);
+  for (unsigned int i=0;i<analyzers_.size();i++)
+    workers_.back()->AddAnalyzer(analyzers_[i]);
+
+  // The other workers use replicas initialized with the same parameters
+  for (unsigned int n=1;n<nthreads;n++)
+  {
+    workers_.push_back(new EventWorker(queued_events_,free_events_));
+    for (unsigned int i=0;i<clusters_.size();i++)
+    {
+      JetClustererBase* myClusterer = clusters_[i]->Clone();
+      workers_.back()->AddJetClusterer(myClusterer);
+      if (!myClusterer->Initialize(clusters_parameters_[i]))
+      {
+        ERROR << "problem during the initialization of a replica of the "
+              << "jet clusterer called '" << clusters_[i]->GetName() << "'" 
+              << endmsg;
+        return false;
+      }
+      myClusterer->DisableThreads();
+    }
+    for (unsigned int i=0;i<analyzers_.size();i++)
+    {
+      AnalyzerBase* myAnalysis = CreateReplica(i);
+      if (myAnalysis==0) return false;
+      workers_.back()->AddAnalyzer(myAnalysis);
+    }
+  }
+
+  return true;
+}
+
+
+/// Creating a replica of an analyzer, initialized as the original one
+AnalyzerBase* SampleAnalyzer::CreateReplica(unsigned int index)
+{
+  AnalyzerBase* myAnalysis = analyzers_[index]->Clone();
+  if (myAnalysis==0) return 0;
+  myAnalysis->weighted_events_ = analyzers_[index]->weighted_events_;
+  myAnalysis->SetOutputDir(analyzers_[index]->Output());
+  myAnalysis->out().InitializeBuffer();
+  if (!myAnalysis->Initialize(cfg_,analyzers_parameters_[index]))
+  {
+    ERROR << "problem during the initialization of a replica of the "
+          << "analysis called '" << analyzers_[index]->name() << "'" << endmsg;
+    delete myAnalysis;
+    return 0;
+  }
+  return myAnalysis;
+}
+
+
+/// Finalizing (without output) and deleting a replica of an analyzer
+void SampleAnalyzer::DeleteReplica(AnalyzerBase* replica, 
+                                   const std::vector<SampleFormat>& mySamples)
+{
+  // The replica writes into a buffer which is thrown away: only the 
+  // resources allocated by the analysis are freed
+  SampleFormat summary;
+  replica->Finalize(summary,mySamples);
+  delete replica;
+}
+
+
+/// Loop over files and events in the multi-threaded mode
+bool SampleAnalyzer::ThreadedLoop(std::vector<SampleFormat>& mySamples)
+{
+  // Launching the workers
+  for (unsigned int i=0;i<workers_.size();i++)
+    if (!workers_[i]->Start()) return false;
+
+  // Loop over files
+  while(1)
+  {
+    // Opening input file
+    mySamples.push_back(SampleFormat());
+    SampleFormat& mySample=mySamples.back();
+    StatusCode::Type result1 = NextFile(mySample);
+    if (result1!=StatusCode::KEEP)
+    {
+      if (result1==StatusCode::SKIP) continue;
+      else if (result1==StatusCode::FAILURE) {mySamples.pop_back(); break;}
+    }
+
+    // The REC part of the sample, filled by the jet clusterers, is created 
+    // here since the workers share the sample
+    if (!clusters_.empty() && mySample.rec()==0) mySample.InitializeRec();
+
+    // Loop over events: each event is read in a free slot
+    // and handed to the first available worker
+    EventFormat*  myEvent = 0;
+    SampleFormat* dummy   = 0;
+    while(1)
+    {
+      free_events_->Pop(myEvent,dummy);
+      StatusCode::Type result2 = NextEvent(mySample,*myEvent);
+      if (result2!=StatusCode::KEEP)
+      {
+        free_events_->Push(myEvent,0);
+        if (result2==StatusCode::SKIP) continue;
+        else if (result2==StatusCode::FAILURE) break;
+      }
+      UpdateProgressBar();
+      queued_events_->Push(myEvent,&mySample);
+    }
+
+    // Waiting for all the events of the file to be analyzed
+    // (the reader and the sample must not change before)
+    free_events_->WaitForSize(event_slots_.size());
+  }
+
+  // Stopping the workers
+  queued_events_->Close();
+  for (unsigned int i=0;i<workers_.size();i++) workers_[i]->Join();
+  return true;
+}
+
+
+/// Merging the results of the replicas and freeing them
+void SampleAnalyzer::FinalizeThreads(const std::vector<SampleFormat>& mySamples)
+{
+  if (workers_.empty()) return;
+
+  // Merging the results of the replicas into the original analyzers
+  for (unsigned int n=1;n<workers_.size();n++)
+  {
+    const std::vector<AnalyzerBase*>& replicas = workers_[n]->Analyzers();
+    for (unsigned int i=0;i<replicas.size();i++)
+    {
+      if (!analyzers_[i]->Merge(*replicas[i]))
+        ERROR << "problem during the merging of the results of the analysis called '"
+              << analyzers_[i]->name() << "'" << endmsg;
+      DeleteReplica(replicas[i],mySamples);
+    }
+    const std::vector<JetClustererBase*>& clusters = workers_[n]->JetClusterers();
+    for (unsigned int i=0;i<clusters.size();i++)
+    {
+      clusters[i]->Finalize();
+      delete clusters[i];
+    }
+  }
+
+  // Free memory
+  for (unsigned int i=0;i<workers_.size();i++) delete workers_[i];
+  workers_.clear();
+  for (unsigned int i=0;i<event_slots_.size();i++) 
+  {
+    event_slots_[i]->Delete();
+    delete event_slots_[i];
+  }
+  event_slots_.clear();
+  delete queued_events_; queued_events_=0;
+  delete free_events_;   free_events_=0;
+}
+
+
+/// Preparing the queue of files shared by the processes
+bool SampleAnalyzer::InitializeJobs()
+{
+  // No need for more processes than files
+  UInt_t njobs = cfg_.GetNumberOfJobs();
+  if (njobs>inputs_.size()) njobs=inputs_.size();
+  if (njobs<2) return true;
+
+  // Writers and detectors produce a single output for all the files
+  if (!writers_.empty() || !detectors_.empty())
+  {
+    WARNING << "the multi-process mode is not available with writers "
+            << "or detector simulations: the files are analyzed "
+            << "by a single process." << endmsg;
+    return true;
+  }
+
+  // The results of the processes are merged through replicas
+  for (unsigned int i=0;i<analyzers_.size();i++)
+  {
+    AnalyzerBase* test = analyzers_[i]->Clone();
+    if (test==0)
+    {
+      WARNING << "the analyzer '" << analyzers_[i]->name() << "' cannot be "
+              << "replicated: the files are analyzed by a single process."
+              << endmsg;
+      return true;
+    }
+    delete test;
+  }
+
+  // Index of the next file to analyze, shared by all the processes
+  void* shared = mmap(0, sizeof(UInt_t), PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (shared==MAP_FAILED)
+  {
+    ERROR << "impossible to allocate memory shared between processes" 
+          << endmsg;
+    return false;
+  }
+  job_queue_  = static_cast<UInt_t*>(shared);
+  *job_queue_ = 0;
+
+  // Temporary files receiving the results of each process
+  std::string tmpdir = "/tmp";
+  const char* env = std::getenv("TMPDIR");
+  if (env!=0 && env[0]!='\0') tmpdir = env;
+  for (unsigned int n=0;n<njobs;n++)
+  {
+    std::string name = tmpdir + "/ma5job_XXXXXX";
+    std::vector<char> buffer(name.begin(),name.end());
+    buffer.push_back('\0');
+    int fd = mkstemp(&buffer[0]);
+    if (fd==-1)
+    {
+      ERROR << "impossible to create the temporary file '" << name 
+            << "'" << endmsg;
+      FinalizeJobs();
+      return false;
+    }
+    close(fd);
+    job_files_.push_back(std::string(&buffer[0]));
+  }
+
+  INFO << "      - sharing the input files between " << njobs 
+       << " processes" << endmsg;
+  return true;
+}
+
+
+/// Loop over files and events in the multi-process mode
+bool SampleAnalyzer::MultiProcessLoop(std::vector<SampleFormat>& mySamples,
+                                      EventFormat& myEvent)
+{
+  // Buffered messages must not be duplicated in the children
+  std::cout.flush();
+  std::cerr.flush();
+
+  // Launching the processes
+  std::vector<pid_t> pids;
+  for (unsigned int n=0;n<job_files_.size();n++)
+  {
+    pid_t pid = fork();
+    if (pid==-1)
+    {
+      ERROR << "impossible to create a new process" << endmsg;
+      break;
+    }
+    else if (pid==0) RunJob(n,myEvent);
+    pids.push_back(pid);
+  }
+
+  // Waiting for the end of all processes
+  bool ok = (pids.size()==job_files_.size());
+  for (unsigned int n=0;n<pids.size();n++)
+  {
+    int status = 0;
+    if (waitpid(pids[n],&status,0)==-1 || 
+        !WIFEXITED(status) || WEXITSTATUS(status)!=0)
+    {
+      ERROR << "the process #" << n+1 << " has not terminated properly" 
+            << endmsg;
+      ok=false;
+    }
+  }
+
+  // Merging the results
+  if (ok) ok = CollectJobs(mySamples);
+  FinalizeJobs();
+  return ok;
+}
+
+
+/// Analyzing files in a child process and storing the results
+void SampleAnalyzer::RunJob(unsigned int ijob, EventFormat& myEvent)
+{
+  child_process_=true;
+  std::vector<SampleFormat> mySamples(inputs_.size());
+  std::vector<UInt_t> indices;
+
+  // Loop over files: taking the next file in the shared queue
+  while(1)
+  {
+    UInt_t index = __sync_fetch_and_add(job_queue_,1);
+    if (index>=inputs_.size()) break;
+    indices.push_back(index);
+
+    CloseFile();
+    file_index_ = index+1;
+    SampleFormat& mySample = mySamples[index];
+    if (OpenFile(mySample)!=StatusCode::KEEP) continue;
+
+    // Loop over events
+    while(1)
+    {
+      StatusCode::Type result = NextEvent(mySample,myEvent);
+      if (result!=StatusCode::KEEP)
+      {
+        if (result==StatusCode::SKIP) continue;
+        else if (result==StatusCode::FAILURE) break;
+      }
+      for (unsigned int i=0;i<clusters_.size();i++)
+        clusters_[i]->Execute(mySample,myEvent);
+      for (unsigned int i=0;i<analyzers_.size();i++)
+        analyzers_[i]->Execute(mySample,myEvent);
+    }
+    INFO << "        => " << inputs_[index] << ": total number of events: " 
+         << counter_read_[index] << " ( analyzed: " << counter_passed_[index]
+         << " ; skipped: " << counter_read_[index] - counter_passed_[index]
+         << " ) " << endmsg;
+  }
+  CloseFile();
+
+  // Storing the results
+  bool ok = SaveResults(job_files_[ijob], indices, mySamples);
+
+  // Leaving without destroying the objects shared with the parent
+  std::cout.flush();
+  std::cerr.flush();
+  _exit(ok ? 0 : 1);
+}
+
+
+/// Storing the results obtained for some files: files then analyzers
+bool SampleAnalyzer::SaveResults(const std::string& filename,
+                                 const std::vector<UInt_t>& indices,
+                                 const std::vector<SampleFormat>& mySamples)
+{
+  std::ofstream output(filename.c_str(), 
+                       std::ios::out | std::ios::binary | std::ios::trunc);
+  UInt_t nfiles = indices.size();
+  BinaryStream::Write(output, nfiles);
+  for (unsigned int i=0;i<indices.size();i++)
+  {
+    BinaryStream::Write(output, indices[i]);
+    BinaryStream::Write(output, counter_read_[indices[i]]);
+    BinaryStream::Write(output, counter_passed_[indices[i]]);
+    WriteSample(output, mySamples[indices[i]]);
+  }
+  UInt_t nanalyzers = analyzers_.size();
+  BinaryStream::Write(output, nanalyzers);
+  for (unsigned int i=0;i<analyzers_.size();i++)
+    analyzers_[i]->Write_BinaryFormat(output);
+  output.close();
+
+  if (output.fail())
+  {
+    ERROR << "impossible to write the results in the file '"
+          << filename << "'" << endmsg;
+    return false;
+  }
+  return true;
+}
+
+
+/// Merging the results stored by the child processes
+bool SampleAnalyzer::CollectJobs(std::vector<SampleFormat>& mySamples)
+{
+  // One sample per input file, as in the single-process mode
+  mySamples.resize(inputs_.size());
+  for (unsigned int i=0;i<inputs_.size();i++)
+    mySamples[i].setName(inputs_[i]);
+
+  for (unsigned int n=0;n<job_files_.size();n++)
+  {
+    std::ifstream input(job_files_[n].c_str(), 
+                        std::ios::in | std::ios::binary);
+    if (!input)
+    {
+      ERROR << "impossible to read the results of the process #" << n+1
+            << endmsg;
+      return false;
+    }
+
+    // Files analyzed by the process
+    UInt_t nfiles = 0;
+    bool ok = BinaryStream::Read(input, nfiles);
+    for (unsigned int i=0;i<nfiles && ok;i++)
+    {
+      UInt_t index = 0;
+      ok = BinaryStream::Read(input, index) && index<inputs_.size() &&
+           BinaryStream::Read(input, counter_read_[index]) &&
+           BinaryStream::Read(input, counter_passed_[index]) &&
+           ReadSample(input, mySamples[index]);
+    }
+
+    // Results of the analyzers, merged through replicas
+    UInt_t nanalyzers = 0;
+    if (ok) ok = BinaryStream::Read(input, nanalyzers) && 
+                 nanalyzers==analyzers_.size();
+    for (unsigned int i=0;i<analyzers_.size() && ok;i++)
+    {
+      AnalyzerBase* replica = CreateReplica(i);
+      if (replica==0) return false;
+      ok = replica->Read_BinaryFormat(input) && 
+           analyzers_[i]->Merge(*replica);
+      DeleteReplica(replica,mySamples);
+    }
+
+    if (!ok)
+    {
+      ERROR << "the results of the process #" << n+1 << " are corrupted" 
+            << endmsg;
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/// Merging the results of the shards listed in the input list
+bool SampleAnalyzer::MergeShards(std::vector<SampleFormat>& mySamples)
+{
+  // The input files are those analyzed by the shards
+  std::vector<std::string> shards = inputs_;
+  inputs_.clear();
+
+  // First pass: names of the analyzed files (the samples are created at 
+  // once since they must not be moved afterwards)
+  for (unsigned int n=0;n<shards.size();n++)
+  {
+    std::ifstream input(shards[n].c_str(), std::ios::in | std::ios::binary);
+    UInt_t nfiles = 0;
+    bool ok = input && BinaryStream::Read(input, nfiles);
+    for (unsigned int i=0;i<nfiles && ok;i++)
+    {
+      UInt_t index = 0;
+      ULong64_t nread = 0, npassed = 0;
+      SampleFormat mySample;
+      ok = BinaryStream::Read(input, index) &&
+           BinaryStream::Read(input, nread) &&
+           BinaryStream::Read(input, npassed) &&
+           ReadSample(input, mySample);
+      if (ok && std::find(inputs_.begin(),inputs_.end(),mySample.name())==
+                inputs_.end()) inputs_.push_back(mySample.name());
+      delete mySample.mc_;
+      delete mySample.rec_;
+    }
+    if (!ok)
+    {
+      ERROR << "impossible to read the results of the shard '" << shards[n]
+            << "'" << endmsg;
+      return false;
+    }
+  }
+  mySamples.clear();
+  mySamples.resize(inputs_.size());
+  counter_read_.assign(inputs_.size(),0);
+  counter_passed_.assign(inputs_.size(),0);
+  std::vector<bool> filled(inputs_.size(),false);
+
+  // Second pass: merging the counters, the samples and the analyzers
+  for (unsigned int n=0;n<shards.size();n++)
+  {
+    INFO << "    * " << n+1 << "/" << shards.size() << "  " << shards[n] 
+         << endmsg;
+    std::ifstream input(shards[n].c_str(), std::ios::in | std::ios::binary);
+
+    // Files analyzed by the shard: the same file is found in all shards
+    UInt_t nfiles = 0;
+    bool ok = BinaryStream::Read(input, nfiles);
+    for (unsigned int i=0;i<nfiles && ok;i++)
+    {
+      UInt_t index = 0;
+      ULong64_t nread = 0, npassed = 0;
+      SampleFormat mySample;
+      ok = BinaryStream::Read(input, index) &&
+           BinaryStream::Read(input, nread) &&
+           BinaryStream::Read(input, npassed) &&
+           ReadSample(input, mySample);
+      if (!ok) break;
+
+      unsigned int j = std::find(inputs_.begin(),inputs_.end(),
+                                 mySample.name()) - inputs_.begin();
+      if (!filled[j])
+      {
+        std::stringstream copy;
+        WriteSample(copy, mySample);
+        ok = ReadSample(copy, mySamples[j]);
+        filled[j]=true;
+      }
+      else if (mySample.mc_!=0 && mySamples[j].mc_!=0)
+      {
+        mySamples[j].mc_->sumweight_positive_ += 
+                                      mySample.mc_->sumweight_positive_;
+        mySamples[j].mc_->sumweight_negative_ += 
+                                      mySample.mc_->sumweight_negative_;
+      }
+      counter_read_[j]   += nread;
+      counter_passed_[j] += npassed;
+      delete mySample.mc_;
+      delete mySample.rec_;
+    }
+
+    // Results of the analyzers, merged through replicas
+    UInt_t nanalyzers = 0;
+    if (ok) ok = BinaryStream::Read(input, nanalyzers) && 
+                 nanalyzers==analyzers_.size();
+    for (unsigned int i=0;i<analyzers_.size() && ok;i++)
+    {
+      AnalyzerBase* replica = CreateReplica(i);
+      if (replica==0) return false;
+      ok = replica->Read_BinaryFormat(input) && 
+           analyzers_[i]->Merge(*replica);
+      DeleteReplica(replica,mySamples);
+    }
+
+    if (!ok)
+    {
+      ERROR << "the results of the shard '" << shards[n] << "' are corrupted"
+            << " or do not correspond to this analysis" << endmsg;
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/// Removing the files and the memory shared with the child processes
+void SampleAnalyzer::FinalizeJobs()
+{
+  for (unsigned int n=0;n<job_files_.size();n++)
+    std::remove(job_files_[n].c_str());
+  job_files_.clear();
+  if (job_queue_!=0) munmap(job_queue_, sizeof(UInt_t));
+  job_queue_=0;
+}
+
+
+/// Dumping the description of a sample in a binary stream
+void SampleAnalyzer::WriteSample(std::ostream& output, 
+                                 const SampleFormat& mySample)
+{
+  // General information
+  BinaryStream::Write(output, mySample.name_);
+  BinaryStream::Write(output, mySample.sample_generator_);
+  BinaryStream::Write(output, mySample.sample_format_);
+  UInt_t nlines = mySample.header_.size();
+  BinaryStream::Write(output, nlines);
+  for (unsigned int i=0;i<mySample.header_.size();i++)
+    BinaryStream::Write(output, mySample.header_[i]);
+
+  // Monte Carlo information
+  bool mc = (mySample.mc_!=0);
+  BinaryStream::Write(output, mc);
+  if (mc)
+  {
+    const MCSampleFormat* info = mySample.mc_;
+    BinaryStream::Write(output, info->beamPDGID_);
+    BinaryStream::Write(output, info->beamE_);
+    BinaryStream::Write(output, info->beamPDFauthor_);
+    BinaryStream::Write(output, info->beamPDFID_);
+    BinaryStream::Write(output, info->weightMode_);
+    BinaryStream::Write(output, info->xsection_);
+    BinaryStream::Write(output, info->xsection_error_);
+    BinaryStream::Write(output, info->sumweight_positive_);
+    BinaryStream::Write(output, info->sumweight_negative_);
+    UInt_t nprocesses = info->processes_.size();
+    BinaryStream::Write(output, nprocesses);
+    for (unsigned int i=0;i<info->processes_.size();i++)
+    {
+      const ProcessFormat& process = info->processes_[i];
+      BinaryStream::Write(output, process.xsectionMean_);
+      BinaryStream::Write(output, process.xsectionError_);
+      BinaryStream::Write(output, process.weightMax_);
+      BinaryStream::Write(output, process.processId_);
+    }
+  }
+
+  // Reconstruction information
+  bool rec = (mySample.rec_!=0);
+  BinaryStream::Write(output, rec);
+}
+
+
+/// Restoring the description of a sample from a binary stream
+bool SampleAnalyzer::ReadSample(std::istream& input, SampleFormat& mySample)
+{
+  // General information
+  UInt_t nlines = 0;
+  if (!BinaryStream::Read(input, mySample.name_)             ||
+      !BinaryStream::Read(input, mySample.sample_generator_) ||
+      !BinaryStream::Read(input, mySample.sample_format_)    ||
+      !BinaryStream::Read(input, nlines)) return false;
+  mySample.header_.resize(nlines);
+  for (unsigned int i=0;i<nlines;i++)
+    if (!BinaryStream::Read(input, mySample.header_[i])) return false;
+
+  // Monte Carlo information
+  bool mc = false;
+  if (!BinaryStream::Read(input, mc)) return false;
+  if (mc)
+  {
+    if (mySample.mc_==0) mySample.InitializeMC();
+    MCSampleFormat* info = mySample.mc_;
+    UInt_t nprocesses = 0;
+    if (!BinaryStream::Read(input, info->beamPDGID_)          ||
+        !BinaryStream::Read(input, info->beamE_)              ||
+        !BinaryStream::Read(input, info->beamPDFauthor_)      ||
+        !BinaryStream::Read(input, info->beamPDFID_)          ||
+        !BinaryStream::Read(input, info->weightMode_)         ||
+        !BinaryStream::Read(input, info->xsection_)           ||
+        !BinaryStream::Read(input, info->xsection_error_)     ||
+        !BinaryStream::Read(input, info->sumweight_positive_) ||
+        !BinaryStream::Read(input, info->sumweight_negative_) ||
+        !BinaryStream::Read(input, nprocesses)) return false;
+    info->processes_.resize(nprocesses);
+    for (unsigned int i=0;i<nprocesses;i++)
+    {
+      ProcessFormat& process = info->processes_[i];
+      if (!BinaryStream::Read(input, process.xsectionMean_)  ||
+          !BinaryStream::Read(input, process.xsectionError_) ||
+          !BinaryStream::Read(input, process.weightMax_)     ||
+          !BinaryStream::Read(input, process.processId_)) return false;
+    }
+  }
+
+  // Reconstruction information
+  bool rec = false;
+  if (!BinaryStream::Read(input, rec)) return false;
+  if (rec && mySample.rec_==0) mySample.InitializeRec();
+  return true;
+}
+
+
 WriterBase* SampleAnalyzer::InitializeWriter(const std::string& name, 
                                    const std::string& outputname)
 {
@@ -298,6 +1026,7 @@ JetClustererBase* SampleAnalyzer::InitializeJetClusterer(
 
   // Putting the analysis in container
   clusters_.push_back(myClusterer);
+  clusters_parameters_.push_back(parameters);
 
   // Initialize (specific to the analysis)
   if (!myClusterer->Initialize(parameters))
@@ -357,13 +1086,34 @@ DetectorBase* SampleAnalyzer::InitializeDetector(
   return myDetector;
 }
 
-/// Reading the next event
+/// Reading the next file
 StatusCode::Type SampleAnalyzer::NextFile(SampleFormat& mySample)
 {
+  // Finalize previous file
+  CloseFile();
+
+  // Next file
+  file_index_++;
+
+  // Have we read the last file ?
+  if (file_index_>inputs_.size()) return StatusCode::FAILURE;
+
+  // Opening the file
+  return OpenFile(mySample);
+}
+
+
+/// Finalizing the reading of the current file
+void SampleAnalyzer::CloseFile()
+{
+  // Stopping the reading thread
+  if (prefetcher_!=0) prefetcher_->Stop();
+
   // Finalize previous file
   if (myReader_!=0)
   {
     myReader_->Finalize();
+    myReader_=0;
   }  
 
   // Finalize previous progress bar
@@ -376,12 +1126,12 @@ StatusCode::Type SampleAnalyzer::NextFile(SampleFormat& mySample)
          << " ) " << endmsg;
   }
   LastFileFail_=false;
+}
 
-  // Next file
-  file_index_++;
 
-  // Have we read the last file ?
-  if (file_index_>inputs_.size()) return StatusCode::FAILURE;
+/// Opening the file inputs_[file_index_-1]
+StatusCode::Type SampleAnalyzer::OpenFile(SampleFormat& mySample)
+{
   next_file_=false;
 
   // Progression bar
@@ -468,10 +1218,62 @@ StatusCode::Type SampleAnalyzer::NextFile(SampleFormat& mySample)
   // Finalize the header block
   myReader_->FinalizeHeader(mySample);
 
+  // Selection of the events (random-access files only). With sharding, the
+  // selected events are shared between the shards.
+  if (cfg_.IsEventSelection() && cfg_.GetNumberOfShards()<=1)
+  {
+    if (myReader_->SelectEvents(cfg_.GetFirstEvent(),0,cfg_.GetEventStride()))
+      length = myReader_->GetFinalPosition();
+    else
+      WARNING << "the events of this file can only be read sequentially: "
+              << "the options --first_event and --event_stride are ignored."
+              << endmsg;
+  }
+
+  // Sharding: only a part of the (selected) events is analyzed
+  if (cfg_.GetNumberOfShards()>1)
+  {
+    if (myReader_->SelectShard(cfg_.GetShardIndex(),
+                               cfg_.GetNumberOfShards(),
+                               cfg_.GetFirstEvent(),
+                               cfg_.GetEventStride()))
+      length = myReader_->GetFinalPosition();
+    else if (cfg_.IsEventSelection())
+    {
+      ERROR << "the events of this file can only be read sequentially: "
+            << "the option --shard cannot be used together with the options "
+            << "--first_event and --event_stride. The file is skipped."
+            << endmsg;
+      LastFileFail_=true;
+      return StatusCode::SKIP;
+    }
+    else if (cfg_.GetShardIndex()==0)
+      WARNING << "this file cannot be split: it is fully analyzed by the "
+              << "shard 0." << endmsg;
+    else
+    {
+      INFO << "        => this file cannot be split: it is analyzed by the "
+           << "shard 0." << endmsg;
+      LastFileFail_=true;
+      return StatusCode::SKIP;
+    }
+  }
+
+  // Numbering of the selected events
+  myReader_->GetSelection(event_first_,event_stride_);
+
   // Dump the header block
   mySample.printSubtitle();
 
-  // Initialize the progress bar
+  // Reading the events in a separate thread
+  if (!cfg_.IsNoPrefetch() && myReader_->AllowsPrefetching())
+  {
+    if (prefetcher_==0) prefetcher_ = new EventPrefetcher();
+    prefetcher_->Start(myReader_,mySample);
+  }
+
+  // Initialize the progress bar (not displayed by the child processes)
+  if (child_process_) return StatusCode::KEEP;
   if (progressBar_==0) progressBar_ = new ProgressBar();
   progressBar_->Initialize(35,0,length);
 
@@ -483,17 +1285,34 @@ StatusCode::Type SampleAnalyzer::NextFile(SampleFormat& mySample)
 /// Reading the next event
 StatusCode::Type SampleAnalyzer::NextEvent(SampleFormat& mySample, EventFormat& myEvent)
 {
-  // Read an event
-  StatusCode::Type test=myReader_->ReadEvent(myEvent, mySample);
+  // Read an event (already read and finalized by the reading thread?)
+  bool prefetched = (prefetcher_!=0 && prefetcher_->IsRunning());
+  bool finalized  = false;
+  StatusCode::Type test;
+  if (prefetched)
+  {
+    test=prefetcher_->Next(myEvent, finalized);
+    if (test==StatusCode::FAILURE) prefetcher_->Stop();
+  }
+  else test=myReader_->ReadEvent(myEvent, mySample);
 
   // GOOD case
   if (test==StatusCode::KEEP)
   {
+    // Random stream of the event, keyed by the reader or by the number of
+    // the event in the file
+    Long64_t key = prefetched ? prefetcher_->GetEventKey() 
+                              : myReader_->GetEventKey();
+    ULong64_t number = (key>=0) ? static_cast<ULong64_t>(key) :
+                       event_first_ + event_stride_*counter_read_[file_index_-1];
+    myEvent.random().Initialize(cfg_.GetRandomSeed(), file_index_-1, number);
+
     // Incrementing counter of number of read events
     counter_read_[file_index_-1]++;
 
     // Finalize the event and filter the event
-    if (!myReader_->FinalizeEvent(mySample,myEvent)) return StatusCode::SKIP;
+    if (!prefetched) finalized=myReader_->FinalizeEvent(mySample,myEvent);
+    if (!finalized) return StatusCode::SKIP;
 
     // Incrementing counter of number of good events
     counter_passed_[file_index_-1]++;
@@ -547,6 +1366,16 @@ inline std::string CleanName(const std::string &name)
 bool SampleAnalyzer::Finalize(std::vector<SampleFormat>& mySamples, 
                               EventFormat& myEvent)
 {
+  // Merging the results obtained by the different threads
+  FinalizeThreads(mySamples);
+
+  // Stopping the reading thread
+  if (prefetcher_!=0)
+  {
+    delete prefetcher_;
+    prefetcher_=0;
+  }
+
   // -----------------------------------------------------------------------
   //                      DUMP NUMBER OF EVENT
   // -----------------------------------------------------------------------
@@ -576,8 +1405,22 @@ bool SampleAnalyzer::Finalize(std::vector<SampleFormat>& mySamples,
   { mySamples[i].setNEvents(counter_read_[i]); }
   FillSummary(summary,mySamples);
 
+  // Sharding: the partial results are stored for being merged later
+  if (cfg_.GetNumberOfShards()>1)
+  {
+    std::stringstream str;
+    str << datasetName_ << "_shard" << cfg_.GetShardIndex() << "of"
+        << cfg_.GetNumberOfShards() << ".ma5shard";
+    std::vector<UInt_t> indices;
+    for (unsigned int i=0;i<mySamples.size() && i<inputs_.size();i++)
+      indices.push_back(i);
+    if (SaveResults(str.str(), indices, mySamples))
+      INFO << "    * Results of the shard stored in the file '" << str.str()
+           << "'" << endmsg;
+  }
+
   // Finalize analysis
-  if(cfg_.useRSM())
+  else if(cfg_.useRSM())
   {
     // Creating the general SAF file (sample info)
     std::string datasetname = cfg_.GetInputFileName();
@@ -733,5 +1576,7 @@ void SampleAnalyzer::FillSummary(SampleFormat& summary,
 /// Updating the progress bar
 void SampleAnalyzer::UpdateProgressBar()
 {
-  progressBar_->Update(myReader_->GetPosition());
+  if (prefetcher_!=0 && prefetcher_->IsRunning())
+    progressBar_->Update(prefetcher_->GetPosition());
+  else progressBar_->Update(myReader_->GetPosition());
 }
@@ -51,6 +51,9 @@ namespace MA5
 
 class ProgressBar;
 class Configuration;
+class EventQueue;
+class EventWorker;
+class EventPrefetcher;
 
 class SampleAnalyzer
 {
@@ -84,6 +87,11 @@ class SampleAnalyzer
   unsigned int file_index_;
   bool next_file_;
 
+  /// Selected events of the current file: number of the first one and step
+  /// between two of them (numbering of the random streams)
+  ULong64_t event_first_;
+  ULong64_t event_stride_;
+
   /// Counters
   std::vector<ULong64_t> counter_read_;
   std::vector<ULong64_t> counter_passed_;
@@ -94,6 +102,30 @@ class SampleAnalyzer
   /// Progress bar for event reading
   ProgressBar* progressBar_;
 
+  /// Reading of the events in a separate thread
+  EventPrefetcher* prefetcher_;
+
+  /// Parameters used for initializing analyzers and jet clusterers
+  /// (needed for creating replicas in the multi-threaded mode)
+  std::vector< std::map<std::string,std::string> > analyzers_parameters_;
+  std::vector< std::map<std::string,std::string> > clusters_parameters_;
+
+  /// Multi-threaded mode: workers, event slots and queues of slots
+  std::vector<EventWorker*> workers_;
+  std::vector<EventFormat*> event_slots_;
+  EventQueue* queued_events_;
+  EventQueue* free_events_;
+
+  /// Multi-process mode: files where the processes store their results
+  std::vector<std::string> job_files_;
+
+  /// Multi-process mode: index of the next file to analyze
+  /// (counter shared between the processes)
+  UInt_t* job_queue_;
+
+  /// Is the current process a child of the multi-process mode ?
+  bool child_process_;
+
   
  public:
 
@@ -151,8 +183,71 @@ class SampleAnalyzer
   /// Creating the directory structure associated with the SRM
   bool PostInitialize();
 
+  /// Is the multi-threaded mode used ?
+  bool IsThreaded() const
+  { return !workers_.empty(); }
+
+  /// Loop over files and events in the multi-threaded mode
+  bool ThreadedLoop(std::vector<SampleFormat>& mySamples);
+
+  /// Is the multi-process mode used ?
+  bool IsMultiProcess() const
+  { return !job_files_.empty(); }
+
+  /// Loop over files and events in the multi-process mode
+  bool MultiProcessLoop(std::vector<SampleFormat>& mySamples, 
+                        EventFormat& myEvent);
+
+  /// Are the results of shards merged ?
+  bool IsMergingShards() const
+  { return cfg_.IsMergeShards(); }
+
+  /// Merging the results of the shards listed in the input list
+  bool MergeShards(std::vector<SampleFormat>& mySamples);
+
  private:
 
+  /// Creating the replicas of analyzers and clusterers for each thread
+  bool InitializeThreads();
+
+  /// Merging the results of the replicas and freeing them
+  void FinalizeThreads(const std::vector<SampleFormat>& mySamples);
+
+  /// Creating a replica of an analyzer, initialized as the original one
+  AnalyzerBase* CreateReplica(unsigned int index);
+
+  /// Finalizing (without output) and deleting a replica of an analyzer
+  void DeleteReplica(AnalyzerBase* replica, 
+                     const std::vector<SampleFormat>& mySamples);
+
+  /// Preparing the queue of files shared by the processes
+  bool InitializeJobs();
+
+  /// Analyzing files in a child process and storing the results
+  /// (this method never returns)
+  void RunJob(unsigned int ijob, EventFormat& myEvent);
+
+  /// Merging the results stored by the child processes
+  bool CollectJobs(std::vector<SampleFormat>& mySamples);
+
+  /// Storing the counters, samples and analyzer results of some files
+  bool SaveResults(const std::string& filename,
+                   const std::vector<UInt_t>& indices,
+                   const std::vector<SampleFormat>& mySamples);
+
+  /// Removing the files and the memory shared with the child processes
+  void FinalizeJobs();
+
+  /// Dumping/restoring the description of a sample in a binary stream
+  static void WriteSample(std::ostream& output, const SampleFormat& mySample);
+  static bool ReadSample(std::istream& input, SampleFormat& mySample);
+
+  /// Finalizing the reading of the current file
+  void CloseFile();
+
+  /// Opening the file inputs_[file_index_-1]
+  StatusCode::Type OpenFile(SampleFormat& mySample);
+
   /// Filling the summary format
   void FillSummary(SampleFormat& summary,
                    const std::vector<SampleFormat>& mysamples);
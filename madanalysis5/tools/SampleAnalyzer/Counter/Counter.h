@@ -30,6 +30,9 @@
 #include <string>
 #include <map>
 
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Core/BinaryStream.h"
+
 
 namespace MA5
 {
@@ -104,6 +107,33 @@ class Counter
     }
   }
 
+  /// Adding the content of another counter (merging partial results)
+  void Merge(const Counter& other)
+  {
+    nentries_.first    += other.nentries_.first;
+    nentries_.second   += other.nentries_.second;
+    sumweight_.first   += other.sumweight_.first;
+    sumweight_.second  += other.sumweight_.second;
+    sumweight2_.first  += other.sumweight2_.first;
+    sumweight2_.second += other.sumweight2_.second;
+  }
+
+  /// Dumping the content of the counter in a binary stream
+  void Write_BinaryFormat(std::ostream& output) const
+  {
+    BinaryStream::Write(output, nentries_);
+    BinaryStream::Write(output, sumweight_);
+    BinaryStream::Write(output, sumweight2_);
+  }
+
+  /// Restoring the content of the counter from a binary stream
+  bool Read_BinaryFormat(std::istream& input)
+  {
+    return BinaryStream::Read(input, nentries_)  &&
+           BinaryStream::Read(input, sumweight_) &&
+           BinaryStream::Read(input, sumweight2_);
+  }
+
 };
 
 }
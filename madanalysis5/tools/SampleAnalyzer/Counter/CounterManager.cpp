@@ -24,6 +24,7 @@
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/Counter/CounterManager.h"
+#include "SampleAnalyzer/Service/LogService.h"
 
 // ROOT headers
 #include <TVector.h>
@@ -31,6 +32,57 @@
 
 using namespace MA5;
 
+/// Adding the counters of another manager (merging partial results)
+bool CounterManager::Merge(const CounterManager& other)
+{
+  // Safety: the two managers must describe the same cuts
+  if (counters_.size()!=other.counters_.size())
+  {
+    ERROR << "cutflows with different numbers of cuts cannot be merged"
+          << endmsg;
+    return false;
+  }
+
+  // Merging
+  initial_.Merge(other.initial_);
+  for (unsigned int i=0;i<counters_.size();i++)
+    counters_[i].Merge(other.counters_[i]);
+  return true;
+}
+
+
+/// Dumping the counters in a binary stream
+void CounterManager::Write_BinaryFormat(std::ostream& output) const
+{
+  UInt_t ncounters = counters_.size();
+  BinaryStream::Write(output, ncounters);
+  initial_.Write_BinaryFormat(output);
+  for (unsigned int i=0;i<counters_.size();i++)
+    counters_[i].Write_BinaryFormat(output);
+}
+
+
+/// Restoring the counters from a binary stream
+bool CounterManager::Read_BinaryFormat(std::istream& input)
+{
+  // Safety: the stream must describe the same cuts
+  UInt_t ncounters = 0;
+  if (!BinaryStream::Read(input, ncounters)) return false;
+  if (ncounters!=counters_.size())
+  {
+    ERROR << "the stored cutflow does not have the expected number of cuts"
+          << endmsg;
+    return false;
+  }
+
+  // Reading
+  if (!initial_.Read_BinaryFormat(input)) return false;
+  for (unsigned int i=0;i<counters_.size();i++)
+    if (!counters_[i].Read_BinaryFormat(input)) return false;
+  return true;
+}
+
+
 /// Write the counters in a ROOT file
 void CounterManager::Write_RootFormat(TFile* output) const
 {
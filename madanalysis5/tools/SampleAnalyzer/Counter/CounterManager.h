@@ -99,6 +99,15 @@ class CounterManager
   const Counter& GetInitial() const
   { return initial_; }
 
+  /// Adding the counters of another manager (merging partial results)
+  bool Merge(const CounterManager& other);
+
+  /// Dumping the counters in a binary stream
+  void Write_BinaryFormat(std::ostream& output) const;
+
+  /// Restoring the counters from a binary stream
+  bool Read_BinaryFormat(std::istream& input);
+
   /// Write the counters in a Text file
   void Write_TextFormat(SAFWriter& output) const;
 
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ArenaVector_h
+#define ArenaVector_h
+
+// STL headers
+#include <new>
+#include <cstddef>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/EventArena.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Array with the interface of std::vector used for the lists owned by the
+/// particles of an event. When an arena is attached, the storage is taken
+/// from it and is released all at once when the event is reset; otherwise 
+/// the heap is used. clear() keeps the capacity. A copy always owns its 
+/// storage on the heap, so that it can outlive the event.
+//////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class ArenaVector
+{
+  // -------------------------------------------------------------
+  //                          typedefs
+  // -------------------------------------------------------------
+ public :
+
+  typedef T            value_type;
+  typedef T*           iterator;
+  typedef const T*     const_iterator;
+  typedef T&           reference;
+  typedef const T&     const_reference;
+  typedef std::size_t  size_type;
+
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Elements
+  T* data_;
+
+  /// Number of elements
+  size_type size_;
+
+  /// Number of elements which can be stored without allocation
+  size_type capacity_;
+
+  /// Arena giving the storage (0 = heap)
+  EventArena* arena_;
+
+  /// Is the storage allocated on the heap ?
+  bool owner_;
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  ArenaVector()
+  { data_=0; size_=0; capacity_=0; arena_=0; owner_=false; }
+
+  /// Copy constructor
+  ArenaVector(const ArenaVector& other)
+  {
+    data_=0; size_=0; capacity_=0; arena_=0; owner_=false;
+    reserve(other.size_);
+    for (size_type i=0;i<other.size_;i++) new (data_+i) T(other.data_[i]);
+    size_=other.size_;
+  }
+
+  /// Destructor
+  ~ArenaVector()
+  {
+    clear();
+    Release();
+  }
+
+  /// Assignment (the storage of the target is kept)
+  ArenaVector& operator=(const ArenaVector& other)
+  {
+    if (this==&other) return *this;
+    clear();
+    reserve(other.size_);
+    for (size_type i=0;i<other.size_;i++) new (data_+i) T(other.data_[i]);
+    size_=other.size_;
+    return *this;
+  }
+
+  /// Taking the next allocations from an arena (0 = heap). If the array
+  /// is empty, the current storage is released.
+  void SetArena(EventArena* arena)
+  {
+    if (arena_==arena) return;
+    arena_=arena;
+    if (size_==0) Release();
+  }
+
+  /// Accessors
+  size_type size()     const { return size_; }
+  size_type capacity() const { return capacity_; }
+  bool      empty()    const { return size_==0; }
+
+  T&       operator[](size_type i)       { return data_[i]; }
+  const T& operator[](size_type i) const { return data_[i]; }
+
+  T&       front()       { return data_[0]; }
+  const T& front() const { return data_[0]; }
+  T&       back()        { return data_[size_-1]; }
+  const T& back()  const { return data_[size_-1]; }
+
+  iterator       begin()       { return data_; }
+  const_iterator begin() const { return data_; }
+  iterator       end()         { return data_+size_; }
+  const_iterator end()   const { return data_+size_; }
+
+  /// Adding an element at the end
+  void push_back(const T& value)
+  {
+    if (size_==capacity_) 
+    {
+      // value may belong to the array
+      T copy(value);
+      reserve(capacity_==0 ? 4 : 2*capacity_);
+      new (data_+size_) T(copy);
+    }
+    else new (data_+size_) T(value);
+    size_++;
+  }
+
+  /// Removing the last element
+  void pop_back()
+  {
+    size_--;
+    data_[size_].~T();
+  }
+
+  /// Removing all the elements (the capacity is kept)
+  void clear()
+  {
+    for (size_type i=0;i<size_;i++) data_[i].~T();
+    size_=0;
+  }
+
+  /// Changing the number of elements
+  void resize(size_type n, const T& value = T())
+  {
+    if (n<size_)
+    {
+      for (size_type i=n;i<size_;i++) data_[i].~T();
+    }
+    else
+    {
+      reserve(n);
+      for (size_type i=size_;i<n;i++) new (data_+i) T(value);
+    }
+    size_=n;
+  }
+
+  /// Making room for n elements
+  void reserve(size_type n)
+  {
+    if (n<=capacity_) return;
+    T* data = 0;
+    if (arena_!=0) data = static_cast<T*>(arena_->Allocate(n*sizeof(T)));
+    else data = static_cast<T*>(::operator new(n*sizeof(T)));
+    for (size_type i=0;i<size_;i++)
+    {
+      new (data+i) T(data_[i]);
+      data_[i].~T();
+    }
+    if (owner_) ::operator delete(data_);
+    data_=data;
+    capacity_=n;
+    owner_=(arena_==0);
+  }
+
+ private :
+
+  /// Releasing the storage (the elements must have been destroyed)
+  void Release()
+  {
+    if (owner_) ::operator delete(data_);
+    data_=0; capacity_=0; owner_=false;
+  }
+
+};
+
+}
+
+#endif
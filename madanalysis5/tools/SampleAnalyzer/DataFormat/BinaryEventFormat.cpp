@@ -0,0 +1,731 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cstring>
+
+// ZIP headers
+#ifdef ZIP_USE
+   #include <zlib.h>
+#endif
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/BinaryEventFormat.h"
+#include "SampleAnalyzer/Core/BinaryStream.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+// -----------------------------------------------------------------------------
+// Constants
+// -----------------------------------------------------------------------------
+const char BinaryEventFormat::Magic[8] = {'M','A','5','E','V','T','\0','\0'};
+const UInt_t BinaryEventFormat::Version = 2;
+const char BinaryEventFormat::IndexMagic[8] = {'M','A','5','I','N','D','E','X'};
+
+/// Content of an event
+static const UChar_t HAS_MC  = 1;
+static const UChar_t HAS_REC = 2;
+
+
+// -----------------------------------------------------------------------------
+// WriteSample
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteSample(std::ostream& output, 
+                                    const SampleFormat& mySample)
+{
+  output.write(Magic,sizeof(Magic));
+  BinaryStream::Write(output, Version);
+
+  // General information
+  BinaryStream::Write(output, static_cast<Int_t>(mySample.sampleGenerator()));
+  BinaryStream::Write(output, static_cast<Int_t>(mySample.sampleFormat()));
+  BinaryStream::Write(output, static_cast<UInt_t>(mySample.header().size()));
+  for (unsigned int i=0;i<mySample.header().size();i++)
+    BinaryStream::Write(output, mySample.header()[i]);
+
+  // Content
+  UChar_t flags = 0;
+  if (mySample.mc()!=0)  flags |= HAS_MC;
+  if (mySample.rec()!=0) flags |= HAS_REC;
+  BinaryStream::Write(output, flags);
+
+  // Monte Carlo information
+  if (mySample.mc()!=0)
+  {
+    const MCSampleFormat& mc = *mySample.mc();
+    BinaryStream::Write(output, mc.beamPDGID_);
+    BinaryStream::Write(output, mc.beamE_);
+    BinaryStream::Write(output, mc.beamPDFauthor_);
+    BinaryStream::Write(output, mc.beamPDFID_);
+    BinaryStream::Write(output, mc.weightMode_);
+    BinaryStream::Write(output, mc.xsection_);
+    BinaryStream::Write(output, mc.xsection_error_);
+    BinaryStream::Write(output, static_cast<UInt_t>(mc.processes_.size()));
+    for (unsigned int i=0;i<mc.processes_.size();i++)
+    {
+      BinaryStream::Write(output, mc.processes_[i].xsectionMean_);
+      BinaryStream::Write(output, mc.processes_[i].xsectionError_);
+      BinaryStream::Write(output, mc.processes_[i].weightMax_);
+      BinaryStream::Write(output, mc.processes_[i].processId_);
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadSample
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadSample(std::istream& input, SampleFormat& mySample)
+{
+  // Tag and version
+  char magic[sizeof(Magic)];
+  input.read(magic,sizeof(magic));
+  if (!input.good() || std::memcmp(magic,Magic,sizeof(Magic))!=0)
+  {
+    ERROR << "the file is not a MA5 binary event file" << endmsg;
+    return false;
+  }
+  UInt_t version = 0;
+  if (!BinaryStream::Read(input, version)) return false;
+  if (version!=Version)
+  {
+    ERROR << "the MA5 binary event file has the version " << version
+          << " while the version " << Version << " is expected" << endmsg;
+    return false;
+  }
+
+  // General information
+  Int_t generator = 0, format = 0;
+  UInt_t nheader = 0;
+  if (!BinaryStream::Read(input, generator)) return false;
+  if (!BinaryStream::Read(input, format))    return false;
+  if (!BinaryStream::Read(input, nheader))   return false;
+  mySample.SetSampleGenerator(static_cast<MA5GEN::GeneratorType>(generator));
+  mySample.SetSampleFormat(static_cast<MA5FORMAT::SampleFormatType>(format));
+  std::string line;
+  for (unsigned int i=0;i<nheader;i++)
+  {
+    if (!BinaryStream::Read(input, line)) return false;
+    mySample.AddHeader(line);
+  }
+
+  // Content
+  UChar_t flags = 0;
+  if (!BinaryStream::Read(input, flags)) return false;
+  if ((flags & HAS_REC)!=0 && mySample.rec()==0) mySample.InitializeRec();
+
+  // Monte Carlo information
+  if ((flags & HAS_MC)!=0)
+  {
+    if (mySample.mc()==0) mySample.InitializeMC();
+    MCSampleFormat& mc = *mySample.mc();
+    UInt_t nprocesses = 0;
+    if (!BinaryStream::Read(input, mc.beamPDGID_))      return false;
+    if (!BinaryStream::Read(input, mc.beamE_))          return false;
+    if (!BinaryStream::Read(input, mc.beamPDFauthor_))  return false;
+    if (!BinaryStream::Read(input, mc.beamPDFID_))      return false;
+    if (!BinaryStream::Read(input, mc.weightMode_))     return false;
+    if (!BinaryStream::Read(input, mc.xsection_))       return false;
+    if (!BinaryStream::Read(input, mc.xsection_error_)) return false;
+    if (!BinaryStream::Read(input, nprocesses))         return false;
+    for (unsigned int i=0;i<nprocesses;i++)
+    {
+      ProcessFormat* proc = mc.GetNewProcess();
+      if (!BinaryStream::Read(input, proc->xsectionMean_))  return false;
+      if (!BinaryStream::Read(input, proc->xsectionError_)) return false;
+      if (!BinaryStream::Read(input, proc->weightMax_))     return false;
+      if (!BinaryStream::Read(input, proc->processId_))     return false;
+    }
+  }
+
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteEvent
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteEvent(std::vector<char>& output, 
+                                   const EventFormat& myEvent)
+{
+  UChar_t flags = 0;
+  if (myEvent.mc()!=0)  flags |= HAS_MC;
+  if (myEvent.rec()!=0) flags |= HAS_REC;
+  BinaryStream::Write(output, flags);
+
+  if (myEvent.mc()!=0)  WriteMC(output, *myEvent.mc());
+  if (myEvent.rec()!=0) WriteRec(output, *myEvent.rec(), myEvent.mc());
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadEvent
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadEvent(const char*& input, const char* end,
+                                  EventFormat& myEvent)
+{
+  UChar_t flags = 0;
+  if (!BinaryStream::Read(input, end, flags)) return false;
+
+  if ((flags & HAS_MC)!=0)
+  {
+    myEvent.InitializeMC();
+    if (!ReadMC(input, end, *myEvent.mc())) return false;
+  }
+  if ((flags & HAS_REC)!=0)
+  {
+    myEvent.InitializeRec();
+    if (!ReadRec(input, end, *myEvent.rec(), myEvent.mc())) return false;
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteBlock
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::WriteBlock(std::ostream& output, UInt_t nevents,
+                                   const std::vector<char>& raw, bool compress)
+{
+  UInt_t rawsize = raw.size();
+  const char* payload = raw.empty() ? 0 : &raw[0];
+  UInt_t storedsize = rawsize;
+
+#ifdef ZIP_USE
+  // Fast compression level: the blocks are read back more often than written
+  std::vector<char> compressed;
+  if (compress && rawsize!=0)
+  {
+    uLongf size = compressBound(rawsize);
+    compressed.resize(size);
+    if (compress2(reinterpret_cast<Bytef*>(&compressed[0]), &size,
+                  reinterpret_cast<const Bytef*>(payload), rawsize, 1)==Z_OK
+        && size<rawsize)
+    {
+      payload    = &compressed[0];
+      storedsize = size;
+    }
+  }
+#endif
+
+  BinaryStream::Write(output, nevents);
+  BinaryStream::Write(output, rawsize);
+  BinaryStream::Write(output, storedsize);
+  if (storedsize!=0) output.write(payload, storedsize);
+  return output.good();
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadBlock
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadBlock(std::istream& input, UInt_t& nevents,
+                                  std::vector<char>& raw,
+                                  std::vector<char>& stored)
+{
+  UInt_t rawsize = 0, storedsize = 0;
+  if (!BinaryStream::Read(input, nevents))    return false;
+  if (!BinaryStream::Read(input, rawsize))    return false;
+  if (!BinaryStream::Read(input, storedsize)) return false;
+  if (nevents==0) return true;
+
+  // Uncompressed block
+  if (storedsize==rawsize)
+  {
+    raw.resize(rawsize);
+    if (rawsize!=0) input.read(&raw[0], rawsize);
+    return input.good();
+  }
+
+  // Compressed block
+  stored.resize(storedsize);
+  input.read(&stored[0], storedsize);
+  if (!input.good()) return false;
+#ifdef ZIP_USE
+  raw.resize(rawsize);
+  uLongf size = rawsize;
+  if (uncompress(reinterpret_cast<Bytef*>(&raw[0]), &size,
+                 reinterpret_cast<const Bytef*>(&stored[0]), 
+                 storedsize)!=Z_OK || size!=rawsize)
+  {
+    ERROR << "a block of the MA5 binary event file is corrupted" << endmsg;
+    return false;
+  }
+  return true;
+#else
+  ERROR << "the MA5 binary event file is compressed. Please set the ZIP_USE"
+        << " variable in the Makefile to 1 and recompile the program if"
+        << " you would like to read it." << endmsg;
+  return false;
+#endif
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteMC
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteMC(std::vector<char>& output, 
+                                const MCEventFormat& mc)
+{
+  // Event information
+  BinaryStream::Write(output, mc.nparts_);
+  BinaryStream::Write(output, mc.processId_);
+  BinaryStream::Write(output, mc.weight_);
+  BinaryStream::Write(output, mc.scale_);
+  BinaryStream::Write(output, mc.alphaQED_);
+  BinaryStream::Write(output, mc.alphaQCD_);
+  BinaryStream::Write(output, mc.PDFscale_);
+  BinaryStream::Write(output, mc.x_);
+  BinaryStream::Write(output, mc.xpdf_);
+  mc.ComputeGlobalSums();
+  BinaryStream::Write(output, mc.TET_);
+  BinaryStream::Write(output, mc.THT_);
+  WriteMomentum(output, mc.MET_.momentum());
+  WriteMomentum(output, mc.MHT_.momentum());
+
+  // Particles
+  BinaryStream::Write(output, static_cast<UInt_t>(mc.particles_.size()));
+  for (unsigned int i=0;i<mc.particles_.size();i++)
+  {
+    const MCParticleFormat& part = mc.particles_[i];
+    WriteMomentum(output, part.momentum());
+    BinaryStream::Write(output, part.ctau_);
+    BinaryStream::Write(output, part.spin_);
+    BinaryStream::Write(output, part.pdgid_);
+    BinaryStream::Write(output, part.statuscode_);
+    BinaryStream::Write(output, part.extra1_);
+    BinaryStream::Write(output, part.extra2_);
+    BinaryStream::Write(output, part.mothup1_);
+    BinaryStream::Write(output, part.mothup2_);
+    BinaryStream::Write(output, part.daughter1_);
+    BinaryStream::Write(output, part.daughter2_);
+    BinaryStream::Write(output, Index(part.mother1_,&mc));
+    BinaryStream::Write(output, Index(part.mother2_,&mc));
+    MCIndexSpan parents = mc.decays_.parents(i);
+    BinaryStream::Write(output, parents.size());
+    for (unsigned int j=0;j<parents.size();j++)
+      BinaryStream::Write(output, parents[j]);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadMC
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadMC(const char*& input, const char* end,
+                               MCEventFormat& mc)
+{
+  // Event information
+  if (!BinaryStream::Read(input, end, mc.nparts_))    return false;
+  if (!BinaryStream::Read(input, end, mc.processId_)) return false;
+  if (!BinaryStream::Read(input, end, mc.weight_))    return false;
+  if (!BinaryStream::Read(input, end, mc.scale_))     return false;
+  if (!BinaryStream::Read(input, end, mc.alphaQED_))  return false;
+  if (!BinaryStream::Read(input, end, mc.alphaQCD_))  return false;
+  if (!BinaryStream::Read(input, end, mc.PDFscale_))  return false;
+  if (!BinaryStream::Read(input, end, mc.x_))         return false;
+  if (!BinaryStream::Read(input, end, mc.xpdf_))      return false;
+  if (!BinaryStream::Read(input, end, mc.TET_))       return false;
+  if (!BinaryStream::Read(input, end, mc.THT_))       return false;
+  if (!ReadMomentum(input, end, mc.MET_.momentum()))  return false;
+  if (!ReadMomentum(input, end, mc.MHT_.momentum()))  return false;
+  mc.sums_ = MCEventFormat::SUMS_DONE;
+
+  // Particles (the collection is not resized afterwards: pointers are safe)
+  UInt_t n = 0;
+  if (!BinaryStream::Read(input, end, n)) return false;
+  mc.particles_.resize(n);
+  for (unsigned int i=0;i<n;i++)
+  {
+    MCParticleFormat& part = mc.particles_[i];
+    Int_t mother1=-1, mother2=-1;
+    UInt_t nparents=0;
+    if (!ReadMomentum(input, end, part.momentum()))         return false;
+    if (!BinaryStream::Read(input, end, part.ctau_))        return false;
+    if (!BinaryStream::Read(input, end, part.spin_))        return false;
+    if (!BinaryStream::Read(input, end, part.pdgid_))       return false;
+    if (!BinaryStream::Read(input, end, part.statuscode_))  return false;
+    if (!BinaryStream::Read(input, end, part.extra1_))      return false;
+    if (!BinaryStream::Read(input, end, part.extra2_))      return false;
+    if (!BinaryStream::Read(input, end, part.mothup1_))     return false;
+    if (!BinaryStream::Read(input, end, part.mothup2_))     return false;
+    if (!BinaryStream::Read(input, end, part.daughter1_))   return false;
+    if (!BinaryStream::Read(input, end, part.daughter2_))   return false;
+    if (!BinaryStream::Read(input, end, mother1))           return false;
+    if (!BinaryStream::Read(input, end, mother2))           return false;
+    if (!BinaryStream::Read(input, end, nparents))          return false;
+    part.mother1_ = Pointer(mother1,&mc);
+    part.mother2_ = Pointer(mother2,&mc);
+    for (unsigned int j=0;j<nparents;j++)
+    {
+      UInt_t index=0;
+      if (!BinaryStream::Read(input, end, index)) return false;
+      mc.decays_.AddEdge(index,i);
+    }
+  }
+
+  // Decay graph (the links are added in the order of the readers)
+  mc.decays_.Build(mc.particles_);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteRec
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteRec(std::vector<char>& output, 
+                                 const RecEventFormat& rec,
+                                 const MCEventFormat* mc)
+{
+  // Photons
+  BinaryStream::Write(output, static_cast<UInt_t>(rec.photons_.size()));
+  for (unsigned int i=0;i<rec.photons_.size();i++)
+  {
+    WriteRecParticle(output, rec.photons_[i], mc);
+    WriteCones(output, rec.photons_[i].isolCones_);
+  }
+
+  // Electrons and muons
+  for (unsigned int k=0;k<2;k++)
+  {
+    const std::vector<RecLeptonFormat>& leptons = 
+                      (k==0) ? rec.electrons_ : rec.muons_;
+    BinaryStream::Write(output, static_cast<UInt_t>(leptons.size()));
+    for (unsigned int i=0;i<leptons.size();i++)
+    {
+      WriteRecParticle(output, leptons[i], mc);
+      BinaryStream::Write(output, leptons[i].charge_);
+      BinaryStream::Write(output, leptons[i].sumET_isol_);
+      BinaryStream::Write(output, leptons[i].sumPT_isol_);
+      WriteCones(output, leptons[i].isolCones_);
+    }
+  }
+
+  // Taus
+  BinaryStream::Write(output, static_cast<UInt_t>(rec.taus_.size()));
+  for (unsigned int i=0;i<rec.taus_.size();i++)
+  {
+    WriteRecParticle(output, rec.taus_[i], mc);
+    BinaryStream::Write(output, rec.taus_[i].charge_);
+    BinaryStream::Write(output, rec.taus_[i].ntracks_);
+    BinaryStream::Write(output, rec.taus_[i].DecayMode_);
+  }
+
+  // Jets and generated jets
+  for (unsigned int k=0;k<2;k++)
+  {
+    const std::vector<RecJetFormat>& jets = (k==0) ? rec.jets_ : rec.genjets_;
+    BinaryStream::Write(output, static_cast<UInt_t>(jets.size()));
+    for (unsigned int i=0;i<jets.size();i++)
+    {
+      WriteRecParticle(output, jets[i], mc);
+      BinaryStream::Write(output, jets[i].ntracks_);
+      BinaryStream::Write(output, jets[i].btag_);
+      BinaryStream::Write(output, jets[i].true_ctag_);
+      BinaryStream::Write(output, jets[i].true_btag_);
+      BinaryStream::Write(output, 
+                          static_cast<UInt_t>(jets[i].Constituents_.size()));
+      for (unsigned int j=0;j<jets[i].Constituents_.size();j++)
+        BinaryStream::Write(output, jets[i].Constituents_[j]);
+      WriteCones(output, jets[i].isolCones_);
+    }
+  }
+
+  // Tracks
+  BinaryStream::Write(output, static_cast<UInt_t>(rec.tracks_.size()));
+  for (unsigned int i=0;i<rec.tracks_.size();i++)
+  {
+    WriteMomentum(output, rec.tracks_[i].momentum());
+    BinaryStream::Write(output, rec.tracks_[i].pdgid_);
+    BinaryStream::Write(output, rec.tracks_[i].charge_);
+    BinaryStream::Write(output, rec.tracks_[i].etaOuter_);
+    BinaryStream::Write(output, rec.tracks_[i].phiOuter_);
+    WriteCones(output, rec.tracks_[i].isolCones_);
+  }
+
+  // Global quantities
+  WriteRecParticle(output, rec.MET_, mc);
+  WriteRecParticle(output, rec.MHT_, mc);
+  BinaryStream::Write(output, rec.TET_);
+  BinaryStream::Write(output, rec.THT_);
+
+  // Monte Carlo particles found by the taggers
+  WriteLinks(output, rec.MCHadronicTaus_,   mc);
+  WriteLinks(output, rec.MCMuonicTaus_,     mc);
+  WriteLinks(output, rec.MCElectronicTaus_, mc);
+  WriteLinks(output, rec.MCBquarks_,        mc);
+  WriteLinks(output, rec.MCCquarks_,        mc);
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadRec
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadRec(const char*& input, const char* end,
+                                RecEventFormat& rec, MCEventFormat* mc)
+{
+  UInt_t n = 0;
+
+  // Photons
+  if (!BinaryStream::Read(input, end, n)) return false;
+  rec.photons_.resize(n);
+  for (unsigned int i=0;i<n;i++)
+  {
+    rec.photons_[i].SetArena(&rec.arena_);
+    if (!ReadRecParticle(input, end, rec.photons_[i], mc)) return false;
+    if (!ReadCones(input, end, rec.photons_[i].isolCones_)) return false;
+  }
+
+  // Electrons and muons
+  for (unsigned int k=0;k<2;k++)
+  {
+    std::vector<RecLeptonFormat>& leptons = (k==0) ? rec.electrons_ : rec.muons_;
+    if (!BinaryStream::Read(input, end, n)) return false;
+    leptons.resize(n);
+    for (unsigned int i=0;i<n;i++)
+    {
+      leptons[i].SetArena(&rec.arena_);
+      if (!ReadRecParticle(input, end, leptons[i], mc))              return false;
+      if (!BinaryStream::Read(input, end, leptons[i].charge_))       return false;
+      if (!BinaryStream::Read(input, end, leptons[i].sumET_isol_))   return false;
+      if (!BinaryStream::Read(input, end, leptons[i].sumPT_isol_))   return false;
+      if (!ReadCones(input, end, leptons[i].isolCones_))             return false;
+    }
+  }
+
+  // Taus
+  if (!BinaryStream::Read(input, end, n)) return false;
+  rec.taus_.resize(n);
+  for (unsigned int i=0;i<n;i++)
+  {
+    if (!ReadRecParticle(input, end, rec.taus_[i], mc))             return false;
+    if (!BinaryStream::Read(input, end, rec.taus_[i].charge_))      return false;
+    if (!BinaryStream::Read(input, end, rec.taus_[i].ntracks_))     return false;
+    if (!BinaryStream::Read(input, end, rec.taus_[i].DecayMode_))   return false;
+  }
+
+  // Jets and generated jets
+  for (unsigned int k=0;k<2;k++)
+  {
+    std::vector<RecJetFormat>& jets = (k==0) ? rec.jets_ : rec.genjets_;
+    if (!BinaryStream::Read(input, end, n)) return false;
+    jets.resize(n);
+    for (unsigned int i=0;i<n;i++)
+    {
+      UInt_t nconst = 0;
+      jets[i].SetArena(&rec.arena_);
+      if (!ReadRecParticle(input, end, jets[i], mc))              return false;
+      if (!BinaryStream::Read(input, end, jets[i].ntracks_))      return false;
+      if (!BinaryStream::Read(input, end, jets[i].btag_))         return false;
+      if (!BinaryStream::Read(input, end, jets[i].true_ctag_))    return false;
+      if (!BinaryStream::Read(input, end, jets[i].true_btag_))    return false;
+      if (!BinaryStream::Read(input, end, nconst))                return false;
+      jets[i].Constituents_.resize(nconst);
+      for (unsigned int j=0;j<nconst;j++)
+        if (!BinaryStream::Read(input, end, jets[i].Constituents_[j])) return false;
+      if (!ReadCones(input, end, jets[i].isolCones_))             return false;
+    }
+  }
+
+  // Tracks
+  if (!BinaryStream::Read(input, end, n)) return false;
+  rec.tracks_.resize(n);
+  for (unsigned int i=0;i<n;i++)
+  {
+    rec.tracks_[i].SetArena(&rec.arena_);
+    if (!ReadMomentum(input, end, rec.tracks_[i].momentum()))         return false;
+    if (!BinaryStream::Read(input, end, rec.tracks_[i].pdgid_))       return false;
+    if (!BinaryStream::Read(input, end, rec.tracks_[i].charge_))      return false;
+    if (!BinaryStream::Read(input, end, rec.tracks_[i].etaOuter_))    return false;
+    if (!BinaryStream::Read(input, end, rec.tracks_[i].phiOuter_))    return false;
+    if (!ReadCones(input, end, rec.tracks_[i].isolCones_))            return false;
+  }
+
+  // Global quantities
+  if (!ReadRecParticle(input, end, rec.MET_, mc)) return false;
+  if (!ReadRecParticle(input, end, rec.MHT_, mc)) return false;
+  if (!BinaryStream::Read(input, end, rec.TET_))  return false;
+  if (!BinaryStream::Read(input, end, rec.THT_))  return false;
+
+  // Monte Carlo particles found by the taggers
+  if (!ReadLinks(input, end, rec.MCHadronicTaus_,   mc)) return false;
+  if (!ReadLinks(input, end, rec.MCMuonicTaus_,     mc)) return false;
+  if (!ReadLinks(input, end, rec.MCElectronicTaus_, mc)) return false;
+  if (!ReadLinks(input, end, rec.MCBquarks_,        mc)) return false;
+  if (!ReadLinks(input, end, rec.MCCquarks_,        mc)) return false;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteRecParticle
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteRecParticle(std::vector<char>& output,
+                                         const RecParticleFormat& part,
+                                         const MCEventFormat* mc)
+{
+  WriteMomentum(output, part.momentum());
+  BinaryStream::Write(output, part.HEoverEE_);
+  BinaryStream::Write(output, Index(part.mc_,mc));
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadRecParticle
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadRecParticle(const char*& input, const char* end,
+                                        RecParticleFormat& part, 
+                                        MCEventFormat* mc)
+{
+  Int_t index=-1;
+  if (!ReadMomentum(input, end, part.momentum()))     return false;
+  if (!BinaryStream::Read(input, end, part.HEoverEE_)) return false;
+  if (!BinaryStream::Read(input, end, index))          return false;
+  part.mc_ = Pointer(index,mc);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteCones
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteCones(std::vector<char>& output,
+                           const ArenaVector<IsolationConeType>& cones)
+{
+  BinaryStream::Write(output, static_cast<UInt_t>(cones.size()));
+  for (unsigned int i=0;i<cones.size();i++)
+  {
+    BinaryStream::Write(output, cones[i].ntracks_);
+    BinaryStream::Write(output, cones[i].sumPT_);
+    BinaryStream::Write(output, cones[i].sumET_);
+    BinaryStream::Write(output, cones[i].deltaR_);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadCones
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadCones(const char*& input, const char* end,
+                                  ArenaVector<IsolationConeType>& cones)
+{
+  UInt_t n = 0;
+  if (!BinaryStream::Read(input, end, n)) return false;
+  cones.resize(n);
+  for (unsigned int i=0;i<n;i++)
+  {
+    if (!BinaryStream::Read(input, end, cones[i].ntracks_)) return false;
+    if (!BinaryStream::Read(input, end, cones[i].sumPT_))   return false;
+    if (!BinaryStream::Read(input, end, cones[i].sumET_))   return false;
+    if (!BinaryStream::Read(input, end, cones[i].deltaR_))  return false;
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteLinks
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteLinks(std::vector<char>& output,
+                        const std::vector<const MCParticleFormat*>& links,
+                        const MCEventFormat* mc)
+{
+  BinaryStream::Write(output, static_cast<UInt_t>(links.size()));
+  for (unsigned int i=0;i<links.size();i++)
+    BinaryStream::Write(output, Index(links[i],mc));
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadLinks
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadLinks(const char*& input, const char* end,
+                        std::vector<const MCParticleFormat*>& links,
+                        MCEventFormat* mc)
+{
+  UInt_t n = 0;
+  if (!BinaryStream::Read(input, end, n)) return false;
+  links.resize(n);
+  for (unsigned int i=0;i<n;i++)
+  {
+    Int_t index=-1;
+    if (!BinaryStream::Read(input, end, index)) return false;
+    links[i] = Pointer(index,mc);
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteMomentum
+// -----------------------------------------------------------------------------
+void BinaryEventFormat::WriteMomentum(std::vector<char>& output,
+                                      const MALorentzVector& p)
+{
+  BinaryStream::Write(output, static_cast<Double_t>(p.Px()));
+  BinaryStream::Write(output, static_cast<Double_t>(p.Py()));
+  BinaryStream::Write(output, static_cast<Double_t>(p.Pz()));
+  BinaryStream::Write(output, static_cast<Double_t>(p.E()));
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadMomentum
+// -----------------------------------------------------------------------------
+bool BinaryEventFormat::ReadMomentum(const char*& input, const char* end,
+                                     MALorentzVector& p)
+{
+  Double_t px=0., py=0., pz=0., e=0.;
+  if (!BinaryStream::Read(input, end, px)) return false;
+  if (!BinaryStream::Read(input, end, py)) return false;
+  if (!BinaryStream::Read(input, end, pz)) return false;
+  if (!BinaryStream::Read(input, end, e))  return false;
+  p.SetPxPyPzE(px,py,pz,e);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Index
+// -----------------------------------------------------------------------------
+Int_t BinaryEventFormat::Index(const MCParticleFormat* part, 
+                               const MCEventFormat* mc)
+{
+  if (part==0 || mc==0 || mc->particles_.empty()) return -1;
+  const MCParticleFormat* first = &mc->particles_[0];
+  if (part<first || part>=first+mc->particles_.size()) return -1;
+  return static_cast<Int_t>(part-first);
+}
+
+
+// -----------------------------------------------------------------------------
+// Pointer
+// -----------------------------------------------------------------------------
+MCParticleFormat* BinaryEventFormat::Pointer(Int_t index, MCEventFormat* mc)
+{
+  if (index<0 || mc==0) return 0;
+  if (static_cast<UInt_t>(index)>=mc->particles_.size()) return 0;
+  return &mc->particles_[index];
+}
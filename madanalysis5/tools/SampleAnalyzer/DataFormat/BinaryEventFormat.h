@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BINARY_EVENT_FORMAT_H
+#define BINARY_EVENT_FORMAT_H
+
+// STL headers
+#include <iostream>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/EventFormat.h"
+#include "SampleAnalyzer/DataFormat/SampleFormat.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Encoding of samples and events in the native MA5 binary format.
+/// Every quantity filled by the readers is stored (including MET, MHT, TET,
+/// THT), and the links between particles are stored as indices, so that a 
+/// decoded event does not need to be finalized again.
+//////////////////////////////////////////////////////////////////////////////
+class BinaryEventFormat
+{
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Tag at the beginning of the files
+  static const char Magic[8];
+
+  /// Version of the encoding
+  static const UInt_t Version;
+
+  /// Tag at the end of the event stores (after the index of the events)
+  static const char IndexMagic[8];
+
+  /// Writing the tag, the version and the sample description
+  static void WriteSample(std::ostream& output, const SampleFormat& mySample);
+
+  /// Reading the tag, the version and the sample description
+  static bool ReadSample(std::istream& input, SampleFormat& mySample);
+
+  /// Appending an event to a buffer
+  static void WriteEvent(std::vector<char>& output, const EventFormat& myEvent);
+
+  /// Decoding an event from a buffer (the cursor is moved forward)
+  static bool ReadEvent(const char*& input, const char* end, 
+                        EventFormat& myEvent);
+
+  /// Writing a block of events: [nevents][raw size][stored size][payload].
+  /// On request, the payload is compressed with zlib when it is worth it
+  /// (smaller files, but inflating costs more than decoding the events).
+  /// A block with nevents=0 closes the file.
+  static bool WriteBlock(std::ostream& output, UInt_t nevents,
+                         const std::vector<char>& raw, bool compress=false);
+
+  /// Reading a block of events (nevents=0 at the end of the file)
+  static bool ReadBlock(std::istream& input, UInt_t& nevents,
+                        std::vector<char>& raw, std::vector<char>& stored);
+
+ private :
+
+  /// Generated particles
+  static void WriteMC(std::vector<char>& output, const MCEventFormat& mc);
+  static bool ReadMC(const char*& input, const char* end, MCEventFormat& mc);
+
+  /// Reconstructed objects
+  static void WriteRec(std::vector<char>& output, const RecEventFormat& rec,
+                       const MCEventFormat* mc);
+  static bool ReadRec(const char*& input, const char* end, 
+                      RecEventFormat& rec, MCEventFormat* mc);
+
+  /// Common part of the reconstructed objects
+  static void WriteRecParticle(std::vector<char>& output, 
+                               const RecParticleFormat& part,
+                               const MCEventFormat* mc);
+  static bool ReadRecParticle(const char*& input, const char* end,
+                              RecParticleFormat& part, MCEventFormat* mc);
+
+  /// Isolation cones
+  static void WriteCones(std::vector<char>& output, 
+                         const ArenaVector<IsolationConeType>& cones);
+  static bool ReadCones(const char*& input, const char* end,
+                        ArenaVector<IsolationConeType>& cones);
+
+  /// Collection of pointers to generated particles
+  static void WriteLinks(std::vector<char>& output,
+                         const std::vector<const MCParticleFormat*>& links,
+                         const MCEventFormat* mc);
+  static bool ReadLinks(const char*& input, const char* end,
+                        std::vector<const MCParticleFormat*>& links,
+                        MCEventFormat* mc);
+
+  /// Four-momentum
+  static void WriteMomentum(std::vector<char>& output, const MALorentzVector& p);
+  static bool ReadMomentum(const char*& input, const char* end, 
+                           MALorentzVector& p);
+
+  /// Index of a generated particle (-1 if null or not in the event)
+  static Int_t Index(const MCParticleFormat* part, const MCEventFormat* mc);
+
+  /// Generated particle from its index
+  static MCParticleFormat* Pointer(Int_t index, MCEventFormat* mc);
+
+};
+
+}
+
+#endif
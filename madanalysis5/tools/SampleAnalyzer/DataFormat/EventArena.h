@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EventArena_h
+#define EventArena_h
+
+// STL headers
+#include <vector>
+#include <cstddef>
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Bump allocator holding the small per-event buffers (daughter lists,
+/// jet constituents, isolation cones). The memory is never given back 
+/// individually: Reset() rewinds the arena at the beginning of each event
+/// and the blocks are reused, so that no heap allocation is done once the
+/// largest event has been seen.
+//////////////////////////////////////////////////////////////////////////////
+class EventArena
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Memory blocks (kept from one event to the next)
+  std::vector<char*>  blocks_;
+
+  /// Size of the memory blocks
+  std::vector<UInt_t> sizes_;
+
+  /// Index of the block being filled
+  UInt_t current_;
+
+  /// First free byte in the block being filled
+  UInt_t offset_;
+
+  /// Default size of a memory block
+  static const UInt_t BlockSize = 65536;
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  EventArena()
+  { current_=0; offset_=0; }
+
+  /// Copy constructor: the blocks are never shared
+  EventArena(const EventArena&)
+  { current_=0; offset_=0; }
+
+  /// Destructor
+  ~EventArena()
+  {
+    for (unsigned int i=0;i<blocks_.size();i++) delete [] blocks_[i];
+  }
+
+  /// Assignment: the blocks are never shared
+  EventArena& operator=(const EventArena&)
+  { return *this; }
+
+  /// Giving a buffer of size bytes (aligned on 8 bytes)
+  void* Allocate(std::size_t size)
+  {
+    size = (size+7) & ~static_cast<std::size_t>(7);
+    while (current_<blocks_.size())
+    {
+      if (offset_+size<=sizes_[current_])
+      {
+        void* ptr = blocks_[current_]+offset_;
+        offset_+=size;
+        return ptr;
+      }
+      current_++;
+      offset_=0;
+    }
+    UInt_t blocksize = (size>BlockSize) ? size : BlockSize;
+    blocks_.push_back(new char[blocksize]);
+    sizes_.push_back(blocksize);
+    current_ = blocks_.size()-1;
+    offset_  = size;
+    return blocks_.back();
+  }
+
+  /// Rewinding the arena: all the buffers given before are released
+  void Reset()
+  { current_=0; offset_=0; }
+
+  /// Memory reserved by the arena (in bytes)
+  ULong64_t GetCapacity() const
+  {
+    ULong64_t capacity=0;
+    for (unsigned int i=0;i<sizes_.size();i++) capacity+=sizes_[i];
+    return capacity;
+  }
+
+};
+
+}
+
+#endif
@@ -30,11 +30,13 @@
 #include <sstream>
 #include <string>
 #include <iomanip>
+#include <algorithm>
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/DataFormat/MCEventFormat.h"
 #include "SampleAnalyzer/DataFormat/RecEventFormat.h"
 #include "SampleAnalyzer/Service/LogService.h"
+#include "SampleAnalyzer/Service/RandomStream.h"
 
 
 namespace MA5
@@ -63,6 +65,9 @@ class EventFormat
   /// pointer to generated particles
   MCEventFormat  * mc_;
 
+  /// random stream of the event (efficiencies, mis-identifications)
+  RandomStream random_;
+
   // -------------------------------------------------------------
   //                      method members
   // -------------------------------------------------------------
@@ -92,6 +97,9 @@ class EventFormat
   /// Accessor to reconstructed objects
   RecEventFormat * rec()  {return rec_;}
 
+  /// Accessor to the random stream of the event
+  RandomStream& random() {return random_;}
+
   /// Initializing the pointer to generated particles
   void InitializeMC()
   {
@@ -112,6 +120,14 @@ class EventFormat
     else rec_=new RecEventFormat();
   }
 
+  /// Exchanging the content with another event (no copy)
+  void Swap(EventFormat& other)
+  {
+    std::swap(rec_,other.rec_);
+    std::swap(mc_,other.mc_);
+    std::swap(random_,other.random_);
+  }
+
   /// Free allocated memory
   void Delete()
   {
@@ -43,6 +43,7 @@ class DelphesTreeReader;
 class DelfesTreeReader;
 class DetectorDelphes;
 class DetectorDelfes;
+class BinaryEventFormat;
 
 class IsolationConeType
 {
@@ -57,6 +58,7 @@ class IsolationConeType
   friend class DetectorDelfes;
   friend class DelphesTreeReader;
   friend class DelfesTreeReader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
@@ -0,0 +1,333 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MALorentzVector_h
+#define MALorentzVector_h
+
+// STL headers
+#include <cmath>
+
+// ROOT headers
+#include <TLorentzVector.h>
+#include <TVector3.h>
+
+
+namespace MA5
+{
+
+/// Storage type of the momentum components. With the compilation flag 
+/// SINGLE_PRECISION_USE (installation option single_precision), they are
+/// stored as float, halving the size of the vector (32 bytes instead of 64).
+/// The computations and the returned values stay in double precision.
+#ifdef SINGLE_PRECISION_USE
+  typedef Float_t MAFloat_t;
+#else
+  typedef Double_t MAFloat_t;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+/// Compact 4-vector (px,py,pz,e) storing the momentum of the particles.
+/// Unlike TLorentzVector, it has no virtual table and the transverse 
+/// kinematics (pt, eta, phi) are computed on the first request and kept
+/// until the vector is modified. The methods follow the TLorentzVector
+/// interface and formulas, and the vector converts to a TLorentzVector.
+//////////////////////////////////////////////////////////////////////////////
+class MALorentzVector
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Components
+  MAFloat_t px_;
+  MAFloat_t py_;
+  MAFloat_t pz_;
+  MAFloat_t e_;
+
+  /// Cached transverse kinematics
+  mutable MAFloat_t pt_;
+  mutable MAFloat_t eta_;
+  mutable MAFloat_t phi_;
+
+  /// Which cached values are valid
+  mutable UInt_t cached_;
+
+  enum { PT_CACHED=1, ETA_CACHED=2, PHI_CACHED=4 };
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor
+  MALorentzVector(Double_t px=0., Double_t py=0., Double_t pz=0., Double_t e=0.)
+  { px_=px; py_=py; pz_=pz; e_=e; cached_=0; }
+
+  /// Constructor from a 3-vector and the energy
+  MALorentzVector(const TVector3& p, Double_t e)
+  { px_=p.X(); py_=p.Y(); pz_=p.Z(); e_=e; cached_=0; }
+
+  /// Constructor from a ROOT 4-vector
+  explicit MALorentzVector(const TLorentzVector& p)
+  { px_=p.Px(); py_=p.Py(); pz_=p.Pz(); e_=p.E(); cached_=0; }
+
+  /// Assignment from a ROOT 4-vector
+  MALorentzVector& operator=(const TLorentzVector& p)
+  { SetPxPyPzE(p.Px(),p.Py(),p.Pz(),p.E()); return *this; }
+
+  /// Conversion to a ROOT 4-vector
+  operator TLorentzVector() const
+  { return TLorentzVector(px_,py_,pz_,e_); }
+
+  /// Components
+  Double_t Px() const { return px_; }
+  Double_t Py() const { return py_; }
+  Double_t Pz() const { return pz_; }
+  Double_t E()  const { return e_;  }
+  Double_t X()  const { return px_; }
+  Double_t Y()  const { return py_; }
+  Double_t Z()  const { return pz_; }
+  Double_t T()  const { return e_;  }
+
+  /// Transverse momentum (cached)
+  Double_t Pt() const
+  {
+    if ((cached_ & PT_CACHED)==0)
+    {
+      pt_ = std::sqrt(Perp2());
+      cached_ |= PT_CACHED;
+    }
+    return pt_;
+  }
+  Double_t Perp()  const { return Pt(); }
+  Double_t Perp2() const { return Px()*Px()+Py()*Py(); }
+
+  /// Azimuthal angle in [-pi,pi] (cached)
+  Double_t Phi() const
+  {
+    if ((cached_ & PHI_CACHED)==0)
+    {
+      phi_ = (px_==0. && py_==0.) ? 0. : std::atan2(Py(),Px());
+      cached_ |= PHI_CACHED;
+    }
+    return phi_;
+  }
+
+  /// Pseudo-rapidity (cached)
+  Double_t Eta() const
+  {
+    if ((cached_ & ETA_CACHED)==0)
+    {
+      Double_t cosTheta = CosTheta();
+      if (cosTheta*cosTheta<1.) eta_ = -0.5*std::log((1.-cosTheta)/(1.+cosTheta));
+      else if (pz_==0.)         eta_ = 0.;
+      else if (pz_>0.)          eta_ = 10e10;
+      else                      eta_ = -10e10;
+      cached_ |= ETA_CACHED;
+    }
+    return eta_;
+  }
+  Double_t PseudoRapidity() const { return Eta(); }
+
+  /// Momentum magnitude
+  Double_t P()    const { return std::sqrt(P2()); }
+  Double_t P2()   const { return Px()*Px()+Py()*Py()+Pz()*Pz(); }
+  Double_t Rho()  const { return P(); }
+
+  /// Invariant mass (negative for space-like vectors)
+  Double_t M2()   const { return E()*E()-P2(); }
+  Double_t Mag2() const { return M2(); }
+  Double_t M()    const
+  {
+    Double_t mm = M2();
+    return mm<0. ? -std::sqrt(-mm) : std::sqrt(mm);
+  }
+  Double_t Mag()  const { return M(); }
+
+  /// Transverse mass, as defined by ROOT (e^2-pz^2)
+  Double_t Mt2()  const { return E()*E()-Pz()*Pz(); }
+  Double_t Mt()   const
+  {
+    Double_t mm = Mt2();
+    return mm<0. ? -std::sqrt(-mm) : std::sqrt(mm);
+  }
+
+  /// Transverse energy
+  Double_t Et2()  const
+  {
+    Double_t pt2 = Perp2();
+    return pt2==0. ? 0. : E()*E()*pt2/(pt2+Pz()*Pz());
+  }
+  Double_t Et()   const
+  {
+    Double_t etet = Et2();
+    return e_<0. ? -std::sqrt(etet) : std::sqrt(etet);
+  }
+
+  /// Polar angle
+  Double_t CosTheta() const
+  {
+    Double_t ptot = P();
+    return ptot==0. ? 1. : Pz()/ptot;
+  }
+  Double_t Theta() const
+  { return (px_==0. && py_==0. && pz_==0.) ? 0. : std::atan2(Pt(),Pz()); }
+
+  /// Rapidity
+  Double_t Rapidity() const
+  { return 0.5*std::log((E()+Pz())/(E()-Pz())); }
+
+  /// Relativistic parameters
+  Double_t Beta()  const { return P()/E(); }
+  Double_t Gamma() const
+  {
+    Double_t b = Beta();
+    return 1./std::sqrt((1.-b)*(1.+b));
+  }
+
+  /// 3-vectors
+  TVector3 Vect()        const { return TVector3(px_,py_,pz_); }
+  TVector3 BoostVector() const { return TVector3(Px()/E(),Py()/E(),Pz()/E()); }
+
+  /// Difference of azimuthal angles in [-pi,pi]
+  Double_t DeltaPhi(const MALorentzVector& v) const
+  { return PhiMPiPi(Phi()-v.Phi()); }
+
+  /// Distance in the (eta,phi) plane
+  Double_t DeltaR(const MALorentzVector& v) const
+  {
+    Double_t deta = Eta()-v.Eta();
+    Double_t dphi = DeltaPhi(v);
+    return std::sqrt(deta*deta+dphi*dphi);
+  }
+
+  /// Angle with a 3-vector
+  Double_t Angle(const TVector3& q) const
+  {
+    Double_t ptot2 = P2()*q.Mag2();
+    if (ptot2<=0.) return 0.;
+    Double_t arg = (Px()*q.X()+Py()*q.Y()+Pz()*q.Z())/std::sqrt(ptot2);
+    if (arg> 1.) arg= 1.;
+    if (arg<-1.) arg=-1.;
+    return std::acos(arg);
+  }
+
+  /// Minkowski product
+  Double_t Dot(const MALorentzVector& v) const
+  { return E()*v.E()-Px()*v.Px()-Py()*v.Py()-Pz()*v.Pz(); }
+
+  /// Setting the components (the cache is cleared)
+  void SetPxPyPzE(Double_t px, Double_t py, Double_t pz, Double_t e)
+  { px_=px; py_=py; pz_=pz; e_=e; cached_=0; }
+  void SetXYZT(Double_t x, Double_t y, Double_t z, Double_t t)
+  { SetPxPyPzE(x,y,z,t); }
+  void SetPx(Double_t v) { px_=v; cached_=0; }
+  void SetPy(Double_t v) { py_=v; cached_=0; }
+  void SetPz(Double_t v) { pz_=v; cached_&=~ETA_CACHED; }
+  void SetE (Double_t v) { e_=v; }
+  void SetX (Double_t v) { SetPx(v); }
+  void SetY (Double_t v) { SetPy(v); }
+  void SetZ (Double_t v) { SetPz(v); }
+  void SetT (Double_t v) { SetE(v);  }
+
+  void SetXYZM(Double_t x, Double_t y, Double_t z, Double_t m)
+  {
+    if (m>=0.) SetXYZT(x,y,z,std::sqrt(x*x+y*y+z*z+m*m));
+    else
+    {
+      Double_t e2 = x*x+y*y+z*z-m*m;
+      SetXYZT(x,y,z,std::sqrt(e2>0. ? e2 : 0.));
+    }
+  }
+  void SetPtEtaPhiM(Double_t pt, Double_t eta, Double_t phi, Double_t m)
+  {
+    pt = std::fabs(pt);
+    SetXYZM(pt*std::cos(phi), pt*std::sin(phi), pt*std::sinh(eta), m);
+  }
+  void SetPtEtaPhiE(Double_t pt, Double_t eta, Double_t phi, Double_t e)
+  {
+    pt = std::fabs(pt);
+    SetXYZT(pt*std::cos(phi), pt*std::sin(phi), pt*std::sinh(eta), e);
+  }
+  void SetVectM(const TVector3& p, Double_t m)
+  { SetXYZM(p.X(),p.Y(),p.Z(),m); }
+
+  /// Lorentz boost
+  void Boost(Double_t bx, Double_t by, Double_t bz)
+  {
+    Double_t b2 = bx*bx+by*by+bz*bz;
+    Double_t gamma  = 1./std::sqrt(1.-b2);
+    Double_t bp     = bx*px_+by*py_+bz*pz_;
+    Double_t gamma2 = b2>0. ? (gamma-1.)/b2 : 0.;
+    SetPxPyPzE(px_+gamma2*bp*bx+gamma*bx*e_,
+               py_+gamma2*bp*by+gamma*by*e_,
+               pz_+gamma2*bp*bz+gamma*bz*e_,
+               gamma*(e_+bp));
+  }
+  void Boost(const TVector3& b)
+  { Boost(b.X(),b.Y(),b.Z()); }
+
+  /// Arithmetic
+  MALorentzVector operator+(const MALorentzVector& v) const
+  { return MALorentzVector(px_+v.px_,py_+v.py_,pz_+v.pz_,e_+v.e_); }
+  MALorentzVector operator-(const MALorentzVector& v) const
+  { return MALorentzVector(px_-v.px_,py_-v.py_,pz_-v.pz_,e_-v.e_); }
+  MALorentzVector operator-() const
+  { return MALorentzVector(-px_,-py_,-pz_,-e_); }
+  MALorentzVector operator*(Double_t a) const
+  { return MALorentzVector(a*px_,a*py_,a*pz_,a*e_); }
+  Double_t operator*(const MALorentzVector& v) const
+  { return Dot(v); }
+
+  MALorentzVector& operator+=(const MALorentzVector& v)
+  { SetPxPyPzE(px_+v.px_,py_+v.py_,pz_+v.pz_,e_+v.e_); return *this; }
+  MALorentzVector& operator-=(const MALorentzVector& v)
+  { SetPxPyPzE(px_-v.px_,py_-v.py_,pz_-v.pz_,e_-v.e_); return *this; }
+  MALorentzVector& operator*=(Double_t a)
+  { SetPxPyPzE(a*px_,a*py_,a*pz_,a*e_); return *this; }
+
+  bool operator==(const MALorentzVector& v) const
+  { return px_==v.px_ && py_==v.py_ && pz_==v.pz_ && e_==v.e_; }
+  bool operator!=(const MALorentzVector& v) const
+  { return !(*this==v); }
+
+  /// Bringing an angle in [-pi,pi[ (as TVector2::Phi_mpi_pi)
+  static Double_t PhiMPiPi(Double_t x)
+  {
+    const Double_t pi = 3.14159265358979323846;
+    while (x>=pi) x-=2.*pi;
+    while (x<-pi) x+=2.*pi;
+    return x;
+  }
+
+};
+
+inline MALorentzVector operator*(Double_t a, const MALorentzVector& v)
+{ return v*a; }
+
+}
+
+#endif
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCDecayGraph.h"
+#include "SampleAnalyzer/DataFormat/MCParticleFormat.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Build
+// -----------------------------------------------------------------------------
+void MCDecayGraph::Build(std::vector<MCParticleFormat>& particles)
+{
+  size_      = particles.size();
+  particles_ = particles.empty() ? 0 : &particles[0];
+  ancestryGenerator_ = -1;
+
+  // Removing the links pointing outside the collection
+  UInt_t n = 0;
+  for (UInt_t i=0;i<edges_.size();i++)
+  {
+    if (edges_[i].first>=size_ || edges_[i].second>=size_) continue;
+    edges_[n++]=edges_[i];
+  }
+  edges_.resize(n);
+
+  // Tables
+  Fill(parentOffsets_, parents_,  true);
+  Fill(childOffsets_,  children_, false);
+
+  // Attaching the particles
+  for (UInt_t i=0;i<size_;i++)
+  {
+    particles[i].graph_ = this;
+    particles[i].index_ = i;
+  }
+  built_ = true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Fill
+// -----------------------------------------------------------------------------
+void MCDecayGraph::Fill(std::vector<UInt_t>& offsets, 
+                        std::vector<UInt_t>& table, bool bydaughter)
+{
+  // Counting the links of each particle
+  offsets.assign(size_+1,0);
+  for (UInt_t i=0;i<edges_.size();i++)
+  {
+    UInt_t key = bydaughter ? edges_[i].second : edges_[i].first;
+    offsets[key+1]++;
+  }
+  for (UInt_t i=0;i<size_;i++) offsets[i+1]+=offsets[i];
+
+  // Placing the links, keeping their order
+  cursor_.assign(offsets.begin(),offsets.end()-1);
+  table.resize(edges_.size());
+  for (UInt_t i=0;i<edges_.size();i++)
+  {
+    UInt_t key   = bydaughter ? edges_[i].second : edges_[i].first;
+    UInt_t value = bydaughter ? edges_[i].first  : edges_[i].second;
+    table[cursor_[key]++] = value;
+  }
+}
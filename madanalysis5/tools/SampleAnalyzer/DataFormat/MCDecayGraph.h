@@ -0,0 +1,372 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MCDecayGraph_h
+#define MCDecayGraph_h
+
+// STL headers
+#include <vector>
+#include <utility>
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+class MCParticleFormat;
+
+//////////////////////////////////////////////////////////////////////////////
+/// Contiguous range of particle indices in the decay graph
+//////////////////////////////////////////////////////////////////////////////
+class MCIndexSpan
+{
+ private :
+
+  const UInt_t* begin_;
+  const UInt_t* end_;
+
+ public :
+
+  /// Constructor without argument (empty range)
+  MCIndexSpan()
+  { begin_=0; end_=0; }
+
+  /// Constructor from the bounds of the range
+  MCIndexSpan(const UInt_t* begin, const UInt_t* end)
+  { begin_=begin; end_=end; }
+
+  /// Bounds of the range
+  const UInt_t* begin() const { return begin_; }
+  const UInt_t* end()   const { return end_;   }
+
+  /// Number of indices
+  UInt_t size() const
+  { return static_cast<UInt_t>(end_-begin_); }
+
+  /// Is the range empty ?
+  bool empty() const
+  { return begin_==end_; }
+
+  /// Accessor to an index
+  UInt_t operator[](UInt_t i) const
+  { return begin_[i]; }
+};
+
+
+//////////////////////////////////////////////////////////////////////////////
+/// Genealogy of the generated particles of an event, stored as two 
+/// compressed-sparse-row tables: the parents (resp. children) of the 
+/// particle i are parents_[parentOffsets_[i]] ... parents_[parentOffsets_[i+1]-1].
+///
+/// The readers add the mother-daughter links with AddEdge() while reading
+/// the event, then call Build() once. The particles are designated by their 
+/// index in the particle collection, which is stable as long as the 
+/// collection is not modified.
+//////////////////////////////////////////////////////////////////////////////
+class MCDecayGraph
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Number of particles
+  UInt_t size_;
+
+  /// Is the graph built ?
+  bool built_;
+
+  /// First particle of the collection
+  MCParticleFormat* particles_;
+
+  /// Links (mother, daughter) in the order they are added
+  std::vector< std::pair<UInt_t,UInt_t> > edges_;
+
+  /// Parent table
+  std::vector<UInt_t> parentOffsets_;
+  std::vector<UInt_t> parents_;
+
+  /// Children table
+  std::vector<UInt_t> childOffsets_;
+  std::vector<UInt_t> children_;
+
+  /// Working space used by Build()
+  std::vector<UInt_t> cursor_;
+
+  /// Ancestry flags of the particles cached by LoopService, and the 
+  /// generator they have been computed for (-1 if not computed)
+  mutable std::vector<UChar_t> ancestry_;
+  mutable Int_t                ancestryGenerator_;
+
+  /// Working space of the walks (see Walker): queue of the particles, 
+  /// and generation of the last walk which has visited each particle
+  mutable std::vector<UInt_t>  walkQueue_;
+  mutable std::vector<UInt_t>  walkVisited_;
+  mutable UInt_t               walkGeneration_;
+  mutable bool                 walking_;
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  MCDecayGraph()
+  { 
+    size_=0; built_=false; particles_=0; ancestryGenerator_=-1;
+    walkGeneration_=0; walking_=false;
+  }
+
+  /// Copy constructor: the links are copied but the graph must be rebuilt 
+  /// on the new particle collection
+  MCDecayGraph(const MCDecayGraph& graph)
+  { 
+    size_=0; built_=false; particles_=0; ancestryGenerator_=-1;
+    walkGeneration_=0; walking_=false;
+    edges_=graph.edges_;
+  }
+
+  /// Assignment operator (same remark)
+  MCDecayGraph& operator=(const MCDecayGraph& graph)
+  {
+    if (this==&graph) return *this;
+    size_=0; built_=false; particles_=0; ancestryGenerator_=-1;
+    edges_=graph.edges_;
+    return *this;
+  }
+
+  /// Clearing the graph (the capacity of the tables is kept)
+  void Clear()
+  { 
+    size_=0; built_=false; particles_=0; ancestryGenerator_=-1;
+    edges_.clear();
+  }
+
+  /// Adding a mother-daughter link. The same link can be added twice 
+  /// (mother1 and mother2 are often the same particle): the particle is 
+  /// then listed twice among the daughters and among the mothers.
+  void AddEdge(UInt_t mother, UInt_t daughter)
+  { edges_.push_back(std::pair<UInt_t,UInt_t>(mother,daughter)); }
+
+  /// Building the tables from the links, and attaching the particles to 
+  /// the graph. The order of the parents and of the children is the order 
+  /// in which the links have been added.
+  void Build(std::vector<MCParticleFormat>& particles);
+
+  /// Is the graph built ?
+  bool IsBuilt() const
+  { return built_; }
+
+  /// Number of particles
+  UInt_t size() const
+  { return size_; }
+
+  /// Number of mother-daughter links
+  UInt_t nedges() const
+  { return built_ ? static_cast<UInt_t>(children_.size()) : 0; }
+
+  /// First particle of the collection (the particle i is particles()[i])
+  MCParticleFormat* particles() const
+  { return particles_; }
+
+  /// Indices of the parents of the particle i
+  MCIndexSpan parents(UInt_t i) const
+  { return Span(parents_,parentOffsets_,i); }
+
+  /// Indices of the children of the particle i
+  MCIndexSpan children(UInt_t i) const
+  { return Span(children_,childOffsets_,i); }
+
+  /// Index of the first parent of the particle i (-1 if none)
+  Int_t mother1(UInt_t i) const
+  {
+    if (!built_ || parentOffsets_[i]==parentOffsets_[i+1]) return -1;
+    return static_cast<Int_t>(parents_[parentOffsets_[i]]);
+  }
+
+  /// Has the particle i several distinct parents ?
+  bool HasSeveralParents(UInt_t i) const
+  {
+    MCIndexSpan mothers = parents(i);
+    for (UInt_t j=1;j<mothers.size();j++)
+      if (mothers[j]!=mothers[0]) return true;
+    return false;
+  }
+
+
+  /// Ancestry flags of the particles computed for the generator, 0 if they
+  /// are not available yet (see LoopService)
+  const UChar_t* ancestry(Int_t generator) const
+  {
+    if (!built_ || size_==0 || ancestryGenerator_!=generator) return 0;
+    return &ancestry_[0];
+  }
+
+  /// Table where the ancestry flags computed for the generator are stored
+  /// (one entry per particle, set to 0). The cache lives until the next 
+  /// Build().
+  UChar_t* SetAncestry(Int_t generator) const
+  {
+    ancestry_.assign(size_,0);
+    ancestryGenerator_ = generator;
+    return size_==0 ? 0 : &ancestry_[0];
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////
+  /// Breadth-first walk through the ancestors or the descendants of a 
+  /// particle. Each particle is visited once, the starting particle is not
+  /// visited. The walk uses the working space of the graph (a particle is
+  /// visited when it is marked with the generation of the walk), or its 
+  /// own one when another walk through the graph is going on.
+  ///
+  ///   for (MCDecayGraph::DescendantIterator it(graph,i); !it.IsDone(); ++it)
+  ///     ... graph.particles()[*it] is a descendant ...
+  //////////////////////////////////////////////////////////////////////////
+  class Walker
+  {
+   private :
+
+    const MCDecayGraph*  graph_;
+    bool                 up_;
+    bool                 borrowed_;
+    std::vector<UInt_t>* queue_;
+    std::vector<UInt_t>* visited_;
+    UInt_t               mark_;
+    UInt_t               pos_;
+
+    /// Working space when the one of the graph is used
+    std::vector<UInt_t>  ownQueue_;
+    std::vector<UInt_t>  ownVisited_;
+
+    void Expand(UInt_t i)
+    {
+      MCIndexSpan next = up_ ? graph_->parents(i) : graph_->children(i);
+      std::vector<UInt_t>& visited = *visited_;
+      for (const UInt_t* it=next.begin(); it!=next.end(); it++)
+      {
+        if (visited[*it]==mark_) continue;
+        visited[*it]=mark_;
+        queue_->push_back(*it);
+      }
+    }
+
+    /// Not copyable (the working space of the graph is released once)
+    Walker(const Walker&);
+    Walker& operator=(const Walker&);
+
+   protected :
+
+    Walker(const MCDecayGraph& graph, UInt_t start, bool up)
+    {
+      graph_=&graph; up_=up; pos_=0; mark_=1; borrowed_=false;
+      queue_=&ownQueue_; visited_=&ownVisited_;
+      if (!graph.IsBuilt() || start>=graph.size()) return;
+
+      // Borrowing the working space of the graph: the marks of the 
+      // previous walks are never equal to the new generation
+      if (!graph.walking_)
+      {
+        borrowed_=true;
+        graph.walking_=true;
+        queue_=&graph.walkQueue_;
+        visited_=&graph.walkVisited_;
+        queue_->clear();
+        if (visited_->size()<graph.size()) visited_->resize(graph.size(),0);
+        if (++graph.walkGeneration_==0)
+        {
+          visited_->assign(visited_->size(),0);
+          graph.walkGeneration_=1;
+        }
+        mark_=graph.walkGeneration_;
+      }
+      else ownVisited_.resize(graph.size(),0);
+
+      (*visited_)[start]=mark_;
+      Expand(start);
+    }
+
+    ~Walker()
+    { if (borrowed_) graph_->walking_=false; }
+
+   public :
+
+    /// Is the walk finished ?
+    bool IsDone() const
+    { return pos_>=queue_->size(); }
+
+    /// Index of the current particle
+    UInt_t operator*() const
+    { return (*queue_)[pos_]; }
+
+    /// Going to the next particle
+    Walker& operator++()
+    { Expand((*queue_)[pos_]); pos_++; return *this; }
+
+    /// Not descending below the current particle (the particles already 
+    /// reached through another path are still visited)
+    Walker& Skip()
+    { pos_++; return *this; }
+  };
+
+  /// Walk through the ancestors
+  class AncestorIterator : public Walker
+  {
+   public :
+    AncestorIterator(const MCDecayGraph& graph, UInt_t start)
+      : Walker(graph,start,true) {}
+  };
+
+  /// Walk through the descendants
+  class DescendantIterator : public Walker
+  {
+   public :
+    DescendantIterator(const MCDecayGraph& graph, UInt_t start)
+      : Walker(graph,start,false) {}
+  };
+
+
+ private :
+
+  /// Range of a table
+  MCIndexSpan Span(const std::vector<UInt_t>& table,
+                   const std::vector<UInt_t>& offsets, UInt_t i) const
+  {
+    if (!built_ || table.empty()) return MCIndexSpan();
+    const UInt_t* first = &table[0];
+    return MCIndexSpan(first+offsets[i],first+offsets[i+1]);
+  }
+
+  /// Filling a table from the links (counting sort, stable)
+  void Fill(std::vector<UInt_t>& offsets, std::vector<UInt_t>& table,
+            bool bydaughter);
+
+};
+
+}
+
+#endif
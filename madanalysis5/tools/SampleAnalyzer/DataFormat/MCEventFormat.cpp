@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCEventFormat.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// FillGlobalSums
+// -----------------------------------------------------------------------------
+void MCEventFormat::FillGlobalSums() const
+{
+  sums_ = SUMS_DONE;
+
+  // The invisible and hadronic particles are given by the classification
+  const UInt_t size = particles_.size();
+  if (size==0) return;
+  if (!classes_.IsFilled()) classes_.Classify(particles_);
+
+  // Accumulating the components in local variables
+  Double_t metx=0., mety=0., mhtx=0., mhty=0., tet=0., tht=0.;
+  for (UInt_t i=0;i<size;i++)
+  {
+    const MCParticleFormat& part = particles_[i];
+    const MALorentzVector& p = part.momentum();
+    const bool invisible = (part.classes() & MCParticleFormat::INVISIBLE)!=0;
+    const bool stable    = (part.statuscode()==1);
+
+    // MET in case of simplified LHE: sum of the invisible particles
+    if (simplifiedMET_ && (part.pdgid()==12 || (stable && invisible)))
+    {
+      metx += p.Px(); mety += p.Py();
+    }
+
+    // MET, MHT, TET, THT
+    if (!stable || invisible) continue;
+    if (!simplifiedMET_) { metx -= p.Px(); mety -= p.Py(); }
+    tet += part.pt();
+    if (part.classes() & MCParticleFormat::HADRONIC)
+    {
+      mhtx -= p.Px(); mhty -= p.Py();
+      tht  += part.pt();
+    }
+  }
+
+  MET_.momentum().SetPxPyPzE(metx,mety,0.,0.);
+  MET_.momentum().SetE(MET_.momentum().Pt());
+  MHT_.momentum().SetPxPyPzE(mhtx,mhty,0.,0.);
+  MHT_.momentum().SetE(MHT_.momentum().Pt());
+  TET_ = tet;
+  THT_ = tht;
+}
@@ -33,6 +33,8 @@
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/DataFormat/MCParticleFormat.h"
+#include "SampleAnalyzer/DataFormat/MCParticleArrays.h"
+#include "SampleAnalyzer/DataFormat/MCParticleClasses.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
 
@@ -47,6 +49,7 @@ class LHEWriter;
 class ROOTReader;
 class DelphesTreeReader;
 class DelfesTreeReader;
+class BinaryEventFormat;
 
 class MCEventFormat
 {
@@ -58,6 +61,7 @@ class MCEventFormat
   friend class LHEWriter;
   friend class DelphesTreeReader;
   friend class DelfesTreeReader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
@@ -77,18 +81,33 @@ class MCEventFormat
   /// List of generated particles
   std::vector<MCParticleFormat> particles_;
 
+  /// Mother-daughter links between the generated particles
+  MCDecayGraph decays_;
+
+  /// Structure-of-arrays copy of the generated particles
+  mutable MCParticleArrays arrays_;
+
+  /// Classification of the generated particles
+  mutable MCParticleClasses classes_;
+
   /// Computed Missing Transverse Energy
-  MCParticleFormat MET_;
+  mutable MCParticleFormat MET_;
   
   /// Computed Missing Hadronic Transverse Energy
-  MCParticleFormat MHT_;
+  mutable MCParticleFormat MHT_;
 
   /// Computed Scalar sum of transverse energy
-  Double_t TET_;
+  mutable Double_t TET_;
 
   /// Computed Scalar sum of hadronic transverse energy
-  Double_t THT_;
+  mutable Double_t THT_;
 
+  /// State of the global sums MET, MHT, TET, THT (SUMS_PENDING, SUMS_DONE
+  /// or SUMS_DISABLED)
+  mutable UChar_t sums_;
+
+  /// Simplified LHE: the MET is the sum of the invisible particles
+  Bool_t simplifiedMET_;
 
 
   // -------------------------------------------------------------
@@ -104,29 +123,43 @@ class MCEventFormat
   ~MCEventFormat()
   { }
 
+  /// The global sums are computed in one pass over the particles, at the
+  /// first call to one of their accessors. SUMS_DISABLED: they are not 
+  /// computed at all and stay at zero (option --no_global_sums).
+  enum { SUMS_PENDING=0, SUMS_DONE=1, SUMS_DISABLED=2 };
+
+  /// Computing the global sums if it has not been done
+  void ComputeGlobalSums() const
+  { if (sums_==SUMS_PENDING) FillGlobalSums(); }
+
+  /// Disabling the computation of the global sums for this event (the 
+  /// sums already computed or read are kept)
+  void DisableGlobalSums()
+  { if (sums_==SUMS_PENDING) sums_=SUMS_DISABLED; }
+
   /// Accessor to the Missing Transverse Energy (read-only)
-  const MCParticleFormat& MET() const {return MET_;}
+  const MCParticleFormat& MET() const {ComputeGlobalSums(); return MET_;}
 
   /// Accessor to the Missing Hadronic Transverse Energy (read-only)
-  const MCParticleFormat& MHT() const {return MHT_;}
+  const MCParticleFormat& MHT() const {ComputeGlobalSums(); return MHT_;}
 
   /// Accessor to the Total Transverse Energy (read-only)
-  const Double_t& TET() const {return TET_;}
+  const Double_t& TET() const {ComputeGlobalSums(); return TET_;}
 
   /// Accessor to the Total Hadronic Transverse Energy (read-only)
-  const Double_t& THT() const {return THT_;}
+  const Double_t& THT() const {ComputeGlobalSums(); return THT_;}
 
   /// Accessor to the Missing Transverse Energy
-  MCParticleFormat& MET() {return MET_;}
+  MCParticleFormat& MET() {ComputeGlobalSums(); return MET_;}
 
   /// Accessor to the Missing Hadronic Transverse Energy
-  MCParticleFormat& MHT() {return MHT_;}
+  MCParticleFormat& MHT() {ComputeGlobalSums(); return MHT_;}
 
   /// Accessor to the Total Transverse Energy
-  Double_t& TET() {return TET_;}
+  Double_t& TET() {ComputeGlobalSums(); return TET_;}
 
   /// Accessor to the Total Hadronic Transverse Energy
-  Double_t& THT() {return THT_;}
+  Double_t& THT() {ComputeGlobalSums(); return THT_;}
 
   /// Accessor to the process identity
   const UInt_t& processId()  const {return processId_;}
@@ -149,6 +182,35 @@ class MCEventFormat
   /// Accessor to the generated particle collection
   std::vector<MCParticleFormat>& particles() {return particles_;}
 
+  /// Accessor to the decay graph of the generated particles
+  const MCDecayGraph& decays() const {return decays_;}
+
+  /// Accessor to the structure-of-arrays copy of the particles. It is 
+  /// filled by the reader with the option --particle_arrays, otherwise at
+  /// the first call.
+  const MCParticleArrays& arrays() const
+  {
+    if (!arrays_.IsFilled()) arrays_.Fill(particles_);
+    return arrays_;
+  }
+
+  /// Filling the structure-of-arrays copy of the particles
+  void FillArrays()
+  { arrays_.Fill(particles_); }
+
+  /// Accessor to the classification of the particles and to the views on
+  /// the final-state, visible, hadronic and charged particles. It is 
+  /// filled by the reader, otherwise at the first call.
+  const MCParticleClasses& classes() const
+  {
+    if (!classes_.IsFilled()) classes_.Classify(particles_);
+    return classes_;
+  }
+
+  /// Classifying the particles
+  void Classify()
+  { classes_.Classify(particles_); }
+
   /// Setting the process identity
   void setProcessId(UInt_t v)  {processId_=v;}
 
@@ -164,15 +226,21 @@ class MCEventFormat
   /// Setting AlphaQCD
   void setAlphaQCD (Double_t v) {alphaQCD_=v; }
 
-  /// Clearing all information
+  /// Clearing all information. The capacity of the particle collection 
+  /// and of the decay graph are kept for the next event.
   void Reset()
   { nparts_=0; processId_=0; weight_=1.;
     scale_=0.; alphaQED_=0.; alphaQCD_=0.;
     particles_.clear(); 
+    decays_.Clear();
+    arrays_.Clear();
+    classes_.Clear();
     MET_.Reset();
     MHT_.Reset();
     TET_=0.;
     THT_=0.; 
+    sums_=SUMS_PENDING;
+    simplifiedMET_=false;
   }
 
   /// Displaying data member values
@@ -192,6 +260,12 @@ class MCEventFormat
     particles_.push_back(MCParticleFormat());
     return &particles_.back();
   }
+
+ private :
+
+  /// Computing MET, MHT, TET and THT in one pass over the particles
+  void FillGlobalSums() const;
+
 };
 
 }
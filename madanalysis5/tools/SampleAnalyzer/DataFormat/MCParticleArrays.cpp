@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCParticleArrays.h"
+#include "SampleAnalyzer/Service/Physics.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Fill
+// -----------------------------------------------------------------------------
+void MCParticleArrays::Fill(const std::vector<MCParticleFormat>& particles)
+{
+  size_ = particles.size();
+  px_.resize(size_);
+  py_.resize(size_);
+  pz_.resize(size_);
+  e_.resize(size_);
+  pt_.resize(size_);
+  eta_.resize(size_);
+  phi_.resize(size_);
+  pdgid_.resize(size_);
+  statuscode_.resize(size_);
+  mother1_.resize(size_);
+  mother2_.resize(size_);
+  flags_.resize(size_);
+
+  const MCParticleFormat* first = (size_==0) ? 0 : &particles[0];
+  for (UInt_t i=0;i<size_;i++)
+  {
+    const MCParticleFormat& part = particles[i];
+    const MALorentzVector& p = part.momentum();
+    px_[i]  = p.Px();
+    py_[i]  = p.Py();
+    pz_[i]  = p.Pz();
+    e_[i]   = p.E();
+    pt_[i]  = p.Pt();
+    eta_[i] = p.Eta();
+    phi_[i] = p.Phi();
+    pdgid_[i]      = part.pdgid();
+    statuscode_[i] = part.statuscode();
+    mother1_[i] = (part.mother1()==0) ? -1 : part.mother1()-first;
+    mother2_[i] = (part.mother2()==0) ? -1 : part.mother2()-first;
+
+    UChar_t flags = 0;
+    if (part.IsClassified())
+      flags = part.classes() & (FINAL_STATE | INITIAL_STATE | INVISIBLE);
+    else
+    {
+      if (PHYSICS->Id->IsFinalState(part))   flags |= FINAL_STATE;
+      if (PHYSICS->Id->IsInitialState(part)) flags |= INITIAL_STATE;
+      if (PHYSICS->Id->IsInvisible(part))    flags |= INVISIBLE;
+    }
+    flags_[i] = flags;
+  }
+  filled_ = true;
+}
+
+
+// -----------------------------------------------------------------------------
+// SelectPtEta
+// -----------------------------------------------------------------------------
+UInt_t MCParticleArrays::SelectPtEta(Double_t ptmin, Double_t etamax,
+                                     std::vector<UChar_t>& mask) const
+{
+  mask.resize(size_);
+  if (size_==0) return 0;
+  const MAFloat_t* pt  = &pt_[0];
+  const MAFloat_t* eta = &eta_[0];
+  UChar_t* out = &mask[0];
+
+  // No branch in the loop: it is vectorized by the compiler. The size is 
+  // copied first since the UChar_t output could alias the data member.
+  const UInt_t size = size_;
+  UInt_t n = 0;
+  for (UInt_t i=0;i<size;i++)
+  {
+    UChar_t ok = (pt[i]>ptmin) & (std::fabs(eta[i])<etamax);
+    out[i] = ok;
+    n += ok;
+  }
+  return n;
+}
+
+
+// -----------------------------------------------------------------------------
+// SelectVisibleFinalState
+// -----------------------------------------------------------------------------
+UInt_t MCParticleArrays::SelectVisibleFinalState(Double_t ptmin, 
+                                                 Double_t etamax,
+                                                 std::vector<UChar_t>& mask) const
+{
+  mask.resize(size_);
+  if (size_==0) return 0;
+  const MAFloat_t* pt    = &pt_[0];
+  const MAFloat_t* eta   = &eta_[0];
+  const UChar_t*  flags = &flags_[0];
+  UChar_t* out = &mask[0];
+
+  const UInt_t size = size_;
+  UInt_t n = 0;
+  for (UInt_t i=0;i<size;i++)
+  {
+    UChar_t ok = ((flags[i] & (FINAL_STATE|INVISIBLE))==FINAL_STATE) &
+                 (pt[i]>ptmin) & (std::fabs(eta[i])<etamax);
+    out[i] = ok;
+    n += ok;
+  }
+  return n;
+}
+
+
+// -----------------------------------------------------------------------------
+// SelectAbsPdgid
+// -----------------------------------------------------------------------------
+UInt_t MCParticleArrays::SelectAbsPdgid(Int_t abspdgid, Double_t ptmin,
+                                        std::vector<UChar_t>& mask) const
+{
+  mask.resize(size_);
+  if (size_==0) return 0;
+  const MAFloat_t* pt    = &pt_[0];
+  const Int_t*    pdgid = &pdgid_[0];
+  UChar_t* out = &mask[0];
+
+  const UInt_t size = size_;
+  UInt_t n = 0;
+  for (UInt_t i=0;i<size;i++)
+  {
+    UChar_t ok = ((pdgid[i]==abspdgid) | (pdgid[i]==-abspdgid)) & 
+                 (pt[i]>ptmin);
+    out[i] = ok;
+    n += ok;
+  }
+  return n;
+}
+
+
+// -----------------------------------------------------------------------------
+// ToIndices
+// -----------------------------------------------------------------------------
+void MCParticleArrays::ToIndices(const std::vector<UChar_t>& mask,
+                                 std::vector<UInt_t>& indices)
+{
+  indices.clear();
+  for (UInt_t i=0;i<mask.size();i++)
+    if (mask[i]!=0) indices.push_back(i);
+}
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MCParticleArrays_h
+#define MCParticleArrays_h
+
+// STL headers
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCParticleFormat.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Structure-of-arrays copy of the generated particles of an event: each
+/// quantity is stored in its own contiguous array, so that a loop reading
+/// a few quantities only touches these arrays and can be vectorized by the
+/// compiler. The copy is a snapshot: it is not updated when the particles
+/// are modified afterwards.
+//////////////////////////////////////////////////////////////////////////////
+class MCParticleArrays
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Number of particles
+  UInt_t size_;
+
+  /// Is the copy up to date ?
+  bool filled_;
+
+  /// Components of the momentum (in the storage precision of MALorentzVector)
+  std::vector<MAFloat_t> px_;
+  std::vector<MAFloat_t> py_;
+  std::vector<MAFloat_t> pz_;
+  std::vector<MAFloat_t> e_;
+
+  /// Transverse kinematics
+  std::vector<MAFloat_t> pt_;
+  std::vector<MAFloat_t> eta_;
+  std::vector<MAFloat_t> phi_;
+
+  /// PDG code and status code
+  std::vector<Int_t>    pdgid_;
+  std::vector<Short_t>  statuscode_;
+
+  /// Index of the mothers (-1 if no mother)
+  std::vector<Int_t>    mother1_;
+  std::vector<Int_t>    mother2_;
+
+  /// Particle state (combination of FINAL_STATE, INITIAL_STATE, INVISIBLE),
+  /// decided with the Identification service when the copy is filled
+  std::vector<UChar_t>  flags_;
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Same values as the classification bits of MCParticleFormat
+  enum { FINAL_STATE   = MCParticleFormat::FINAL_STATE, 
+         INITIAL_STATE = MCParticleFormat::INITIAL_STATE, 
+         INVISIBLE     = MCParticleFormat::INVISIBLE };
+
+  /// Constructor without argument
+  MCParticleArrays()
+  { size_=0; filled_=false; }
+
+  /// Filling the arrays from the particle collection (the capacity of the
+  /// arrays is kept from one event to the next)
+  void Fill(const std::vector<MCParticleFormat>& particles);
+
+  /// Clearing the arrays (the capacity is kept)
+  void Clear()
+  { size_=0; filled_=false; }
+
+  /// Is the copy up to date ?
+  bool IsFilled() const
+  { return filled_; }
+
+  /// Number of particles
+  UInt_t size() const
+  { return size_; }
+
+  /// Accessors to the arrays
+  const std::vector<MAFloat_t>& px()        const { return px_;  }
+  const std::vector<MAFloat_t>& py()        const { return py_;  }
+  const std::vector<MAFloat_t>& pz()        const { return pz_;  }
+  const std::vector<MAFloat_t>& e()         const { return e_;   }
+  const std::vector<MAFloat_t>& pt()        const { return pt_;  }
+  const std::vector<MAFloat_t>& eta()       const { return eta_; }
+  const std::vector<MAFloat_t>& phi()       const { return phi_; }
+  const std::vector<Int_t>&    pdgid()      const { return pdgid_;      }
+  const std::vector<Short_t>&  statuscode() const { return statuscode_; }
+  const std::vector<Int_t>&    mother1()    const { return mother1_;    }
+  const std::vector<Int_t>&    mother2()    const { return mother2_;    }
+  const std::vector<UChar_t>&  flags()      const { return flags_;      }
+
+  /// Mask (1 = selected) of the particles with pt>ptmin and |eta|<etamax.
+  /// The number of selected particles is returned.
+  UInt_t SelectPtEta(Double_t ptmin, Double_t etamax, 
+                     std::vector<UChar_t>& mask) const;
+
+  /// Mask of the visible final-state particles with pt>ptmin and 
+  /// |eta|<etamax. The number of selected particles is returned.
+  UInt_t SelectVisibleFinalState(Double_t ptmin, Double_t etamax, 
+                                 std::vector<UChar_t>& mask) const;
+
+  /// Mask of the particles with |pdgid|==abspdgid and pt>ptmin
+  UInt_t SelectAbsPdgid(Int_t abspdgid, Double_t ptmin,
+                        std::vector<UChar_t>& mask) const;
+
+  /// Converting a mask into the list of the selected particle indices
+  static void ToIndices(const std::vector<UChar_t>& mask, 
+                        std::vector<UInt_t>& indices);
+
+};
+
+}
+
+#endif
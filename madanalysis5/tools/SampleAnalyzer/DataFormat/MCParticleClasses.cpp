@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCParticleClasses.h"
+#include "SampleAnalyzer/Service/PDGService.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Classify
+// -----------------------------------------------------------------------------
+void MCParticleClasses::Classify(const std::vector<MCParticleFormat>& particles)
+{
+  Clear();
+  filled_ = true;
+  if (particles.empty()) return;
+  particles_ = const_cast<MCParticleFormat*>(&particles[0]);
+
+  // Status codes of the first and of the last particles, which define the
+  // initial and final states for the Identification service
+  const Short_t firststatus = particles.front().statuscode();
+  const Short_t finalstatus = particles.back().statuscode();
+  const PdgPropertyTable& table = PDG->Properties();
+
+  for (UInt_t i=0;i<particles.size();i++)
+  {
+    const MCParticleFormat& part = particles[i];
+    const Short_t status = part.statuscode();
+    const UChar_t flags  = table.Flags(part.pdgid());
+
+    UChar_t classes = MCParticleFormat::CLASSIFIED;
+    if (status==-1 || (status>=11 && status<=19)) 
+      classes |= MCParticleFormat::INITIAL_STATE;
+    if (status==firststatus) classes |= MCParticleFormat::FIRST_STATUS;
+    if (status==finalstatus) classes |= MCParticleFormat::FINAL_STATE;
+    if (flags & PdgPropertyTable::INVISIBLE) classes |= MCParticleFormat::INVISIBLE;
+    if (flags & PdgPropertyTable::HADRONIC)  classes |= MCParticleFormat::HADRONIC;
+    if (flags & PdgPropertyTable::CHARGED)   classes |= MCParticleFormat::CHARGED;
+    part.classes_ = classes;
+
+    if ((classes & MCParticleFormat::FINAL_STATE)==0) continue;
+    finalState_.push_back(i);
+    if ((classes & MCParticleFormat::INVISIBLE)==0) visible_.push_back(i);
+    if (classes & MCParticleFormat::HADRONIC) hadronic_.push_back(i);
+    if (classes & MCParticleFormat::CHARGED)  charged_.push_back(i);
+  }
+}
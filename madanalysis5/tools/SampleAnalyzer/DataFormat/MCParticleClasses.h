@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef MCParticleClasses_h
+#define MCParticleClasses_h
+
+// STL headers
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCParticleFormat.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Classification of the generated particles of an event. Classify() sets 
+/// the classification bits of each particle (MCParticleFormat::classes())
+/// once, so that the Identification service reads one bit instead of 
+/// comparing status codes or looking up PDG ids, and fills index views on
+/// the classes the analyses loop over:
+///   - finalState(): final-state particles
+///   - visible()   : final-state particles which are not invisible
+///   - hadronic()  : final-state particles with a hadronic id
+///   - charged()   : final-state charged particles
+/// The views point to the particle collection: they are valid until the
+/// next event.
+//////////////////////////////////////////////////////////////////////////////
+class MCParticleClasses
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Particle collection
+  MCParticleFormat* particles_;
+
+  /// Is the classification up to date ?
+  bool filled_;
+
+  /// Indices of the particles of each view
+  std::vector<UInt_t> finalState_;
+  std::vector<UInt_t> visible_;
+  std::vector<UInt_t> hadronic_;
+  std::vector<UInt_t> charged_;
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  MCParticleClasses()
+  { particles_=0; filled_=false; }
+
+  /// Copy constructor (the views are not copied: they point to the 
+  /// particles of the original event)
+  MCParticleClasses(const MCParticleClasses&)
+  { particles_=0; filled_=false; }
+
+  /// Assignment (the views are not copied)
+  MCParticleClasses& operator=(const MCParticleClasses&)
+  { Clear(); return *this; }
+
+  /// Classifying the particles and filling the views (the capacity of the
+  /// views is kept from one event to the next)
+  void Classify(const std::vector<MCParticleFormat>& particles);
+
+  /// Clearing the views (the capacity is kept)
+  void Clear()
+  { 
+    particles_=0; filled_=false;
+    finalState_.clear(); visible_.clear(); hadronic_.clear(); charged_.clear();
+  }
+
+  /// Is the classification up to date ?
+  bool IsFilled() const
+  { return filled_; }
+
+  /// Views on the classes of particles
+  MCParticleSpan finalState() const { return View(finalState_); }
+  MCParticleSpan visible()    const { return View(visible_);    }
+  MCParticleSpan hadronic()   const { return View(hadronic_);   }
+  MCParticleSpan charged()    const { return View(charged_);    }
+
+ private :
+
+  /// View on a list of indices
+  MCParticleSpan View(const std::vector<UInt_t>& indices) const
+  {
+    if (indices.empty()) return MCParticleSpan();
+    return MCParticleSpan(particles_,
+                          MCIndexSpan(&indices[0],&indices[0]+indices.size()));
+  }
+
+};
+
+}
+
+#endif
@@ -33,6 +33,7 @@
 
 // SampleAnalyzer
 #include "SampleAnalyzer/DataFormat/ParticleBaseFormat.h"
+#include "SampleAnalyzer/DataFormat/MCDecayGraph.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
 
@@ -48,6 +49,50 @@ class LHEWriter;
 class MergingPlots;
 class DelphesTreeReader;
 class DelfesTreeReader;
+class BinaryEventFormat;
+class MCParticleFormat;
+
+//////////////////////////////////////////////////////////////////////////////
+/// Read-only view on the mothers or the daughters of a particle, as stored 
+/// in the decay graph of the event
+//////////////////////////////////////////////////////////////////////////////
+class MCParticleSpan
+{
+ private:
+
+  MCParticleFormat* particles_;
+  MCIndexSpan       indices_;
+
+ public:
+
+  /// Constructor without argument (empty view)
+  MCParticleSpan()
+  { particles_=0; }
+
+  /// Constructor from the particle collection and the indices
+  MCParticleSpan(MCParticleFormat* particles, const MCIndexSpan& indices)
+  { particles_=particles; indices_=indices; }
+
+  /// Number of particles
+  UInt_t size() const
+  { return indices_.size(); }
+
+  /// Is the view empty ?
+  bool empty() const
+  { return indices_.empty(); }
+
+  /// Accessor to a particle
+  MCParticleFormat* operator[](UInt_t i) const;
+
+  /// Index of a particle in the particle collection
+  UInt_t index(UInt_t i) const
+  { return indices_[i]; }
+
+  /// Indices of the particles
+  const MCIndexSpan& indices() const
+  { return indices_; }
+};
+
 
 class MCParticleFormat : public ParticleBaseFormat
 {
@@ -60,6 +105,9 @@ class MCParticleFormat : public ParticleBaseFormat
   friend class MergingPlots;
   friend class DelphesTreeReader;
   friend class DelfesTreeReader;
+  friend class BinaryEventFormat;
+  friend class MCDecayGraph;
+  friend class MCParticleClasses;
 
   // -------------------------------------------------------------
   //                        data members
@@ -75,11 +123,16 @@ class MCParticleFormat : public ParticleBaseFormat
   Int_t           extra1_;
   Int_t           extra2_;
 
-  std::vector<MCParticleFormat*> daughters_;
-
   MCParticleFormat *mother1_ ;  // mother particle
   MCParticleFormat *mother2_ ;  // mother particle
 
+  /// Decay graph of the event and index of the particle in the collection
+  const MCDecayGraph* graph_;
+  UInt_t              index_;
+
+  /// Classification bits, set by MCParticleClasses (0 if not classified)
+  mutable UChar_t     classes_;
+
  public:
   UInt_t 	        mothup1_;   /// first mother index
   UInt_t 	        mothup2_;   /// second mother index
@@ -92,6 +145,12 @@ class MCParticleFormat : public ParticleBaseFormat
   // -------------------------------------------------------------
  public :
 
+  /// Classification bits (see MCParticleClasses). FIRST_STATUS: same status
+  /// code as the first particle of the event; FINAL_STATE: same status
+  /// code as the last particle of the event.
+  enum { CLASSIFIED=1, INITIAL_STATE=2, FINAL_STATE=4, FIRST_STATUS=8, 
+         INVISIBLE=16, HADRONIC=32, CHARGED=64 };
+
   /// Constructor without arguments
   MCParticleFormat()
   { Reset(); }
@@ -108,6 +167,7 @@ class MCParticleFormat : public ParticleBaseFormat
     statuscode_=0; mothup1_=0; mothup2_=0; mother1_=0; mother2_=0; 
     daughter1_=0; daughter2_=0;
     extra1_=0; extra2_=0;
+    graph_=0; index_=0; classes_=0;
   }
 
   /// Print particle informations
@@ -138,11 +198,23 @@ class MCParticleFormat : public ParticleBaseFormat
   const MCParticleFormat* mother1() const {return mother1_;}
   const MCParticleFormat* mother2() const {return mother2_;}
 
-  /// Accessor to the daughters (read-only)
-  const std::vector<MCParticleFormat*>& daughters() const {return daughters_;}
+  /// Accessor to the daughters (empty if the decay graph is not built)
+  MCParticleSpan daughters() const;
+
+  /// Accessor to all the mothers, mother1 first
+  MCParticleSpan mothers() const;
 
-  /// Accessor to the daughters
-  std::vector<MCParticleFormat*>& daughters() {return daughters_;}
+  /// Decay graph of the event (0 if it is not built)
+  const MCDecayGraph* decayGraph() const {return graph_;}
+
+  /// Index of the particle in the decay graph
+  UInt_t index() const {return index_;}
+
+  /// Classification bits of the particle (0 if not classified)
+  UChar_t classes() const {return classes_;}
+
+  /// Has the particle been classified ?
+  bool IsClassified() const {return (classes_ & CLASSIFIED)!=0;}
 
   MCParticleFormat* mother1() {return mother1_;}
   MCParticleFormat* mother2() {return mother2_;}
@@ -150,9 +222,10 @@ class MCParticleFormat : public ParticleBaseFormat
   // mutators
   void setCtau(Float_t v)  {ctau_=v;}
   void setSpin(Float_t v)  {spin_=v;}
-  void setPdgid(Int_t v)   {pdgid_=v;}
-  void setStatuscode(Short_t v)  {statuscode_=v;}
+  void setPdgid(Int_t v)   {pdgid_=v; classes_=0;}
+  void setStatuscode(Short_t v)  {statuscode_=v; classes_=0;}
   void setMomentum(const TLorentzVector& v)  {momentum_=v;}
+  void setMomentum(const MALorentzVector& v) {momentum_=v;}
   void setMothUp1(UInt_t v) {mothup1_=v;}
   void setMothUp2(UInt_t v) {mothup2_=v;}
 
@@ -174,6 +247,22 @@ class MCParticleFormat : public ParticleBaseFormat
 
 };
 
+
+inline MCParticleFormat* MCParticleSpan::operator[](UInt_t i) const
+{ return particles_+indices_[i]; }
+
+inline MCParticleSpan MCParticleFormat::daughters() const
+{
+  if (graph_==0) return MCParticleSpan();
+  return MCParticleSpan(graph_->particles(),graph_->children(index_));
+}
+
+inline MCParticleSpan MCParticleFormat::mothers() const
+{
+  if (graph_==0) return MCParticleSpan();
+  return MCParticleSpan(graph_->particles(),graph_->parents(index_));
+}
+
 }
 
 #endif
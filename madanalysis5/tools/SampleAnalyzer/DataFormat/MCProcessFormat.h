@@ -42,6 +42,8 @@ class STDHEPReader;
 class STDHEPreader;
 class ROOTReader;
 class LHEWriter;
+class SampleAnalyzer;
+class BinaryEventFormat;
 
 class ProcessFormat
 {
@@ -50,8 +52,10 @@ class ProcessFormat
   friend class HEPMCReader;
   friend class ROOTReader;
   friend class LHEWriter;
+  friend class SampleAnalyzer;
   friend class STDHEPReader;
   friend class STDHEPreader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
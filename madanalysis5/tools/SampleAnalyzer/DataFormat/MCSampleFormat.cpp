@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+
+// POSIX headers
+#include <pthread.h>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCSampleFormat.h"
+
+using namespace MA5;
+
+
+namespace
+{
+  /// Lock protecting the sums of weights (shared by the worker threads)
+  pthread_mutex_t weight_mutex = PTHREAD_MUTEX_INITIALIZER;
+}
+
+
+// -----------------------------------------------------------------------------
+// addWeightedEvents
+// -----------------------------------------------------------------------------
+void MCSampleFormat::addWeightedEvents(Double_t weight)
+{
+  pthread_mutex_lock(&weight_mutex);
+  if (weight>=0) sumweight_positive_ += std::abs(weight);
+  else sumweight_negative_ += std::abs(weight);
+  pthread_mutex_unlock(&weight_mutex);
+}
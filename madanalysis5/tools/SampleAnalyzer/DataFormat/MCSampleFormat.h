@@ -47,7 +47,7 @@ class STDHEPreader;
 class ROOTReader;
 class LHEWriter;
 class SampleAnalyzer;
-
+class BinaryEventFormat;
 
 class MCSampleFormat
 {
@@ -59,6 +59,7 @@ class MCSampleFormat
   friend class LHEWriter;
   friend class STDHEPReader;
   friend class STDHEPreader;
+  friend class BinaryEventFormat;
 
 
   // -------------------------------------------------------------
@@ -202,10 +203,9 @@ class MCSampleFormat
   void setXsectionError(Double_t value) 
   { xsection_error_=value;}
 
-  /// Adding a weight
-  void addWeightedEvents(Double_t weight)
-  { if (weight>=0) sumweight_positive_ += std::abs(weight);
-    else sumweight_negative_ += std::abs(weight); }
+  /// Adding a weight (thread-safe: the replicas of the analyses running in
+  /// the multi-threaded mode share the same sample)
+  void addWeightedEvents(Double_t weight);
 
   /// Accessor to the number of events with positive weight
   void setSumweight_positive(Double_t sum)
@@ -35,6 +35,7 @@
 #include <TLorentzVector.h>
 
 // SampleAnalyzer
+#include "SampleAnalyzer/DataFormat/MALorentzVector.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
 
@@ -61,7 +62,7 @@ class ParticleBaseFormat
  protected:
    
   /// Quadrivector of particle (E, px,py,pz)
-  TLorentzVector 	momentum_;  
+  MALorentzVector momentum_;  
 
 
   // -------------------------------------------------------------
@@ -81,6 +82,10 @@ class ParticleBaseFormat
   ParticleBaseFormat(const TLorentzVector& p)
   { momentum_.SetPxPyPzE(p.Px(),p.Py(),p.Pz(),p.E()); }
 
+  /// Constructor without argument
+  ParticleBaseFormat(const MALorentzVector& p)
+  { momentum_=p; }
+
   /// Destructor
   virtual ~ParticleBaseFormat()
   { }
@@ -103,14 +108,17 @@ class ParticleBaseFormat
   }
 			
   /// Accessor to 4-vector momentum (read-only)
-  const TLorentzVector& momentum() const {return momentum_;}
+  const MALorentzVector& momentum() const {return momentum_;}
 
   /// Accessor to 4-vector momentum
-  TLorentzVector& momentum() {return momentum_;}
+  MALorentzVector& momentum() {return momentum_;}
 
   /// Set the 4-vector momentum
   void setMomentum(const TLorentzVector& v) {momentum_=v;}
 
+  /// Set the 4-vector momentum
+  void setMomentum(const MALorentzVector& v) {momentum_=v;}
+
   /// Accessor to the particle energy
   const Float_t e()       const {return momentum_.E();       }
 
@@ -129,20 +137,23 @@ class ParticleBaseFormat
     if (tmp<0) return 0.; else return sqrt(tmp);
   }
 
-  const Float_t mt_met(const TLorentzVector& MET) const 
+  const Float_t mt_met(const MALorentzVector& MET) const 
   { 
     // Computing ET sum
     double ETsum = sqrt( momentum_.M()*momentum_.M() +
                          momentum_.Pt()*momentum_.Pt() )  + MET.Pt();
 
     // Computing PT sum
-    TLorentzVector pt = momentum_ + MET;
+    MALorentzVector pt = momentum_ + MET;
 
     double value = ETsum*ETsum - pt.Pt()*pt.Pt();
     if (value<0) return 0;
     else return sqrt(value);
   }
 
+  const Float_t mt_met(const TLorentzVector& MET) const 
+  { return mt_met(MALorentzVector(MET)); }
+
   /// Accessor to the particle transverse energy
   const Float_t et()      const {return momentum_.Et();      }
 
@@ -249,10 +260,18 @@ class ParticleBaseFormat
 
   /// operator + (momentum)
   ParticleBaseFormat operator + (const TLorentzVector& p) const 
-  { return ParticleBaseFormat(momentum_+p); }
+  { return ParticleBaseFormat(momentum_+MALorentzVector(p)); }
 
   /// operator - (momentum)
   ParticleBaseFormat operator - (const TLorentzVector& p) const
+  { return ParticleBaseFormat(momentum_-MALorentzVector(p)); }
+
+  /// operator + (momentum)
+  ParticleBaseFormat operator + (const MALorentzVector& p) const 
+  { return ParticleBaseFormat(momentum_+p); }
+
+  /// operator - (momentum)
+  ParticleBaseFormat operator - (const MALorentzVector& p) const
   { return ParticleBaseFormat(momentum_-p); }
 
   /// operator += (momentum)
@@ -265,6 +284,16 @@ class ParticleBaseFormat
   { this->momentum_ -= p.momentum_;
     return *this; }
 
+  /// operator += (momentum)
+  ParticleBaseFormat& operator += (const MALorentzVector& p)
+  { this->momentum_ += p;
+    return *this; }
+
+  /// operator -= (momentum)
+  ParticleBaseFormat& operator -= (const MALorentzVector& p)
+  { this->momentum_ -= p;
+    return *this; }
+
 };
 
 }
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PdgPropertyData_h
+#define PdgPropertyData_h
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+/// Line of particle.tbl
+struct PdgRecord
+{
+  /// PDG id
+  Int_t       pdgid;
+
+  /// Name
+  const char* name;
+
+  /// Charge in units of e+/3
+  Int_t       charge;
+
+  /// Mass and total width in GeV
+  Float_t     mass;
+  Float_t     width;
+
+  /// Lifetime (c*tau) in mm
+  Double_t    ctau;
+};
+
+/// Content of particle.tbl sorted by PDG id, embedded in the library by 
+/// PdgPropertyData.cpp (generated when the library is built)
+extern const UInt_t    PdgPropertyDataSize;
+extern const PdgRecord PdgPropertyData[];
+
+}
+
+#endif
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <algorithm>
+#include <cstdlib>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/PdgPropertyTable.h"
+#include "SampleAnalyzer/DataFormat/PdgPropertyData.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+PdgPropertyTable::PdgPropertyTable()
+{
+  multiplier_=0; shift_=0;
+
+  // Ids missing in the table
+  dense_.resize(2*DenseLimit);
+  for (Int_t id=-DenseLimit+1;id<DenseLimit;id++) 
+    dense_[id+DenseLimit]=DefaultEntry(id);
+
+  // Ids of particle.tbl
+  for (UInt_t i=0;i<PdgPropertyDataSize;i++)
+  {
+    Int_t id = PdgPropertyData[i].pdgid;
+    Entry entry = KnownEntry(id,PdgPropertyData[i].charge);
+    if (id>-DenseLimit && id<DenseLimit) dense_[id+DenseLimit]=entry;
+    else
+    {
+      // The generated data are sorted by id
+      sparseIds_.push_back(id);
+      sparseEntries_.push_back(entry);
+    }
+  }
+  BuildHash();
+}
+
+
+// -----------------------------------------------------------------------------
+// NumberingFlags
+// -----------------------------------------------------------------------------
+UChar_t PdgPropertyTable::NumberingFlags(Int_t pdgid)
+{
+  UInt_t apdg = std::abs(pdgid);
+  UChar_t flags = 0;
+  if ( (apdg>=500   && apdg<=599)   || (apdg>=5000  && apdg<=5999) ||
+       (apdg>=10500 && apdg<=10599) || (apdg>=20500 && apdg<=20599) )
+    flags |= BHADRON;
+  if ( (apdg>=400   && apdg<=499)   || (apdg>=4000  && apdg<=4999) ||
+       (apdg>=10400 && apdg<=10499) || (apdg>=20400 && apdg<=20499) )
+    flags |= CHADRON;
+  if (apdg>=11 && apdg<=18) flags |= LEPTON;
+  return flags;
+}
+
+
+// -----------------------------------------------------------------------------
+// DefaultEntry
+// -----------------------------------------------------------------------------
+PdgPropertyTable::Entry PdgPropertyTable::DefaultEntry(Int_t pdgid)
+{
+  Entry entry;
+  entry.flags  = NumberingFlags(pdgid) | CHARGED;
+  entry.charge = 0;
+  return entry;
+}
+
+
+// -----------------------------------------------------------------------------
+// KnownEntry
+// -----------------------------------------------------------------------------
+PdgPropertyTable::Entry PdgPropertyTable::KnownEntry(Int_t pdgid, Int_t charge)
+{
+  Entry entry;
+  entry.flags  = NumberingFlags(pdgid) | KNOWN;
+  entry.charge = static_cast<Char_t>(charge);
+  if (charge!=0) entry.flags |= CHARGED;
+  return entry;
+}
+
+
+// -----------------------------------------------------------------------------
+// GetSparse
+// -----------------------------------------------------------------------------
+PdgPropertyTable::Entry PdgPropertyTable::GetSparse(Int_t pdgid) const
+{
+  // Perfect hash: one probe
+  if (!slots_.empty())
+  {
+    UInt_t slot = (static_cast<UInt_t>(pdgid)*multiplier_) >> shift_;
+    Int_t index = slots_[slot];
+    if (index>=0 && sparseIds_[index]==pdgid) return sparseEntries_[index];
+    return DefaultEntry(pdgid);
+  }
+
+  // No perfect hash found: binary search
+  std::vector<Int_t>::const_iterator it = 
+    std::lower_bound(sparseIds_.begin(),sparseIds_.end(),pdgid);
+  if (it!=sparseIds_.end() && *it==pdgid) 
+    return sparseEntries_[it-sparseIds_.begin()];
+  return DefaultEntry(pdgid);
+}
+
+
+// -----------------------------------------------------------------------------
+// BuildHash
+// -----------------------------------------------------------------------------
+void PdgPropertyTable::BuildHash()
+{
+  slots_.clear();
+  const UInt_t n = sparseIds_.size();
+  if (n==0) return;
+
+  // Smallest number of bits with at least twice as many slots as ids
+  UInt_t bits = 1;
+  while ((1u<<bits) < 2*n) bits++;
+
+  // Trying a few odd multipliers for each table size
+  for (; bits<=16; bits++)
+  {
+    UInt_t multiplier = 0x9E3779B1u;
+    for (UInt_t trial=0;trial<64;trial++)
+    {
+      slots_.assign(1u<<bits,-1);
+      UInt_t shift = 32-bits;
+      bool perfect = true;
+      for (UInt_t i=0;i<n && perfect;i++)
+      {
+        UInt_t slot = (static_cast<UInt_t>(sparseIds_[i])*multiplier) >> shift;
+        if (slots_[slot]>=0) perfect=false;
+        else slots_[slot]=i;
+      }
+      if (perfect) { multiplier_=multiplier; shift_=shift; return; }
+      multiplier = multiplier*1664525u + 1013904222u;
+    }
+  }
+
+  // Falling back on the binary search
+  slots_.clear();
+}
+
+
+// -----------------------------------------------------------------------------
+// InsertSparse
+// -----------------------------------------------------------------------------
+void PdgPropertyTable::InsertSparse(Int_t pdgid, const Entry& entry)
+{
+  std::vector<Int_t>::iterator it = 
+    std::lower_bound(sparseIds_.begin(),sparseIds_.end(),pdgid);
+  UInt_t index = it-sparseIds_.begin();
+  sparseIds_.insert(it,pdgid);
+  sparseEntries_.insert(sparseEntries_.begin()+index,entry);
+  BuildHash();
+}
+
+
+// -----------------------------------------------------------------------------
+// SetFlags
+// -----------------------------------------------------------------------------
+void PdgPropertyTable::SetFlags(Int_t pdgid, UChar_t flags)
+{
+  if (pdgid>-DenseLimit && pdgid<DenseLimit)
+  {
+    dense_[pdgid+DenseLimit].flags |= flags;
+    return;
+  }
+
+  std::vector<Int_t>::iterator it = 
+    std::lower_bound(sparseIds_.begin(),sparseIds_.end(),pdgid);
+  if (it!=sparseIds_.end() && *it==pdgid)
+  {
+    sparseEntries_[it-sparseIds_.begin()].flags |= flags;
+    return;
+  }
+
+  // New id: the perfect hash is rebuilt (only at initialization time)
+  Entry entry = DefaultEntry(pdgid);
+  entry.flags |= flags;
+  InsertSparse(pdgid,entry);
+}
+
+
+// -----------------------------------------------------------------------------
+// SetCharge
+// -----------------------------------------------------------------------------
+void PdgPropertyTable::SetCharge(Int_t pdgid, Int_t charge)
+{
+  // The runtime flags (HADRONIC, INVISIBLE) are kept
+  const UChar_t runtime = HADRONIC | INVISIBLE;
+  Entry entry = KnownEntry(pdgid,charge);
+
+  if (pdgid>-DenseLimit && pdgid<DenseLimit)
+  {
+    Entry& old = dense_[pdgid+DenseLimit];
+    entry.flags |= old.flags & runtime;
+    old = entry;
+    return;
+  }
+
+  std::vector<Int_t>::iterator it = 
+    std::lower_bound(sparseIds_.begin(),sparseIds_.end(),pdgid);
+  if (it!=sparseIds_.end() && *it==pdgid)
+  {
+    Entry& old = sparseEntries_[it-sparseIds_.begin()];
+    entry.flags |= old.flags & runtime;
+    old = entry;
+    return;
+  }
+  InsertSparse(pdgid,entry);
+}
+
+
+// -----------------------------------------------------------------------------
+// ClearFlags
+// -----------------------------------------------------------------------------
+void PdgPropertyTable::ClearFlags(UChar_t flags)
+{
+  for (UInt_t i=0;i<dense_.size();i++) dense_[i].flags &= ~flags;
+  for (UInt_t i=0;i<sparseEntries_.size();i++) sparseEntries_[i].flags &= ~flags;
+}
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PdgPropertyTable_h
+#define PdgPropertyTable_h
+
+// STL headers
+#include <vector>
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Properties of the particles indexed by PDG id, stored in a compact table:
+/// a dense array for the ids |pdgid|<DenseLimit (quarks, leptons, bosons,
+/// mesons and baryons) and a perfect hash for the other ids (excited 
+/// states, BSM particles, nuclei). Each entry gathers the charge and a set 
+/// of bit flags, so that a query costs one load instead of a std::set walk.
+///
+/// The charges come from particle.tbl, embedded in the library (see
+/// PdgPropertyData.h), and may be overridden by PDGService::LoadTable. The flags HADRONIC and INVISIBLE are the 
+/// runtime settings of MCconfig, which keeps them in sync. The ids missing 
+/// in particle.tbl are considered as charged.
+//////////////////////////////////////////////////////////////////////////////
+class PdgPropertyTable
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ public :
+
+  enum { CHARGED=1, HADRONIC=2, INVISIBLE=4, BHADRON=8, CHADRON=16, 
+         LEPTON=32, KNOWN=64 };
+
+  /// The dense array covers the ids -DenseLimit<pdgid<DenseLimit
+  enum { DenseLimit=6000 };
+
+  /// Properties of a particle
+  struct Entry
+  {
+    /// Combination of the flags above
+    UChar_t flags;
+
+    /// Charge in units of e+/3
+    Char_t  charge;
+  };
+
+ private :
+
+  /// Dense array, indexed by pdgid+DenseLimit
+  std::vector<Entry> dense_;
+
+  /// Other ids, sorted, and their properties
+  std::vector<Int_t> sparseIds_;
+  std::vector<Entry> sparseEntries_;
+
+  /// Perfect hash of the other ids: slot = (pdgid*multiplier) >> shift
+  /// holds the index of the id in sparseIds_ (-1 for an empty slot). 
+  /// If no perfect hash is found, the sorted ids are searched instead.
+  std::vector<Int_t> slots_;
+  UInt_t multiplier_;
+  UInt_t shift_;
+
+
+  // -------------------------------------------------------------
+  //                      method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor: filling the table from the embedded particle.tbl
+  PdgPropertyTable();
+
+  /// Destructor
+  ~PdgPropertyTable()
+  { }
+
+  /// Properties of a particle
+  Entry Get(Int_t pdgid) const
+  {
+    if (pdgid>-DenseLimit && pdgid<DenseLimit) 
+      return dense_[pdgid+DenseLimit];
+    return GetSparse(pdgid);
+  }
+
+  /// Flags of a particle
+  UChar_t Flags(Int_t pdgid) const
+  { return Get(pdgid).flags; }
+
+  /// Testing the flags of a particle
+  bool Is(Int_t pdgid, UChar_t flags) const
+  { return (Get(pdgid).flags & flags)!=0; }
+
+  /// Charge (in units of e+/3)
+  Int_t Charge(Int_t pdgid) const
+  { return Get(pdgid).charge; }
+
+  /// Setting flags (the id is added to the table if necessary)
+  void SetFlags(Int_t pdgid, UChar_t flags);
+
+  /// Setting the charge of a particle (the runtime flags are kept)
+  void SetCharge(Int_t pdgid, Int_t charge);
+
+  /// Removing flags from all the particles
+  void ClearFlags(UChar_t flags);
+
+  /// Flags given by the PDG numbering scheme of an id, without the 
+  /// particle table: B-hadron, C-hadron, lepton
+  static UChar_t NumberingFlags(Int_t pdgid);
+
+ private :
+
+  /// Properties of a particle outside the dense array
+  Entry GetSparse(Int_t pdgid) const;
+
+  /// Adding an id outside the dense array
+  void InsertSparse(Int_t pdgid, const Entry& entry);
+
+  /// Building the perfect hash of the sparse ids
+  void BuildHash();
+
+  /// Default properties of an id missing in the table
+  static Entry DefaultEntry(Int_t pdgid);
+
+  /// Properties of an id of the table
+  static Entry KnownEntry(Int_t pdgid, Int_t charge);
+
+};
+
+}
+
+#endif
@@ -50,7 +50,9 @@ PdgTable& PdgTable::operator=(const PdgTable& Table)
 
 void PdgTable::Insert(const Int_t Pdgid, const PdgDataFormat &p) 
 {
-  Table_.insert(std::map<Int_t,PdgDataFormat>::value_type(Pdgid,p));
+  std::pair<std::map<Int_t,PdgDataFormat>::iterator,bool> result = 
+    Table_.insert(std::map<Int_t,PdgDataFormat>::value_type(Pdgid,p));
+  if (!result.second) result.first->second = p;
 }
 
 void PdgTable::Print() const 
@@ -51,6 +51,7 @@ class PdgTable {
   const std::map<Int_t, PdgDataFormat>& Table() 
   { return Table_; }
 
+	/// Insert a particle (an existing entry is replaced)
 	void Insert(const Int_t Pdgid, const PdgDataFormat &p);
 
 	void Print() const;
@@ -30,6 +30,8 @@
 #include <sstream>
 #include <string>
 #include <iomanip>
+#include <map>
+#include <vector>
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/DataFormat/RecLeptonFormat.h"
@@ -52,6 +54,7 @@ class bTagger;
 class JetClusteringFastJet;
 class DelphesTreeReader;
 class DelfesTreeReader;
+class BinaryEventFormat;
 
 class RecEventFormat
 {
@@ -63,12 +66,17 @@ class RecEventFormat
   friend class JetClusteringFastJet;
   friend class DelphesTreeReader;
   friend class DelfesTreeReader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
   // -------------------------------------------------------------
  private : 
 
+  /// Storage of the constituents and isolation cones (declared before the 
+  /// collections, which are destroyed first)
+  EventArena arena_;
+
   /// Collection of reconstructed photons
   std::vector<RecPhotonFormat> photons_;
 
@@ -87,6 +95,9 @@ class RecEventFormat
   /// Collection of generated jets
   std::vector<RecJetFormat>    genjets_;
 
+  /// Named collections of jets (additional jet definitions)
+  std::map<std::string, std::vector<RecJetFormat> > jetcollections_;
+
   /// Collection of reconstructed tracks
   std::vector<RecTrackFormat>  tracks_;
 
@@ -149,6 +160,21 @@ class RecEventFormat
   /// Accessor to the genjet collection (read-only)
   const std::vector<RecJetFormat>& genjets() const {return genjets_;}
 
+  /// Accessor to a named jet collection (read-only). The collection is 
+  /// empty if no jet definition is associated with the name.
+  const std::vector<RecJetFormat>& jets(const std::string& name) const
+  {
+    static const std::vector<RecJetFormat> empty;
+    std::map<std::string, std::vector<RecJetFormat> >::const_iterator
+      it = jetcollections_.find(name);
+    if (it==jetcollections_.end()) return empty;
+    return it->second;
+  }
+
+  /// Accessor to the named jet collections (read-only)
+  const std::map<std::string, std::vector<RecJetFormat> >& jetcollections() const
+  {return jetcollections_;}
+
   /// Accessor to the track collection (read-only)
   const std::vector<RecTrackFormat>& tracks() const {return tracks_;}
 
@@ -202,6 +228,10 @@ class RecEventFormat
   /// Accessor to the jet collection
   std::vector<RecJetFormat>& genjets() {return genjets_;}
 
+  /// Accessor to a named jet collection (created if needed)
+  std::vector<RecJetFormat>& jets(const std::string& name) 
+  {return jetcollections_[name];}
+
   /// Accessor to the track collection
   std::vector<RecTrackFormat>& tracks() {return tracks_;}
 
@@ -237,7 +267,8 @@ class RecEventFormat
   std::vector<const MCParticleFormat*>& MCCquarks()
   {return MCCquarks_;}
 
-  /// Clearing all information
+  /// Clearing all information. The capacity of the collections and the 
+  /// memory of the arena are kept for the next event.
   void Reset()
   { 
     photons_.clear(); 
@@ -246,7 +277,11 @@ class RecEventFormat
     taus_.clear();
     jets_.clear();
     genjets_.clear();
+    for (std::map<std::string, std::vector<RecJetFormat> >::iterator
+         it=jetcollections_.begin();it!=jetcollections_.end();it++)
+      it->second.clear();
     tracks_.clear();
+    arena_.Reset();
     MET_.Reset();
     MHT_.Reset();
     TET_=0.;
@@ -267,6 +302,7 @@ class RecEventFormat
   RecPhotonFormat* GetNewPhoton()
   {
     photons_.push_back(RecPhotonFormat());
+    photons_.back().SetArena(&arena_);
     return &photons_.back();
   }
 
@@ -274,6 +310,7 @@ class RecEventFormat
   RecLeptonFormat* GetNewElectron()
   {
     electrons_.push_back(RecLeptonFormat());
+    electrons_.back().SetArena(&arena_);
     return &electrons_.back();
   }
 
@@ -281,6 +318,7 @@ class RecEventFormat
   RecLeptonFormat* GetNewMuon()
   {
     muons_.push_back(RecLeptonFormat());
+    muons_.back().SetArena(&arena_);
     return &muons_.back();
   }
 
@@ -295,13 +333,24 @@ class RecEventFormat
   RecJetFormat* GetNewJet()
   {
     jets_.push_back(RecJetFormat());
+    jets_.back().SetArena(&arena_);
     return &jets_.back();
   }
 
+  /// Giving a new jet entry in a named collection
+  RecJetFormat* GetNewJet(const std::string& name)
+  {
+    std::vector<RecJetFormat>& collection = jetcollections_[name];
+    collection.push_back(RecJetFormat());
+    collection.back().SetArena(&arena_);
+    return &collection.back();
+  }
+
   /// Giving a new gen jet entry
   RecJetFormat* GetNewGenJet()
   {
     genjets_.push_back(RecJetFormat());
+    genjets_.back().SetArena(&arena_);
     return &genjets_.back();
   }
 
@@ -309,6 +358,7 @@ class RecEventFormat
   RecTrackFormat* GetNewTrack()
   {
     tracks_.push_back(RecTrackFormat());
+    tracks_.back().SetArena(&arena_);
     return &tracks_.back();
   }
 
@@ -33,6 +33,7 @@
 
 // RecParticleFormat
 #include "SampleAnalyzer/DataFormat/IsolationConeType.h"
+#include "SampleAnalyzer/DataFormat/ArenaVector.h"
 #include "SampleAnalyzer/DataFormat/RecParticleFormat.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
@@ -45,6 +46,7 @@ class DelphesTreeReader;
 class DelfesTreeReader;
 class DetectorDelphes;
 class DetectorDelfes;
+class BinaryEventFormat;
 
 class RecJetFormat : public RecParticleFormat
 {
@@ -55,10 +57,12 @@ class RecJetFormat : public RecParticleFormat
   friend class bTagger;
   friend class TauTagger;
   friend class cTagger;
+  friend class TaggerBenchmark;
   friend class DetectorDelphes;
   friend class DetectorDelfes;
   friend class DelphesTreeReader;
   friend class DelfesTreeReader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
@@ -69,8 +73,8 @@ class RecJetFormat : public RecParticleFormat
   Bool_t btag_;        /// b-tag
   Bool_t true_ctag_;   /// c-tag (before id or misid)
   Bool_t true_btag_;   /// b-tag (before id or misid)
-  std::vector<Int_t> Constituents_;  /// indices of the MC particles
-  std::vector<IsolationConeType> isolCones_; // isolation cones
+  ArenaVector<Int_t> Constituents_;  /// indices of the MC particles
+  ArenaVector<IsolationConeType> isolCones_; // isolation cones
 
   // -------------------------------------------------------------
   //                        method members
@@ -100,6 +104,7 @@ class RecJetFormat : public RecParticleFormat
     btag_      = false;
     true_btag_ = false;
     true_ctag_ = false;
+    Constituents_.clear();
     isolCones_.clear();
   }
 
@@ -124,7 +129,7 @@ class RecJetFormat : public RecParticleFormat
   {Constituents_.push_back(index);}
 
   /// get constituent collections
-  const std::vector<Int_t>& constituents() const
+  const ArenaVector<Int_t>& constituents() const
   { return Constituents_; }
 
   /// Add one isolation cone
@@ -132,9 +137,17 @@ class RecJetFormat : public RecParticleFormat
   {isolCones_.push_back(cone);}
 
   /// get the collection of isolation cones
-  const std::vector<IsolationConeType>& isolCones() const
+  const ArenaVector<IsolationConeType>& isolCones() const
   { return isolCones_; }
 
+  /// Taking the storage of the constituents and of the isolation cones 
+  /// from the arena of the event
+  void SetArena(EventArena* arena)
+  {
+    Constituents_.SetArena(arena);
+    isolCones_.SetArena(arena);
+  }
+
 };
 
 }
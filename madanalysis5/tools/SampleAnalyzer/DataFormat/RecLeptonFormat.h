@@ -33,6 +33,7 @@
 
 // RecParticleFormat
 #include "SampleAnalyzer/DataFormat/IsolationConeType.h"
+#include "SampleAnalyzer/DataFormat/ArenaVector.h"
 #include "SampleAnalyzer/DataFormat/RecParticleFormat.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
@@ -43,6 +44,7 @@ class LHCOReader;
 class ROOTReader;
 class DelphesTreeReader;
 class DelfesTreeReader;
+class BinaryEventFormat;
 
 class RecLeptonFormat : public RecParticleFormat
 {
@@ -51,6 +53,7 @@ class RecLeptonFormat : public RecParticleFormat
   friend class ROOTReader;
   friend class DelphesTreeReader;
   friend class DelfesTreeReader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
@@ -60,7 +63,7 @@ class RecLeptonFormat : public RecParticleFormat
   Bool_t charge_;       /// charge of the particle 0 = -1, 1 = +1
   Float_t sumET_isol_;  /// sumET in an isolation cone
   Float_t sumPT_isol_;  /// sumPT in an isolation cone
-  std::vector<IsolationConeType> isolCones_; // isolation cones
+  ArenaVector<IsolationConeType> isolCones_; // isolation cones
 
   // -------------------------------------------------------------
   //                        method members
@@ -116,9 +119,13 @@ class RecLeptonFormat : public RecParticleFormat
     else return 0; }
 
   /// get the collection of isolation cones
-  const std::vector<IsolationConeType>& isolCones() const
+  const ArenaVector<IsolationConeType>& isolCones() const
   { return isolCones_; }
 
+  /// Taking the storage of the isolation cones from the arena of the event
+  void SetArena(EventArena* arena)
+  { isolCones_.SetArena(arena); }
+
   /// giving a new isolation cone entry
   IsolationConeType* GetNewIsolCone()
   {
@@ -45,6 +45,7 @@ class DelphesTreeReader;
 class DelfesTreeReader;
 class DetectorDelphes;
 class DetectorDelfes;
+class BinaryEventFormat;
 
 class RecParticleFormat : public ParticleBaseFormat
 {
@@ -54,6 +55,7 @@ class RecParticleFormat : public ParticleBaseFormat
   friend class DelfesTreeReader;
   friend class DetectorDelphes;
   friend class DetectorDelfes;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
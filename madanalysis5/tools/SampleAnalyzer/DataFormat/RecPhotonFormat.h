@@ -33,6 +33,7 @@
 
 // RecParticleFormat
 #include "SampleAnalyzer/DataFormat/IsolationConeType.h"
+#include "SampleAnalyzer/DataFormat/ArenaVector.h"
 #include "SampleAnalyzer/DataFormat/RecParticleFormat.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
@@ -41,18 +42,20 @@ namespace MA5
 
 class LHCOReader;
 class ROOTReader;
+class BinaryEventFormat;
 
 class RecPhotonFormat : public RecParticleFormat
 {
 
   friend class LHCOReader;
   friend class ROOTReader;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
   // -------------------------------------------------------------             
  protected:
-  std::vector<IsolationConeType> isolCones_; // isolation cones
+  ArenaVector<IsolationConeType> isolCones_; // isolation cones
 
 
   // -------------------------------------------------------------
@@ -82,9 +85,13 @@ class RecPhotonFormat : public RecParticleFormat
   }
 
   /// get the collection of isolation cones
-  const std::vector<IsolationConeType>& isolCones() const
+  const ArenaVector<IsolationConeType>& isolCones() const
   { return isolCones_; }
 
+  /// Taking the storage of the isolation cones from the arena of the event
+  void SetArena(EventArena* arena)
+  { isolCones_.SetArena(arena); }
+
   /// giving a new isolation cone entry
   IsolationConeType* GetNewIsolCone()
   {
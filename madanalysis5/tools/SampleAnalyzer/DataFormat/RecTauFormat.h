@@ -44,6 +44,7 @@ class DelphesTreeReader;
 class DelfesTreeReader;
 class DetectorDelphes;
 class DetectorDelfes;
+class BinaryEventFormat;
 
 class RecTauFormat : public RecParticleFormat
 {
@@ -55,6 +56,7 @@ class RecTauFormat : public RecParticleFormat
   friend class DelfesTreeReader;
   friend class DetectorDelphes;
   friend class DetectorDelfes;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
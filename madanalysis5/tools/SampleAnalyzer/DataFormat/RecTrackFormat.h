@@ -33,6 +33,7 @@
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/DataFormat/IsolationConeType.h"
+#include "SampleAnalyzer/DataFormat/ArenaVector.h"
 #include "SampleAnalyzer/DataFormat/ParticleBaseFormat.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
@@ -45,6 +46,7 @@ class DelphesTreeReader;
 class DelfesTreeReader;
 class DetectorDelphes;
 class DetectorDelfes;
+class BinaryEventFormat;
 
 class RecTrackFormat : public ParticleBaseFormat
 {
@@ -59,6 +61,7 @@ class RecTrackFormat : public ParticleBaseFormat
   friend class DelfesTreeReader;
   friend class DetectorDelphes;
   friend class DetectorDelfes;
+  friend class BinaryEventFormat;
 
   // -------------------------------------------------------------
   //                        data members
@@ -69,7 +72,7 @@ class RecTrackFormat : public ParticleBaseFormat
   Bool_t charge_;      /// electric charge
   Double_t etaOuter_;  /// eta @ first layer of calo
   Double_t phiOuter_;  /// phi @ first layer of calo
-  std::vector<IsolationConeType> isolCones_; // isolation cones
+  ArenaVector<IsolationConeType> isolCones_; // isolation cones
 
   // -------------------------------------------------------------
   //                        method members
@@ -121,6 +124,10 @@ class RecTrackFormat : public ParticleBaseFormat
   const int charge() const
   {if (charge_) return +1; else return -1;}
 
+  /// Taking the storage of the isolation cones from the arena of the event
+  void SetArena(EventArena* arena)
+  { isolCones_.SetArena(arena); }
+
   /// giving a new isolation cone entry
   IsolationConeType* GetNewIsolCone()
   {
@@ -129,7 +136,7 @@ class RecTrackFormat : public ParticleBaseFormat
   }
 
   /// get the collection of isolation cones
-  const std::vector<IsolationConeType>& isolCones() const
+  const ArenaVector<IsolationConeType>& isolCones() const
   { return isolCones_; }
 
 };
@@ -174,20 +174,6 @@ bool DelfesTreeReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEven
   // Mother pointer assignment
   for (unsigned int i=0; i<myEvent.mc()->particles_.size();i++)
   {
-    MCParticleFormat& part = myEvent.mc()->particles_[i];
-
-    // MET, MHT, TET, THT
-    if (part.statuscode()==1 && !PHYSICS->Id->IsInvisible(part))
-    {
-      myEvent.mc()->MET_ -= part.momentum();
-      myEvent.mc()->TET_ += part.pt();
-      if (PHYSICS->Id->IsHadronic(part))
-      {
-        myEvent.mc()->MHT_ -= part.momentum();
-        myEvent.mc()->THT_ += part.pt(); 
-      }
-    }
-    
     /*    unsigned int index1=myEvent.mc()->particles_[i].mothup1_;
     unsigned int index2=myEvent.mc()->particles_[i].mothup2_;
     if (index1!=0 && index2!=0)
@@ -204,18 +190,15 @@ bool DelfesTreeReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEven
       }
 
       myEvent.mc()->particles_[i].mother1_ = &myEvent.mc()->particles_[index1-1];
-      myEvent.mc()->particles_[index1-1].daughters_.push_back(&myEvent.mc()->particles_[i]);
+      myEvent.mc()->decays_.AddEdge(index1-1,i);
       myEvent.mc()->particles_[i].mother2_ = &myEvent.mc()->particles_[index2-1];
-      myEvent.mc()->particles_[index2-1].daughters_.push_back(&myEvent.mc()->particles_[i]);
+      myEvent.mc()->decays_.AddEdge(index2-1,i);
     }
     */
   }
 
-  // Finalize event
-  myEvent.mc()->MET_.momentum().SetPz(0.);
-  myEvent.mc()->MET_.momentum().SetE(myEvent.mc()->MET_.momentum().Pt());
-  myEvent.mc()->MHT_.momentum().SetPz(0.);
-  myEvent.mc()->MHT_.momentum().SetE(myEvent.mc()->MHT_.momentum().Pt());
+  // Decay graph
+  myEvent.mc()->decays_.Build(myEvent.mc()->particles_);
 
   // Normal end
   return true; 
@@ -106,7 +106,8 @@ bool JetClusteringCDFJetClu::Initialize(const std::map<std::string,std::string>&
     }
 
     // other
-    else SettingsCommonPart(key,it->second);
+    else if (!SettingsFastJetPart(it->first,it->second))
+      SettingsCommonPart(key,it->second);
   }
 
   // Creating plugin
@@ -115,7 +116,7 @@ bool JetClusteringCDFJetClu::Initialize(const std::map<std::string,std::string>&
   // Creating jet definition
   JetDefinition_ = new fastjet::JetDefinition(Plugin_);  
 
-  return true;
+  return InitializeJetCollections();
 }
 
 
@@ -63,6 +63,10 @@ class JetClusteringCDFJetClu: public JetClusteringPlugin
     /// Destructor
     virtual ~JetClusteringCDFJetClu () {}
 
+    /// Creating a new instance of the clusterer (multi-threaded mode)
+    virtual JetClustererBase* Clone() const
+    { return new JetClusteringCDFJetClu(); }
+
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options);
 
@@ -106,7 +106,8 @@ bool JetClusteringCDFMidpoint::Initialize(const std::map<std::string,std::string
     }
 
     // other
-    else SettingsCommonPart(key,it->second);
+    else if (!SettingsFastJetPart(it->first,it->second))
+      SettingsCommonPart(key,it->second);
   }
 
   // Creating plugin
@@ -116,7 +117,7 @@ bool JetClusteringCDFMidpoint::Initialize(const std::map<std::string,std::string
   // Creating jet definition
   JetDefinition_ = new fastjet::JetDefinition(Plugin_);
 
-  return true;
+  return InitializeJetCollections();
 }
 
 
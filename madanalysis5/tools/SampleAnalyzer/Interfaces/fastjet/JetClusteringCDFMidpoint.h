@@ -62,6 +62,10 @@ class JetClusteringCDFMidpoint: public JetClusteringPlugin
     /// Destructor
     virtual ~JetClusteringCDFMidpoint() {}
 
+    /// Creating a new instance of the clusterer (multi-threaded mode)
+    virtual JetClustererBase* Clone() const
+    { return new JetClusteringCDFMidpoint(); }
+
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options);
 
@@ -30,21 +30,271 @@
 #include <fastjet/ClusterSequence.hh>
 #include <fastjet/PseudoJet.hh>
 
+// POSIX headers
+#include <pthread.h>
+
 using namespace MA5;
 
 
+namespace
+{
+
+/// Clustering of an additional jet definition (possibly in its own thread).
+/// Only the jets and the indices of their constituents are produced: the
+/// event is filled afterwards by the calling thread.
+struct JetCollectionTask
+{
+  const std::vector<fastjet::PseudoJet>* inputs;
+  const fastjet::JetDefinition*          definition;
+  Double_t                               ptmin;
+  Bool_t                                 exclusive;
+  Bool_t                                 failed;
+  std::vector<fastjet::PseudoJet>        jets;
+  std::vector< std::vector<Int_t> >      constituents;
+};
+
+void ClusterJetCollection(JetCollectionTask& task)
+{
+  fastjet::ClusterSequence clust_seq(*task.inputs, *task.definition);
+  if (task.exclusive) task.jets = clust_seq.exclusive_jets(task.ptmin);
+  else task.jets = clust_seq.inclusive_jets(task.ptmin);
+  task.constituents.resize(task.jets.size());
+  for (unsigned int i=0;i<task.jets.size();i++)
+  {
+    std::vector<fastjet::PseudoJet> constituents = 
+      clust_seq.constituents(task.jets[i]);
+    task.constituents[i].resize(constituents.size());
+    for (unsigned int j=0;j<constituents.size();j++)
+      task.constituents[i][j] = constituents[j].user_index();
+  }
+}
+
+/// Thread function: an exception cannot leave a thread, so a failure is 
+/// only flagged and the clustering is redone by the calling thread
+void* ClusterJetCollectionThread(void* arg)
+{
+  JetCollectionTask* task = static_cast<JetCollectionTask*>(arg);
+  try
+  {
+    ClusterJetCollection(*task);
+  }
+  catch (...)
+  {
+    task->failed = true;
+  }
+  return 0;
+}
+
+/// Threads clustering the additional jet definitions. The destructor joins
+/// the threads still running, so that the tasks and the inputs they use
+/// cannot be destroyed under them (e.g. when the main clustering throws)
+class JetCollectionThreads
+{
+  public:
+    JetCollectionThreads(std::vector<JetCollectionTask>& tasks)
+      : tasks_(tasks), threads_(tasks.size()), started_(tasks.size(),false)
+    {}
+
+    ~JetCollectionThreads()
+    {
+      for (unsigned int i=0;i<threads_.size();i++)
+        if (started_[i]) pthread_join(threads_[i],0);
+    }
+
+    /// Starting the clustering of a task in its own thread
+    void Start(unsigned int i)
+    {
+      started_[i] = (pthread_create(&threads_[i],0,
+                         ClusterJetCollectionThread,&tasks_[i])==0);
+    }
+
+    /// Waiting for the result of a task (clustered here if the thread
+    /// could not be created or if it failed)
+    void Wait(unsigned int i)
+    {
+      if (started_[i])
+      {
+        pthread_join(threads_[i],0);
+        started_[i]=false;
+      }
+      else tasks_[i].failed = true;
+      if (tasks_[i].failed)
+      {
+        tasks_[i].failed = false;
+        ClusterJetCollection(tasks_[i]);
+      }
+    }
+
+  private:
+    JetCollectionThreads(const JetCollectionThreads&);
+    JetCollectionThreads& operator=(const JetCollectionThreads&);
+
+    std::vector<JetCollectionTask>& tasks_;
+    std::vector<pthread_t>          threads_;
+    std::vector<bool>               started_;
+};
+
+}
+
+
 JetClusteringFastJet::JetClusteringFastJet(std::string Algo)
-{ JetAlgorithm_=Algo; JetDefinition_=0; }
+{ JetAlgorithm_=Algo; JetDefinition_=0; parallelMinInputs_=2000; }
 
 JetClusteringFastJet::~JetClusteringFastJet() 
-{ if (JetDefinition_!=0) delete JetDefinition_; }
+{
+  if (JetDefinition_!=0) delete JetDefinition_;
+  for (unsigned int i=0;i<collections_.size();i++)
+    if (collections_[i].definition!=0) delete collections_[i].definition;
+}
 
 
-void JetClusteringFastJet::GetFinalState(const MCParticleFormat* part, std::set<const MCParticleFormat*>& finalstates)
+bool JetClusteringFastJet::SettingsFastJetPart(const std::string& key,
+                                               const std::string& value)
+{
+  std::string lkey = JetClustererBase::Lower(key);
+
+  // isolation.radii
+  if (lkey=="isolation.radii")
+  {
+    if (!isolation_.SetRadii(JetClustererBase::Lower(value)))
+      WARNING << "Using default value isolation.radii = 0.5,0.4,0.3,0.2" 
+              << endmsg;
+    return true;
+  }
+
+  // isolation.track_ptmin
+  if (lkey=="isolation.track_ptmin")
+  {
+    float tmp=0;
+    std::stringstream str;
+    str << value;
+    str >> tmp;
+    if (tmp<0) WARNING << "isolation.track_ptmin must be positive. Using "
+                       << "default value isolation.track_ptmin = " 
+                       << isolation_.trackPtmin() << endmsg;
+    else isolation_.SetTrackPtmin(tmp);
+    return true;
+  }
+
+  // parallel_clustering
+  if (lkey=="parallel_clustering")
+  {
+    int tmp=0;
+    std::stringstream str;
+    str << value;
+    str >> tmp;
+    if (tmp<0) WARNING << "parallel_clustering must be positive. Using default "
+                       << "value parallel_clustering = " << parallelMinInputs_
+                       << endmsg;
+    else parallelMinInputs_=tmp;
+    return true;
+  }
+
+  // jets.<name>.<parameter> (the name keeps its case)
+  if (lkey.find("jets.")!=0) return false;
+  std::string::size_type dot = key.find('.',5);
+  if (dot==std::string::npos || dot==5)
+  {
+    WARNING << "Parameter " << key << " must be written as "
+            << "jets.<name>.<parameter>" << endmsg;
+    return true;
+  }
+  std::string name  = key.substr(5,dot-5);
+  std::string param = lkey.substr(dot+1);
+
+  // Getting the collection or creating it with the default parameters
+  JetCollection* collection = 0;
+  for (unsigned int i=0;i<collections_.size();i++)
+    if (collections_[i].name==name) { collection=&collections_[i]; break; }
+  if (collection==0)
+  {
+    JetCollection tmp;
+    tmp.name       = name;
+    tmp.algorithm  = "antikt";
+    tmp.R          = 0.4;
+    tmp.p          = -1.;
+    tmp.ptmin      = -1.;
+    tmp.exclusive  = false;
+    tmp.definition = 0;
+    collections_.push_back(tmp);
+    collection = &collections_.back();
+  }
+
+  std::stringstream str;
+  str << value;
+  if (param=="algorithm") collection->algorithm = JetClustererBase::Lower(value);
+  else if (param=="r")
+  {
+    float tmp=0;
+    str >> tmp;
+    if (tmp<=0) WARNING << "R must be positive. Using default value R = " 
+                        << collection->R << " for the jets '" << name << "'" 
+                        << endmsg;
+    else collection->R=tmp;
+  }
+  else if (param=="p")
+  {
+    float tmp=0;
+    str >> tmp;
+    collection->p=tmp;
+  }
+  else if (param=="ptmin")
+  {
+    float tmp=0;
+    str >> tmp;
+    if (tmp<0) WARNING << "Ptmin must be positive. Using the Ptmin of the "
+                       << "main jets for the jets '" << name << "'" << endmsg;
+    else collection->ptmin=tmp;
+  }
+  else if (param=="exclusive")
+  {
+    int tmp=0;
+    str >> tmp;
+    if (tmp==1) collection->exclusive=true;
+    else if (tmp==0) collection->exclusive=false;
+    else WARNING << "Exclusive must be equal to 0 or 1. Using default value "
+                 << "Exclusive = 0 for the jets '" << name << "'" << endmsg;
+  }
+  else WARNING << "Parameter " << key << " unknown." << endmsg;
+  return true;
+}
+
+
+bool JetClusteringFastJet::InitializeJetCollections()
+{
+  for (unsigned int i=0;i<collections_.size();i++)
+  {
+    JetCollection& collection = collections_[i];
+    if (collection.ptmin<0) collection.ptmin=Ptmin_;
+    if (collection.algorithm=="kt")
+      collection.definition = new fastjet::JetDefinition(fastjet::kt_algorithm, collection.R);
+    else if (collection.algorithm=="antikt")
+      collection.definition = new fastjet::JetDefinition(fastjet::antikt_algorithm, collection.R);
+    else if (collection.algorithm=="cambridge")
+      collection.definition = new fastjet::JetDefinition(fastjet::cambridge_algorithm, collection.R);
+    else if (collection.algorithm=="genkt")
+      collection.definition = new fastjet::JetDefinition(fastjet::genkt_algorithm, collection.R, collection.p);
+    else
+    {
+      ERROR << "No FastJet algorithm found with the name " 
+            << collection.algorithm << " for the jets '" << collection.name 
+            << "'" << endmsg;
+      return false;
+    }
+  }
+
+  // The FastJet banner is printed now, not concurrently by the threads
+  if (collections_.size()!=0 && parallelMinInputs_!=0)
+    fastjet::ClusterSequence::print_banner();
+  return true;
+}
+
+
+void JetClusteringFastJet::GetFinalState(const MCParticleFormat* part, std::vector<bool>& finalstates)
 {
   for (unsigned int i=0; i<part->daughters().size(); i++)
   {
-    if (PHYSICS->Id->IsFinalState(part->daughters()[i])) finalstates.insert(part->daughters()[i]);
+    if (PHYSICS->Id->IsFinalState(part->daughters()[i])) finalstates[part->daughters().index(i)]=true;
     else return GetFinalState(part->daughters()[i],finalstates);
   }
 }
@@ -59,6 +309,39 @@ Bool_t JetClusteringFastJet::IsLast(const MCParticleFormat* part, EventFormat& m
 }
 
 
+void JetClusteringFastJet::FillIsolationCones(EventFormat& myEvent)
+{
+  if (!isolation_.IsEnabled()) return;
+  if (myEvent.rec()->electrons().empty() && myEvent.rec()->muons().empty() &&
+      myEvent.rec()->photons().empty()) return;
+  isolation_.Fill(*myEvent.mc());
+  FillIsolationCones(myEvent.rec()->electrons(), myEvent.mc()->particles());
+  FillIsolationCones(myEvent.rec()->muons(),     myEvent.mc()->particles());
+  FillIsolationCones(myEvent.rec()->photons(),   myEvent.mc()->particles());
+}
+
+template<typename T>
+void JetClusteringFastJet::FillIsolationCones(std::vector<T>& particles,
+                                   const std::vector<MCParticleFormat>& mc)
+{
+  std::vector<IsolationGrid::Cone> cones;
+  for (unsigned int i=0;i<particles.size();i++)
+  {
+    T& part = particles[i];
+    Int_t self = (part.mc()==0) ? -1 : part.mc()-&mc[0];
+    isolation_.Compute(part.momentum().Eta(), part.momentum().Phi(), self, cones);
+    for (unsigned int j=0;j<cones.size();j++)
+    {
+      IsolationConeType* cone = part.GetNewIsolCone();
+      cone->deltaR_  = isolation_.radii()[j];
+      cone->sumPT_   = cones[j].sumPT;
+      cone->sumET_   = cones[j].sumET;
+      cone->ntracks_ = cones[j].ntracks;
+    }
+  }
+}
+
+
 bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
 {
   if (mySample.mc()==0 || myEvent.mc()==0) return false;
@@ -70,7 +353,7 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
 
   // Veto
   std::vector<bool> vetos(myEvent.mc()->particles().size(),false);
-  std::set<const MCParticleFormat*> vetos2;
+  std::vector<bool> vetos2(myEvent.mc()->particles().size(),false);
 
   // Filling the dataformat with electron/muon
   for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
@@ -174,7 +457,7 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
             myEvent.rec()->MCHadronicTaus_.push_back(&(part));
 
             // Applying efficiency
-            if (!myTAUtagger_->IsIdentified()) continue;
+            if (!myTAUtagger_->IsIdentified(myEvent)) continue;
 
             // Creating reco hadronic taus
             RecTauFormat* myTau = myEvent.rec()->GetNewTau();
@@ -238,6 +521,9 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
     }
   }
 
+  // Isolation cones of the leptons and photons
+  FillIsolationCones(myEvent);
+
   double & TET = myEvent.rec()->TET();
   double & THT = myEvent.rec()->THT();
 
@@ -245,8 +531,6 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
   std::vector<fastjet::PseudoJet> inputs;
   for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
   {
-    const MCParticleFormat& part = myEvent.mc()->particles()[i];
-
     // Selecting input for jet clustering
     if (myEvent.mc()->particles()[i].statuscode()!=1)       continue;
     if (PHYSICS->Id->IsInvisible(myEvent.mc()->particles()[i])) continue;
@@ -255,7 +539,7 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
     if (ExclusiveId_)
     {
       if (vetos[i]) continue;
-      if (vetos2.find(&part)!=vetos2.end()) continue;
+      if (vetos2[i]) continue;
     }
 
     // NonExclusive Id mode
@@ -270,6 +554,22 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
     inputs.back().set_user_index(i);
   }
 
+  // Additional jet definitions: clustered in parallel threads for the large
+  // events (the thread creation is not worth it for small ones). The threads
+  // are declared after the tasks, hence joined before they are destroyed.
+  std::vector<JetCollectionTask> tasks(collections_.size());
+  JetCollectionThreads threads(tasks);
+  bool parallel = parallelMinInputs_!=0 && inputs.size()>=parallelMinInputs_;
+  for (unsigned int i=0;i<collections_.size();i++)
+  {
+    tasks[i].inputs     = &inputs;
+    tasks[i].definition = collections_[i].definition;
+    tasks[i].ptmin      = collections_[i].ptmin;
+    tasks[i].exclusive  = collections_[i].exclusive;
+    tasks[i].failed     = false;
+    if (parallel) threads.Start(i);
+  }
+
   // Clustering
   fastjet::ClusterSequence clust_seq(inputs, *JetDefinition_);
 
@@ -278,15 +578,16 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
   if (Exclusive_) jets = clust_seq.exclusive_jets(0.);
   else jets = clust_seq.inclusive_jets(0.);
 
-  // Calculating the MET  
+  // Calculating the MET (accumulated in double precision, whatever the
+  // storage precision of the momenta)
   ParticleBaseFormat* MET = myEvent.rec()->GetNewMet();
   ParticleBaseFormat* MHT = myEvent.rec()->GetNewMht();
+  Double_t metx=0., mety=0., mhtx=0., mhty=0.;
 
   for (unsigned int i=0;i<jets.size();i++)
   {
-    TLorentzVector q(jets[i].px(),jets[i].py(),jets[i].pz(),jets[i].e());
-    (*MET) -= q;
-    (*MHT) -= q;
+    metx -= jets[i].px(); mety -= jets[i].py();
+    mhtx -= jets[i].px(); mhty -= jets[i].py();
     THT += jets[i].pt();
     TET += jets[i].pt();
   }
@@ -316,35 +617,61 @@ bool JetClusteringFastJet::Execute(SampleFormat& mySample, EventFormat& myEvent)
   {
     for (unsigned int i=0;i<myEvent.rec()->electrons().size();i++)
     {
-      (*MET) -= myEvent.rec()->electrons()[i].momentum();
+      metx -= myEvent.rec()->electrons()[i].momentum().Px();
+      mety -= myEvent.rec()->electrons()[i].momentum().Py();
       TET += myEvent.rec()->electrons()[i].pt();
     }
     for (unsigned int i=0;i<myEvent.rec()->photons().size();i++)
     {
-      (*MET) -= myEvent.rec()->photons()[i].momentum();
+      metx -= myEvent.rec()->photons()[i].momentum().Px();
+      mety -= myEvent.rec()->photons()[i].momentum().Py();
       TET += myEvent.rec()->photons()[i].pt();
     }
     for (unsigned int i=0;i<myEvent.rec()->taus().size();i++)
     {
-      (*MET) -= myEvent.rec()->taus()[i].momentum();
+      metx -= myEvent.rec()->taus()[i].momentum().Px();
+      mety -= myEvent.rec()->taus()[i].momentum().Py();
       TET += myEvent.rec()->taus()[i].pt();
     }
   }
 
   for (unsigned int i=0;i<myEvent.rec()->muons().size();i++)
   {
-    (*MET) -= myEvent.rec()->muons()[i].momentum();
+    metx -= myEvent.rec()->muons()[i].momentum().Px();
+    mety -= myEvent.rec()->muons()[i].momentum().Py();
     TET += myEvent.rec()->muons()[i].pt();
   }
 
-  MET->momentum().SetPz(0.);
+  MET->momentum().SetPxPyPzE(metx,mety,0.,0.);
   MET->momentum().SetE(MET->momentum().Pt());
-  MHT->momentum().SetPz(0.);
+  MHT->momentum().SetPxPyPzE(mhtx,mhty,0.,0.);
   MHT->momentum().SetE(MHT->momentum().Pt());
 
   myBtagger_->Execute(mySample,myEvent);
   myTAUtagger_->Execute(mySample,myEvent);
 
+  // Filling the named jet collections (not tagged)
+  for (unsigned int i=0;i<collections_.size();i++)
+  {
+    threads.Wait(i);
+    const std::string& name = collections_[i].name;
+    myEvent.rec()->jets(name); // the collection exists even without jets
+    for (unsigned int j=0;j<tasks[i].jets.size();j++)
+    {
+      const fastjet::PseudoJet& myJet = tasks[i].jets[j];
+      RecJetFormat * jet = myEvent.rec()->GetNewJet(name);
+      jet->setMomentum(TLorentzVector(myJet.px(),myJet.py(),myJet.pz(),myJet.e()));
+      UInt_t tracks = 0;
+      for (unsigned int k=0;k<tasks[i].constituents[j].size();k++)
+      {
+        Int_t index = tasks[i].constituents[j][k];
+        jet->AddConstituent(index);
+        if (PDG->IsCharged(myEvent.mc()->particles()[index].pdgid())) tracks++;
+      }
+      jet->ntracks_ = tracks;
+    }
+  }
+
   return true;
 }
 
@@ -26,12 +26,16 @@
 #define JET_CLUSTERING_FASTJET_H
 
 
+//STL headers
+#include <vector>
+
 //SampleAnalyser headers
 #include "SampleAnalyzer/DataFormat/EventFormat.h"
 #include "SampleAnalyzer/DataFormat/SampleFormat.h"
 #include "SampleAnalyzer/Service/Physics.h"
 #include "SampleAnalyzer/Service/PDGService.h"
 #include "SampleAnalyzer/JetClustering/JetClustererBase.h"
+#include "SampleAnalyzer/JetClustering/IsolationGrid.h"
 
 namespace fastjet
 {
@@ -55,6 +59,31 @@ class JetClusteringFastJet: public JetClustererBase
     /// Jet definition
     fastjet::JetDefinition* JetDefinition_;
 
+    /// Additional jet definition, clustered on the same inputs as the main
+    /// one and filling the named jet collection of RecEventFormat
+    struct JetCollection
+    {
+      std::string             name;
+      std::string             algorithm;
+      Double_t                R;
+      Double_t                p;
+      Double_t                ptmin;
+      Bool_t                  exclusive;
+      fastjet::JetDefinition* definition;
+    };
+    std::vector<JetCollection> collections_;
+
+    /// Minimum number of inputs for clustering the jet definitions in 
+    /// parallel threads (0 = never). The threads are created for each event:
+    /// the creation and the join of a thread cost ~15 us (CPU time measured
+    /// with std::clock over 20000 create/join of an empty pthread, -O2),
+    /// negligible compared to the clustering of 2000 inputs (~ms) but not 
+    /// to that of a few hundreds.
+    UInt_t parallelMinInputs_;
+
+    /// Isolation cones of the leptons and photons
+    IsolationGrid isolation_;
+
 
 //---------------------------------------------------------------------------------
 //                                method members
@@ -73,11 +102,32 @@ class JetClusteringFastJet: public JetClustererBase
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options)=0;
 
+    /// No parallel clustering when the events are analyzed by several threads
+    virtual void DisableThreads()
+    { parallelMinInputs_=0; }
+
+ protected:
+
+    /// Reading the options specific to the FastJet clustering
+    ///   jets.<name>.algorithm = kt, antikt, cambridge or genkt
+    ///   jets.<name>.R, jets.<name>.p, jets.<name>.ptmin, jets.<name>.exclusive
+    ///   parallel_clustering = minimum number of inputs (0 = never)
+    ///   isolation.radii = list of cone radii (none = no isolation cone)
+    ///   isolation.track_ptmin = minimum pt of the tracks in the cones
+    /// Returns false if the option is not one of them.
+    bool SettingsFastJetPart(const std::string& key, const std::string& value);
+
+    /// Creating the additional jet definitions (end of Initialize)
+    bool InitializeJetCollections();
+
  private:
     Bool_t IsLast(const MCParticleFormat* part, EventFormat& myEvent);
     Bool_t ComingFromHadronDecay(const MCParticleFormat* part, const SampleFormat& mySample);
     Bool_t IrrelevantPhoton(const MCParticleFormat* part, const SampleFormat& mySample);
-    void GetFinalState(const MCParticleFormat* part, std::set<const MCParticleFormat*>& finalstates);
+    void GetFinalState(const MCParticleFormat* part, std::vector<bool>& finalstates);
+    void FillIsolationCones(EventFormat& myEvent);
+    template<typename T> void FillIsolationCones(std::vector<T>& particles,
+                                  const std::vector<MCParticleFormat>& mc);
  
 
 };
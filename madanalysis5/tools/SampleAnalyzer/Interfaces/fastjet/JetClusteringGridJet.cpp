@@ -82,7 +82,8 @@ bool JetClusteringGridJet::Initialize(const std::map<std::string,std::string>& o
     }
 
     // other
-    else SettingsCommonPart(key,it->second);
+    else if (!SettingsFastJetPart(it->first,it->second))
+      SettingsCommonPart(key,it->second);
   }
 
   // Creating Plugin
@@ -91,7 +92,7 @@ bool JetClusteringGridJet::Initialize(const std::map<std::string,std::string>& o
   // Creating jet definition
   JetDefinition_ = new fastjet::JetDefinition(Plugin_);  
 
-  return true;
+  return InitializeJetCollections();
 }
 
 
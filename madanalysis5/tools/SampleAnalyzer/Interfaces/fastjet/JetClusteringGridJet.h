@@ -57,6 +57,10 @@ class JetClusteringGridJet: public JetClusteringPlugin
     /// Destructor
     virtual ~JetClusteringGridJet () {}
 
+    /// Creating a new instance of the clusterer (multi-threaded mode)
+    virtual JetClustererBase* Clone() const
+    { return new JetClusteringGridJet(); }
+
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options);
 
@@ -107,7 +107,8 @@ bool JetClusteringSISCone::Initialize(const std::map<std::string,std::string>& o
     }
 
     // other
-    else SettingsCommonPart(key,it->second);
+    else if (!SettingsFastJetPart(it->first,it->second))
+      SettingsCommonPart(key,it->second);
   }
 
   // Creating plugin
@@ -116,7 +117,7 @@ bool JetClusteringSISCone::Initialize(const std::map<std::string,std::string>& o
   // Creating jet definition
   JetDefinition_ = new fastjet::JetDefinition(Plugin_);  
 
-  return true;
+  return InitializeJetCollections();
 }
 
     /// Print parameters
@@ -62,6 +62,10 @@ class JetClusteringSISCone: public JetClusteringPlugin
     /// Destructor
     virtual ~JetClusteringSISCone () {}
 
+    /// Creating a new instance of the clusterer (multi-threaded mode)
+    virtual JetClustererBase* Clone() const
+    { return new JetClusteringSISCone(); }
+
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options);
 
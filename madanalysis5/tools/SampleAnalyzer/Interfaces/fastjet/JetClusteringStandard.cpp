@@ -93,7 +93,8 @@ bool JetClusteringStandard::Initialize(const std::map<std::string,std::string>&
     }
 
     // other
-    else SettingsCommonPart(key,it->second);
+    else if (!SettingsFastJetPart(it->first,it->second))
+      SettingsCommonPart(key,it->second);
 
   }
 
@@ -121,7 +122,7 @@ bool JetClusteringStandard::Initialize(const std::map<std::string,std::string>&
     return false;
   }
 
-  return true;
+  return InitializeJetCollections();
 }
 
 
@@ -58,6 +58,10 @@ class JetClusteringStandard: public JetClusteringFastJet
     virtual ~JetClusteringStandard() 
     { }
 
+    /// Creating a new instance of the clusterer (multi-threaded mode)
+    virtual JetClustererBase* Clone() const
+    { return new JetClusteringStandard(JetAlgorithm_); }
+
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options);
 
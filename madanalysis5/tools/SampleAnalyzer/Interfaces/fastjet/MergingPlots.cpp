@@ -38,13 +38,6 @@
 
 using namespace MA5;
 
-/*
-extern"C"
-{
-  void ktclus_(int *imode, double PP[512][4], int* NN, double* ECUT, double Y[512]);
-}
-*/
-
 
 bool MergingPlots::Initialize(const Configuration& cfg,
              const std::map<std::string,std::string>& parameters)
@@ -53,6 +46,8 @@ bool MergingPlots::Initialize(const Configuration& cfg,
   merging_njets_=0;
   merging_nqmatch_=4;
   merging_nosingrad_=false;
+  merging_native_=false;
+  Int_t kt_mode=ExclusiveKt::FASTJET;
 
   // Reading options
   for (std::map<std::string,std::string>::const_iterator it=parameters.begin();
@@ -64,6 +59,32 @@ bool MergingPlots::Initialize(const Configuration& cfg,
       str << it->second;
       str >> merging_njets_;
     }
+    else if (it->first=="engine")
+    {
+      if (it->second=="fastjet") merging_native_=false;
+      else if (it->second=="native") merging_native_=true;
+      else
+      {
+        ERROR << "DJR engine '" << it->second << "' is unknown. "
+              << "Possible values are 'fastjet' and 'native'." << endmsg;
+        return false;
+      }
+    }
+    else if (it->first=="kt_mode")
+    {
+      if (it->second!="fastjet")
+      {
+        std::stringstream str;
+        str << it->second;
+        if (!(str >> kt_mode))
+        {
+          ERROR << "kt clustering mode '" << it->second << "' is unknown. "
+                << "Possible values are 'fastjet' and the IMODE of KTCLUS."
+                << endmsg;
+          return false;
+        }
+      }
+    }
     else
     {
       WARNING << "parameter '" << it->first 
@@ -88,7 +109,19 @@ bool MergingPlots::Initialize(const Configuration& cfg,
   }
 
   // Initializing clustering algorithm
-  JetDefinition_ = new fastjet::JetDefinition(fastjet::kt_algorithm,1.0);
+  if (merging_native_)
+  {
+    JetDefinition_ = 0;
+    if (!ExclusiveKt_.SetMode(kt_mode)) return false;
+    if (!ExclusiveKt_.SetR(1.0)) return false;
+  }
+  else
+  {
+    if (kt_mode!=ExclusiveKt::FASTJET)
+      WARNING << "parameter 'kt_mode' is only used by the native engine "
+              << "and will be ignored." << endmsg;
+    JetDefinition_ = new fastjet::JetDefinition(fastjet::kt_algorithm,1.0);
+  }
   return true;
 }
 
@@ -109,7 +142,8 @@ void MergingPlots::Execute(SampleFormat& mySample, const EventFormat& myEvent)
 
   // Getting DJR observables
   std::vector<Double_t> DJRvalues(DJR_.size(),0.);
-  ExtractDJR(inputs,DJRvalues);
+  if (merging_native_) ExtractDJRnative(inputs,DJRvalues);
+  else ExtractDJR(inputs,DJRvalues);
 
 
   // Getting results
@@ -179,6 +213,47 @@ void MergingPlots::Execute(SampleFormat& mySample, const EventFormat& myEvent)
 
 }
 
+bool MergingPlots::Merge(const AnalyzerBase& other)
+{
+  // Safety
+  const MergingPlots* replica = dynamic_cast<const MergingPlots*>(&other);
+  if (replica==0 || replica->DJR_.size()!=DJR_.size()) return false;
+
+  // Merging DJR plots
+  bool ok=true;
+  for (unsigned int i=0;i<DJR_.size();i++)
+  {
+    if (!DJR_[i].total->Merge(*replica->DJR_[i].total)) ok=false;
+    for (unsigned int j=0;j<DJR_[i].contribution.size();j++)
+      if (!DJR_[i].contribution[j]->Merge(*replica->DJR_[i].contribution[j])) ok=false;
+  }
+  return ok;
+}
+
+
+void MergingPlots::Write_BinaryFormat(std::ostream& output) const
+{
+  for (unsigned int i=0;i<DJR_.size();i++)
+  {
+    DJR_[i].total->Write_BinaryFormat(output);
+    for (unsigned int j=0;j<DJR_[i].contribution.size();j++)
+      DJR_[i].contribution[j]->Write_BinaryFormat(output);
+  }
+}
+
+
+bool MergingPlots::Read_BinaryFormat(std::istream& input)
+{
+  for (unsigned int i=0;i<DJR_.size();i++)
+  {
+    if (!DJR_[i].total->Read_BinaryFormat(input)) return false;
+    for (unsigned int j=0;j<DJR_[i].contribution.size();j++)
+      if (!DJR_[i].contribution[j]->Read_BinaryFormat(input)) return false;
+  }
+  return true;
+}
+
+
 void MergingPlots::Finalize(const SampleFormat& summary, const std::vector<SampleFormat>& files)
 {
   // Saving plots into file
@@ -192,7 +267,8 @@ void MergingPlots::Finalize(const SampleFormat& summary, const std::vector<Sampl
   DJR_.clear();
 
   // Free memory allocation
-  if (JetDefinition_==0) delete JetDefinition_;
+  if (JetDefinition_!=0) delete JetDefinition_;
+  JetDefinition_=0;
 }
 
 
@@ -205,29 +281,6 @@ Double_t MergingPlots::rapidity(Double_t px, Double_t py, Double_t pz)
 }
 
 
-void MergingPlots::ExtractDJRwithFortran(const std::vector<fastjet::PseudoJet>& inputs,std::vector<Double_t>& DJRvalues)
-{
-  double PP[512][4];
-  UNUSED(PP);
-  for (unsigned int i=0;i<inputs.size();i++)
-  {
-    PP[i][0]=inputs[i].px();
-    PP[i][1]=inputs[i].py();
-    PP[i][2]=inputs[i].pz();
-    PP[i][3]=inputs[i].e();
-  }
-  //  int IMODE = 4313;
-  //  int NN = inputs.size();
-  //  if (NN>512) NN=512;
-  //  double ECUT=1.;
-  double Y[512];
-  for (unsigned int i=0;i<512;i++) Y[i]=0;
-  //if (NN!=0) ktclus_(&IMODE,PP,&NN,&ECUT,Y);
-
-  for (unsigned int i=0;i<DJRvalues.size();i++)
-  DJRvalues[i]=Y[i];
-}
-
 void MergingPlots::ExtractDJR(const std::vector<fastjet::PseudoJet>& inputs,std::vector<Double_t>& DJRvalues)
 {
   // JetDefinition_
@@ -236,6 +289,18 @@ void MergingPlots::ExtractDJR(const std::vector<fastjet::PseudoJet>& inputs,std:
   DJRvalues[i]=sequence.exclusive_dmerge(i);
 }
 
+void MergingPlots::ExtractDJRnative(const std::vector<fastjet::PseudoJet>& inputs,std::vector<Double_t>& DJRvalues)
+{
+  // All the merging scales are obtained in a single clustering, the
+  // buffers of ExclusiveKt_ being kept from one event to the other
+  ExclusiveKt_.Clear();
+  for (unsigned int i=0;i<inputs.size();i++)
+    ExclusiveKt_.Add(inputs[i].px(),inputs[i].py(),inputs[i].pz(),inputs[i].e());
+  ExclusiveKt_.Cluster();
+  for (unsigned int i=0;i<DJRvalues.size();i++)
+  DJRvalues[i]=ExclusiveKt_.dmerge(i);
+}
+
 
 /// Saving merging plots in the text output file
 void MergingPlots::Write_TextFormat(SAFWriter& output)
@@ -38,6 +38,7 @@
 #include "SampleAnalyzer/Plot/MergingPlotType.h"
 #include "SampleAnalyzer/Writer/SAFWriter.h"
 #include "SampleAnalyzer/Analyzer/AnalyzerBase.h"
+#include "SampleAnalyzer/JetClustering/ExclusiveKt.h"
 
 
 namespace fastjet
@@ -63,10 +64,14 @@ class MergingPlots : public AnalyzerBase
   /// clustering algorithm [FastJet]
   fastjet::JetDefinition* JetDefinition_;
 
+  /// clustering algorithm [native exclusive kt, option engine=native]
+  ExclusiveKt ExclusiveKt_;
+
   /// User configuration
   UInt_t  merging_njets_;
   UChar_t merging_nqmatch_;
   Bool_t  merging_nosingrad_;
+  Bool_t  merging_native_;
 
 
 //---------------------------------------------------------------------------------
@@ -84,6 +89,17 @@ class MergingPlots : public AnalyzerBase
   /// Execution
   virtual void Execute(SampleFormat& sample, const EventFormat& event);
 
+  /// Creating a new instance (multi-threaded/process modes)
+  virtual AnalyzerBase* Clone() const
+  { return new MergingPlots(); }
+
+  /// Adding the DJR plots of a replica
+  virtual bool Merge(const AnalyzerBase& other);
+
+  /// Dumping/restoring the DJR plots (multi-process mode)
+  virtual void Write_BinaryFormat(std::ostream& output) const;
+  virtual bool Read_BinaryFormat(std::istream& input);
+
   /// Saving merging plots in the output file
   void Write_TextFormat(SAFWriter& output);
   void Write_RootFormat(TFile* output);
@@ -99,7 +115,7 @@ class MergingPlots : public AnalyzerBase
 
 
   void ExtractDJR(const std::vector<fastjet::PseudoJet>& inputs,std::vector<Double_t>& DJRvalues);
-  void ExtractDJRwithFortran(const std::vector<fastjet::PseudoJet>& inputs,std::vector<Double_t>& DJRvalues);
+  void ExtractDJRnative(const std::vector<fastjet::PseudoJet>& inputs,std::vector<Double_t>& DJRvalues);
 
   Double_t rapidity(Double_t px, Double_t py, Double_t pz);
 
@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+#include <algorithm>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/JetClustering/DeltaRMatcher.h"
+#include "SampleAnalyzer/DataFormat/MCParticleFormat.h"
+
+using namespace MA5;
+
+
+namespace
+{
+  /// Candidate of DeltaRMatcher::KeepClosest
+  struct MatchedCandidate
+  {
+    const MCParticleFormat* mc;
+    Float_t                 dr;
+    UInt_t                  position;
+    UInt_t                  kept;
+
+    bool operator<(const MatchedCandidate& other) const
+    {
+      if (mc!=other.mc) return mc<other.mc;
+      return position<other.position;
+    }
+  };
+
+  bool ByPosition(const MatchedCandidate& a, const MatchedCandidate& b)
+  { return a.position<b.position; }
+
+  /// Bound on the squared DeltaR of the columns which can be matched within
+  /// drmax: the rounding to Float_t can bring a DeltaR slightly above drmax
+  /// down to it (by 2^-24 in relative, or below the smallest Float_t)
+  Double_t SquaredBound(Double_t drmax)
+  { return drmax*drmax*(1.+1e-6)+1e-89; }
+}
+
+
+// -----------------------------------------------------------------------------
+// Compute
+// -----------------------------------------------------------------------------
+void DeltaRMatcher::Compute()
+{
+  const UInt_t nrows = rowEta_.size();
+  const UInt_t ncols = colEta_.size();
+  dr2_.resize(nrows*ncols);
+  if (nrows==0 || ncols==0) return;
+
+  const Double_t  twopi   = 2.*M_PI;
+  const Double_t* eta     = &colEta_[0];
+  const Double_t* phi     = &colPhi_[0];
+  const Double_t* penalty = &colPenalty_[0];
+
+  // The phi are in [-pi,pi], so that |dphi| is folded with a single min 
+  // (same value as MALorentzVector::DeltaPhi). The inner loop has no 
+  // branch: it is vectorized by the compiler.
+  for (UInt_t i=0;i<nrows;i++)
+  {
+    const Double_t eta0 = rowEta_[i];
+    const Double_t phi0 = rowPhi_[i];
+    Double_t* out = &dr2_[i*ncols];
+    for (UInt_t j=0;j<ncols;j++)
+    {
+      Double_t deta = eta[j]-eta0;
+      Double_t dphi = std::fabs(phi[j]-phi0);
+      dphi = std::min(dphi,twopi-dphi);
+      out[j] = deta*deta+dphi*dphi+penalty[j];
+    }
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// DisableColumn
+// -----------------------------------------------------------------------------
+void DeltaRMatcher::DisableColumn(UInt_t col)
+{
+  const UInt_t nrows = rowEta_.size();
+  const UInt_t ncols = colEta_.size();
+  colPenalty_[col] = 1e300;
+  for (UInt_t i=0;i<nrows;i++) dr2_[i*ncols+col] = 1e300;
+}
+
+
+// -----------------------------------------------------------------------------
+// Closest
+// -----------------------------------------------------------------------------
+Int_t DeltaRMatcher::Closest(UInt_t row, Double_t drmax) const
+{
+  const UInt_t ncols = colEta_.size();
+  const Double_t cut = SquaredBound(drmax);
+  Int_t best = -1;
+  Double_t bestdr = drmax;
+  for (UInt_t j=0;j<ncols;j++)
+  {
+    if (dr2_[row*ncols+j]>cut) continue;
+    Float_t value = DeltaR(row,j);
+    if (value<=bestdr) { best=j; bestdr=value; }
+  }
+  return best;
+}
+
+
+// -----------------------------------------------------------------------------
+// Within
+// -----------------------------------------------------------------------------
+void DeltaRMatcher::Within(UInt_t row, Double_t drmax,
+                           std::vector<UInt_t>& cols) const
+{
+  cols.clear();
+  const UInt_t ncols = colEta_.size();
+  const Double_t cut = SquaredBound(drmax);
+  for (UInt_t j=0;j<ncols;j++)
+  {
+    if (dr2_[row*ncols+j]>cut) continue;
+    if (DeltaR(row,j)<=drmax) cols.push_back(j);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Match
+// -----------------------------------------------------------------------------
+void DeltaRMatcher::Match(UInt_t row, Double_t drmax, Bool_t exclusive,
+                          std::vector<UInt_t>& cols) const
+{
+  if (!exclusive)
+  {
+    Within(row,drmax,cols);
+    return;
+  }
+  cols.clear();
+  Int_t best = Closest(row,drmax);
+  if (best>=0) cols.push_back(best);
+}
+
+
+// -----------------------------------------------------------------------------
+// MatchAndRemove
+// -----------------------------------------------------------------------------
+void DeltaRMatcher::MatchAndRemove(UInt_t row, Double_t drmax, 
+                                   Bool_t exclusive,
+                                   const std::vector<RecJetFormat*>& columns,
+                                   std::vector<UInt_t>& remaining,
+                                   std::vector<UInt_t>& matched) const
+{
+  matched.clear();
+
+  // Moving the matched columns to the end of the list
+  UInt_t k = 0;
+  const UInt_t n = remaining.size();
+  for (UInt_t j=n;j>0;j--)
+  {
+    if (DeltaR(row,remaining[j-1])<=drmax)
+    {
+      k++;
+      std::swap(remaining[j-1],remaining[n-k]);
+    }
+  }
+
+  // Exclusive: keeping the most energetic one
+  if (exclusive)
+  {
+    while (k>1)
+    {
+      UInt_t& last     = remaining[remaining.size()-1];
+      UInt_t& previous = remaining[remaining.size()-2];
+      if (columns[last]->e() > columns[previous]->e()) std::swap(last,previous);
+      remaining.pop_back();
+      k--;
+    }
+  }
+
+  for (UInt_t j=0;j<k;j++)
+  {
+    matched.push_back(remaining.back());
+    remaining.pop_back();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// KeepClosest
+// -----------------------------------------------------------------------------
+void DeltaRMatcher::KeepClosest(std::vector<RecJetFormat*>& candidates)
+{
+  if (candidates.size()<2) return;
+
+  // Grouping the candidates by generated particle, in their order
+  std::vector<MatchedCandidate> sorted(candidates.size());
+  for (UInt_t i=0;i<candidates.size();i++)
+  {
+    sorted[i].mc       = candidates[i]->mc();
+    sorted[i].dr       = candidates[i]->mc()->dr(candidates[i]);
+    sorted[i].position = i;
+    sorted[i].kept     = i;
+  }
+  std::sort(sorted.begin(),sorted.end());
+
+  // The first candidate of each particle gives the place and the reference
+  // DeltaR; it is replaced by the next candidates closer than the reference
+  UInt_t n = 0;
+  for (UInt_t i=0;i<sorted.size();i++)
+  {
+    if (i==0 || sorted[i].mc!=sorted[i-1].mc) sorted[n++]=sorted[i];
+    else if (sorted[i].dr<sorted[n-1].dr) sorted[n-1].kept=sorted[i].position;
+  }
+  sorted.resize(n);
+  std::sort(sorted.begin(),sorted.end(),ByPosition);
+
+  std::vector<RecJetFormat*> kept(n);
+  for (UInt_t i=0;i<n;i++) kept[i]=candidates[sorted[i].kept];
+  candidates.swap(kept);
+}
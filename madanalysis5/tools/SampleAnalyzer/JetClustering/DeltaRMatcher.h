@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef DELTAR_MATCHER_H
+#define DELTAR_MATCHER_H
+
+// STL headers
+#include <cmath>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/ParticleBaseFormat.h"
+#include "SampleAnalyzer/DataFormat/RecJetFormat.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// DeltaR matching between two collections, shared by the taggers. The rows
+/// are the particles to match (quarks, taus), the columns the objects they
+/// are matched to (jets). The (eta,phi) of both collections are copied into
+/// arrays and the matrix of the squared DeltaR is computed by a loop 
+/// without branch, vectorized by the compiler. The DeltaR are compared once
+/// rounded to Float_t, as the values of ParticleBaseFormat::dr, so that the 
+/// jets matched are exactly those of the loops over dr. Disabled columns 
+/// are never matched. The buffers are kept from one event to the other.
+//////////////////////////////////////////////////////////////////////////////
+class DeltaRMatcher
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  std::vector<Double_t> rowEta_;
+  std::vector<Double_t> rowPhi_;
+  std::vector<Double_t> colEta_;
+  std::vector<Double_t> colPhi_;
+
+  /// 0 for the enabled columns, a huge value for the disabled ones
+  std::vector<Double_t> colPenalty_;
+
+  /// Squared DeltaR, row by row
+  std::vector<Double_t> dr2_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  DeltaRMatcher()
+  { }
+
+  /// Destructor
+  ~DeltaRMatcher()
+  { }
+
+  /// Clearing both collections
+  void Clear()
+  {
+    rowEta_.clear(); rowPhi_.clear();
+    colEta_.clear(); colPhi_.clear(); colPenalty_.clear();
+    dr2_.clear();
+  }
+
+  /// Adding a particle to match
+  void AddRow(const ParticleBaseFormat& part)
+  {
+    rowEta_.push_back(part.momentum().Eta());
+    rowPhi_.push_back(part.momentum().Phi());
+  }
+
+  /// Adding an object to match to
+  void AddColumn(const ParticleBaseFormat& part, Bool_t enabled=true)
+  {
+    colEta_.push_back(part.momentum().Eta());
+    colPhi_.push_back(part.momentum().Phi());
+    colPenalty_.push_back(enabled ? 0. : 1e300);
+  }
+
+  /// Computing the matrix (after adding the rows and the columns)
+  void Compute();
+
+  /// Removing a column from the matching (after Compute)
+  void DisableColumn(UInt_t col);
+
+  /// Sizes
+  UInt_t nrows() const
+  { return rowEta_.size(); }
+  UInt_t ncols() const
+  { return colEta_.size(); }
+
+  /// Squared DeltaR between a row and a column
+  Double_t dr2(UInt_t row, UInt_t col) const
+  { return dr2_[row*colEta_.size()+col]; }
+
+  /// DeltaR between a row and a column, rounded to Float_t as the value of
+  /// ParticleBaseFormat::dr (infinite if the column is disabled)
+  Float_t DeltaR(UInt_t row, UInt_t col) const
+  { return static_cast<Float_t>(std::sqrt(dr2(row,col))); }
+
+  /// Exclusive matching: the closest column with DeltaR <= drmax (the last 
+  /// one in case of equality), -1 if none
+  Int_t Closest(UInt_t row, Double_t drmax) const;
+
+  /// Inclusive matching: all the columns with DeltaR <= drmax
+  void Within(UInt_t row, Double_t drmax, std::vector<UInt_t>& cols) const;
+
+  /// Exclusive or inclusive matching of a row
+  void Match(UInt_t row, Double_t drmax, Bool_t exclusive, 
+             std::vector<UInt_t>& cols) const;
+
+  /// Matching of a row as in the method 3 of the b- and c-taggers. The 
+  /// columns listed in 'remaining' are scanned backwards and the ones 
+  /// within drmax are moved to the end of the list, then removed from it 
+  /// and returned. In exclusive mode, they are compared by pairs from the 
+  /// end of the list and the most energetic one is returned (the first one
+  /// in the list among jets of equal energy).
+  void MatchAndRemove(UInt_t row, Double_t drmax, Bool_t exclusive,
+                      const std::vector<RecJetFormat*>& columns,
+                      std::vector<UInt_t>& remaining,
+                      std::vector<UInt_t>& matched) const;
+
+  /// Keeping only one candidate jet for each generated particle (the 
+  /// candidates must have a mc() particle), at the place of the first one.
+  /// As in the original loop of the taggers, a candidate replaces the 
+  /// first one if it is closer to the particle than the first one.
+  static void KeepClosest(std::vector<RecJetFormat*>& candidates);
+
+};
+
+}
+
+#endif
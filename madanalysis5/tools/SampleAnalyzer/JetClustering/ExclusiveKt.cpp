@@ -0,0 +1,453 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+#include <algorithm>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/JetClustering/ExclusiveKt.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+
+/// Initializing the static member
+const Int_t ExclusiveKt::FASTJET = 0;
+
+
+namespace
+{
+  const Double_t Huge  = 1e300;
+  const Double_t Pi    = 3.14159265358979323846;
+  const Double_t TwoPi = 6.28318530717958647693;
+
+  /// Constants of KTCLUS: pseudorapidity given to the particles along 
+  /// the beam and threshold on the mass
+  const Double_t EtaMax = 10.;
+  const Double_t Eps    = 1e-6;
+
+  /// Constant of FastJet: rapidity given to the massless particles along
+  /// the beam
+  const Double_t MaxRap = 1e5;
+
+  /// Azimuthal angle moved onto ]-pi,pi] (KTMDPI)
+  Double_t MovePhi(Double_t phi)
+  {
+    while (phi> Pi) phi-=TwoPi;
+    while (phi<=-Pi) phi+=TwoPi;
+    return phi;
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+ExclusiveKt::ExclusiveKt()
+{
+  size_=0; njets_=0; R_=1.;
+  SetMode(FASTJET);
+}
+
+
+// -----------------------------------------------------------------------------
+// SetMode
+// -----------------------------------------------------------------------------
+bool ExclusiveKt::SetMode(Int_t imode)
+{
+  if (imode==FASTJET)
+  {
+    imode_=FASTJET; fastjet_=true;
+    type_=4; angle_=2; recom_=1;
+    return true;
+  }
+
+  // Abbreviations of KTCLUS
+  static const Int_t abbreviations[7] = {1111,2111,3111,4111,4211,4212,4223};
+  Int_t mode = imode;
+  if (mode>=1 && mode<=7) mode = abbreviations[mode-1];
+
+  Int_t type  = (mode/1000)%10;
+  Int_t angle = (mode/100)%10;
+  Int_t mono  = (mode/10)%10;
+  Int_t recom = mode%10;
+  if (mode<1000 || mode>9999 || type<1 || type>4 || angle<1 || angle>3 || 
+      mono<1 || mono>2 || recom<1 || recom>3)
+  {
+    ERROR << "the kt clustering mode " << imode << " is not valid" << endmsg;
+    return false;
+  }
+  if (mono==2)
+  {
+    ERROR << "the monotonic definition of the angles (kt clustering mode " 
+          << imode << ") is not supported" << endmsg;
+    return false;
+  }
+
+  imode_=imode; fastjet_=false;
+  type_=type; angle_=angle; recom_=recom;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// SetR
+// -----------------------------------------------------------------------------
+bool ExclusiveKt::SetR(Double_t R)
+{
+  if (R<=0.)
+  {
+    ERROR << "the R parameter of the kt clustering must be positive" << endmsg;
+    return false;
+  }
+  R_=R;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Add
+// -----------------------------------------------------------------------------
+void ExclusiveKt::Add(Double_t px, Double_t py, Double_t pz, Double_t e)
+{
+  if (size_==px_.size())
+  {
+    UInt_t n = std::max(2*size_,64U);
+    px_.resize(n);  py_.resize(n);  pz_.resize(n);  e_.resize(n);
+    pt_.resize(n);  pt2_.resize(n); rap_.resize(n); phi_.resize(n);
+    ux_.resize(n);  uy_.resize(n);  uz_.resize(n);
+    shr_.resize(n); chr_.resize(n); sph_.resize(n); cph_.resize(n);
+    kt2_.resize(n); beam_.resize(n);
+    nn_.resize(n);  nndist_.resize(n); stale_.resize(n);
+    angles_.resize(n);
+  }
+  px_[size_]=px; py_[size_]=py; pz_[size_]=pz; e_[size_]=e;
+  size_++;
+}
+
+
+// -----------------------------------------------------------------------------
+// SetKinematics
+// -----------------------------------------------------------------------------
+void ExclusiveKt::SetKinematics(UInt_t i)
+{
+  const Double_t px=px_[i], py=py_[i], pz=pz_[i];
+  pt2_[i] = px*px+py*py;
+  pt_[i]  = std::sqrt(pt2_[i]);
+
+  // FastJet: PseudoJet::_set_rap_phi
+  if (fastjet_)
+  {
+    const Double_t e = e_[i];
+    Double_t phi = (pt2_[i]==0.) ? 0. : std::atan2(py,px);
+    if (phi<0.)      phi+=TwoPi;
+    if (phi>=TwoPi)  phi-=TwoPi;
+    phi_[i]=phi;
+    if (e==std::fabs(pz) && pt2_[i]==0.)
+    {
+      Double_t rap = MaxRap + std::fabs(pz);
+      rap_[i] = (pz>=0.) ? rap : -rap;
+    }
+    else
+    {
+      Double_t m2 = std::max(0.,(e+pz)*(e-pz)-pt2_[i]);
+      Double_t eplus = e + std::fabs(pz);
+      Double_t rap = 0.5*std::log((pt2_[i]+m2)/(eplus*eplus));
+      rap_[i] = (pz>0.) ? -rap : rap;
+    }
+    return;
+  }
+
+  // KTCLUS: KTCOPY (the particles are put on shell except in the E scheme)
+  Double_t p = std::sqrt(pt2_[i]+pz*pz);
+  if (recom_!=1) e_[i]=p;
+  const Double_t e = e_[i];
+  const Double_t invp = (p==0.) ? 1e10 : 1./p;
+  ux_[i]=px*invp; uy_[i]=py*invp; uz_[i]=pz*invp;
+  Double_t rap = EtaMax+2.;
+  if (pt_[i]*invp > 1./std::cosh(EtaMax))
+  {
+    Double_t m2 = e*e-pz*pz;
+    if (m2<=Eps*e*e || recom_!=1) m2=pt2_[i];
+    rap = std::fabs(0.5*std::log((e+std::fabs(pz))*(e+std::fabs(pz))/m2));
+  }
+  rap_[i] = (pz<0.) ? -rap : rap;
+  phi_[i] = (px==0. && py==0.) ? 0. : std::atan2(py,px);
+}
+
+
+// -----------------------------------------------------------------------------
+// Recombine
+// -----------------------------------------------------------------------------
+void ExclusiveKt::Recombine(UInt_t i, UInt_t j)
+{
+  // E scheme: 4-momentum addition (massless jet with KTCLUS)
+  if (fastjet_ || recom_==1)
+  {
+    px_[i]+=px_[j]; py_[i]+=py_[j]; pz_[i]+=pz_[j];
+    if (fastjet_) e_[i]+=e_[j];
+    else e_[i] = std::sqrt(px_[i]*px_[i]+py_[i]*py_[i]+pz_[i]*pz_[i]);
+    SetKinematics(i);
+    SetDistances(i);
+    return;
+  }
+
+  // pt and pt**2 schemes: weighted (eta,phi) addition
+  Double_t wi = (recom_==2) ? pt_[i] : pt2_[i];
+  Double_t wj = (recom_==2) ? pt_[j] : pt2_[j];
+  Double_t w  = (wi+wj==0.) ? 1. : 1./(wi+wj);
+  rap_[i] = (wi*rap_[i]+wj*rap_[j])*w;
+  phi_[i] = MovePhi(phi_[i]+wj*w*MovePhi(phi_[j]-phi_[i]));
+  pt_[i] += pt_[j];
+  pt2_[i] = pt_[i]*pt_[i];
+
+  // Direction needed by the angular kt
+  if (angle_==1)
+  {
+    px_[i] = pt_[i]*std::cos(phi_[i]);
+    py_[i] = pt_[i]*std::sin(phi_[i]);
+    pz_[i] = pt_[i]*std::sinh(rap_[i]);
+    e_[i]  = pt_[i]*std::cosh(rap_[i]);
+    const Double_t inve = (e_[i]==0.) ? 1. : 1./e_[i];
+    ux_[i]=px_[i]*inve; uy_[i]=py_[i]*inve; uz_[i]=pz_[i]*inve;
+  }
+  SetDistances(i);
+}
+
+
+// -----------------------------------------------------------------------------
+// SetDistances
+// -----------------------------------------------------------------------------
+void ExclusiveKt::SetDistances(UInt_t i)
+{
+  // Weight of the pair distances and distance to the beam (KTSING)
+  if (fastjet_ || angle_!=1)
+  {
+    kt2_[i]  = pt2_[i];
+    beam_[i] = pt2_[i];
+  }
+  else
+  {
+    Double_t costh = uz_[i];
+    if (type_==2)      costh = -costh;
+    else if (type_==4) costh = std::fabs(costh);
+    Double_t r = 2.*(1.-costh);
+    if (r<1e-4) r = ux_[i]*ux_[i]+uy_[i]*uy_[i];
+    kt2_[i]  = e_[i]*e_[i];
+    beam_[i] = kt2_[i]*r;
+  }
+
+  // Half angles used by the QCD emission metric
+  if (angle_==3)
+  {
+    shr_[i] = std::sinh(0.5*rap_[i]);
+    chr_[i] = std::cosh(0.5*rap_[i]);
+    sph_[i] = std::sin(0.5*phi_[i]);
+    cph_[i] = std::cos(0.5*phi_[i]);
+  }
+
+  // No beam in e+e- collisions; KTCLUS normalization: R^2 on the beam side
+  if (type_==1) beam_[i]=Huge;
+  else if (!fastjet_) beam_[i]*=R_*R_;
+}
+
+
+// -----------------------------------------------------------------------------
+// ComputeAngles
+// -----------------------------------------------------------------------------
+void ExclusiveKt::ComputeAngles(UInt_t i, UInt_t first)
+{
+  const UInt_t n = njets_;
+  Double_t* out = &angles_[0];
+
+  // No branch in the loops: they are vectorized by the compiler
+  if (angle_==1)
+  {
+    const Double_t* ux = &ux_[0];
+    const Double_t* uy = &uy_[0];
+    const Double_t* uz = &uz_[0];
+    const Double_t x=ux[i], y=uy[i], z=uz[i];
+    for (UInt_t k=first;k<n;k++)
+      out[k] = 2.*(1.-(ux[k]*x+uy[k]*y+uz[k]*z));
+  }
+  // 2(cosh(deta)-cos(dphi)) = 4 sinh(deta/2)^2 + 4 sin(dphi/2)^2, the 
+  // differences being expanded with the half angles of each jet
+  else if (angle_==3)
+  {
+    const Double_t* shr = &shr_[0];
+    const Double_t* chr = &chr_[0];
+    const Double_t* sph = &sph_[0];
+    const Double_t* cph = &cph_[0];
+    const Double_t sr=shr[i], cr=chr[i], sp=sph[i], cp=cph[i];
+    for (UInt_t k=first;k<n;k++)
+    {
+      Double_t a = shr[k]*cr-chr[k]*sr;
+      Double_t b = sph[k]*cp-cph[k]*sp;
+      out[k] = 4.*(a*a+b*b);
+    }
+  }
+  else
+  {
+    const Double_t* rap = &rap_[0];
+    const Double_t* phi = &phi_[0];
+    const Double_t r=rap[i], f=phi[i];
+    for (UInt_t k=first;k<n;k++)
+    {
+      Double_t drap = rap[k]-r;
+      Double_t dphi = std::fabs(phi[k]-f);
+      dphi = std::min(dphi,TwoPi-dphi);
+      out[k] = drap*drap+dphi*dphi;
+    }
+  }
+  if (i>=first) out[i]=Huge;
+}
+
+
+// -----------------------------------------------------------------------------
+// FindNeighbour
+// -----------------------------------------------------------------------------
+void ExclusiveKt::FindNeighbour(UInt_t i)
+{
+  ComputeAngles(i,0);
+  UInt_t   best = i;
+  Double_t dmin = Huge;
+  for (UInt_t k=0;k<njets_;k++)
+  {
+    if (angles_[k]<dmin) { dmin=angles_[k]; best=k; }
+  }
+  nn_[i]=best;
+  nndist_[i]=dmin;
+}
+
+
+// -----------------------------------------------------------------------------
+// Remove
+// -----------------------------------------------------------------------------
+void ExclusiveKt::Remove(UInt_t i)
+{
+  const UInt_t last = --njets_;
+  if (i!=last)
+  {
+    px_[i]=px_[last];   py_[i]=py_[last];   pz_[i]=pz_[last];
+    e_[i]=e_[last];     pt_[i]=pt_[last];   pt2_[i]=pt2_[last];
+    rap_[i]=rap_[last]; phi_[i]=phi_[last];
+    ux_[i]=ux_[last];   uy_[i]=uy_[last];   uz_[i]=uz_[last];
+    shr_[i]=shr_[last]; chr_[i]=chr_[last];
+    sph_[i]=sph_[last]; cph_[i]=cph_[last];
+    kt2_[i]=kt2_[last]; beam_[i]=beam_[last];
+    nn_[i]=nn_[last];   nndist_[i]=nndist_[last]; stale_[i]=stale_[last];
+  }
+  for (UInt_t k=0;k<njets_;k++)
+    if (nn_[k]==last) nn_[k]=i;
+}
+
+
+// -----------------------------------------------------------------------------
+// Cluster
+// -----------------------------------------------------------------------------
+void ExclusiveKt::Cluster()
+{
+  dmerge_.assign(size_,0.);
+  njets_ = size_;
+  if (size_==0) return;
+  const Double_t pairNorm = fastjet_ ? 1./(R_*R_) : 1.;
+
+  // Kinematics and nearest neighbours of the particles
+  for (UInt_t i=0;i<njets_;i++)
+  {
+    SetKinematics(i);
+    SetDistances(i);
+    nn_[i]=i; nndist_[i]=Huge; stale_[i]=0;
+  }
+  for (UInt_t i=0;i+1<njets_;i++)
+  {
+    ComputeAngles(i,i+1);
+    for (UInt_t k=i+1;k<njets_;k++)
+    {
+      const Double_t angle = angles_[k];
+      if (angle<nndist_[i]) { nndist_[i]=angle; nn_[i]=k; }
+      if (angle<nndist_[k]) { nndist_[k]=angle; nn_[k]=i; }
+    }
+  }
+
+  // Clustering: in e+e- collisions, the last jet is kept
+  const UInt_t nlast = (type_==1) ? 1 : 0;
+  while (njets_>nlast)
+  {
+    const UInt_t n = njets_;
+
+    // Smallest distance: the pair distance of a jet to its neighbour is
+    // the smallest one involving this jet when it is the softest of the two
+    UInt_t   best = 0;
+    Double_t dmin = std::min(kt2_[0]*nndist_[0]*pairNorm,beam_[0]);
+    for (UInt_t i=1;i<n;i++)
+    {
+      Double_t d = std::min(kt2_[i]*nndist_[i]*pairNorm,beam_[i]);
+      if (d<dmin) { dmin=d; best=i; }
+    }
+    dmerge_[n-1] = dmin;
+
+    // Merging with the beam
+    if (nn_[best]==best || beam_[best]<=kt2_[best]*nndist_[best]*pairNorm)
+    {
+      for (UInt_t k=0;k<n;k++)
+        if (nn_[k]==best) stale_[k]=1;
+      Remove(best);
+    }
+
+    // Merging two jets, the new one being compared to all the others. The
+    // jets which were the closest to one of the merged jets keep the new
+    // one as neighbour if it is not further away.
+    else
+    {
+      UInt_t i = best;
+      UInt_t j = nn_[best];
+      for (UInt_t k=0;k<n;k++)
+        if (nn_[k]==i || nn_[k]==j) stale_[k]=1;
+      Recombine(i,j);
+      Remove(j);
+      if (i==n-1) i=j;
+      stale_[i]=0;
+      FindNeighbour(i);
+      for (UInt_t k=0;k<njets_;k++)
+      {
+        if (angles_[k]<=nndist_[k])
+        { nndist_[k]=angles_[k]; nn_[k]=i; stale_[k]=0; }
+      }
+    }
+
+    // Jets whose neighbour disappeared
+    for (UInt_t k=0;k<njets_;k++)
+    {
+      if (stale_[k]==0) continue;
+      stale_[k]=0;
+      if (njets_==1) { nn_[k]=k; nndist_[k]=Huge; }
+      else FindNeighbour(k);
+    }
+  }
+
+  // e+e-: the last jet is never merged (value of KTCLUS)
+  if (type_==1) dmerge_[0]=1e20;
+}
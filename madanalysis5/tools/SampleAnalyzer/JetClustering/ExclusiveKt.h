@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EXCLUSIVE_KT_H
+#define EXCLUSIVE_KT_H
+
+// STL headers
+#include <vector>
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Exclusive kt clustering giving all the merging scales of an event in a
+/// single pass, without FastJet. The value dmerge(n) is the distance at 
+/// which the event goes from n+1 to n jets, as the method exclusive_dmerge 
+/// of FastJet (DJR(n+1) in the merging plots).
+///
+/// The clustering is done with nearest-neighbour caching: each jet keeps its
+/// nearest neighbour in angle, which is enough to find the smallest kt 
+/// distance, and only the jets whose neighbour was merged are updated at 
+/// each step (N^2 on average). The buffers are kept from one event to the 
+/// other.
+///
+/// The distances are defined by a mode following the IMODE argument of 
+/// KTCLUS (ktclusdble.f), IMODE=<TYPE><ANGLE><MONO><RECOM> with
+///   TYPE  : 1=>ee (no beam), 2=>ep, 3=>pe, 4=>pp
+///   ANGLE : 1=>angular kt, 2=>DeltaR, 3=>2(cosh(DeltaEta)-cos(DeltaPhi))
+///   MONO  : 1=>angles derived from the merged jets (only value supported)
+///   RECOM : 1=>massless E scheme, 2=>pt scheme, 3=>pt**2 scheme
+/// including the abbreviations 1 to 7 of KTCLUS. The mode FASTJET (default)
+/// gives the kt_algorithm of FastJet: E scheme and true rapidity.
+/// The distances are normalized as in FastJet (R^2 dividing the pair 
+/// distances); with KTCLUS, the beam distances are multiplied by R^2 
+/// instead, which is the same for R=1. In e+e- mode, the last jet is never
+/// merged and dmerge(0) is set to 1e20 as in KTCLUS.
+//////////////////////////////////////////////////////////////////////////////
+class ExclusiveKt
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ public :
+
+  /// Mode reproducing the kt_algorithm of FastJet
+  static const Int_t FASTJET;
+
+ private :
+
+  /// Clustering mode
+  Int_t    imode_;
+  Bool_t   fastjet_;
+  UInt_t   type_;
+  UInt_t   angle_;
+  UInt_t   recom_;
+  Double_t R_;
+
+  /// Number of particles and of remaining jets
+  UInt_t size_;
+  UInt_t njets_;
+
+  /// Jet kinematics (structure of arrays). 'rap' is the rapidity with 
+  /// FastJet and the KTCLUS pseudorapidity otherwise, (ux,uy,uz) is the 
+  /// direction used by the angular kt.
+  std::vector<Double_t> px_;
+  std::vector<Double_t> py_;
+  std::vector<Double_t> pz_;
+  std::vector<Double_t> e_;
+  std::vector<Double_t> pt_;
+  std::vector<Double_t> pt2_;
+  std::vector<Double_t> rap_;
+  std::vector<Double_t> phi_;
+  std::vector<Double_t> ux_;
+  std::vector<Double_t> uy_;
+  std::vector<Double_t> uz_;
+
+  /// sinh and cosh of rap/2, sin and cos of phi/2 (QCD emission metric)
+  std::vector<Double_t> shr_;
+  std::vector<Double_t> chr_;
+  std::vector<Double_t> sph_;
+  std::vector<Double_t> cph_;
+
+  /// Weight of the pair distances (pt^2 or E^2) and distance to the beam
+  std::vector<Double_t> kt2_;
+  std::vector<Double_t> beam_;
+
+  /// Nearest neighbour in angle and angular distance to it
+  std::vector<UInt_t>   nn_;
+  std::vector<Double_t> nndist_;
+
+  /// Jets whose nearest neighbour has to be searched again
+  std::vector<UChar_t>  stale_;
+
+  /// Angular distances to a given jet
+  std::vector<Double_t> angles_;
+
+  /// Merging scales
+  std::vector<Double_t> dmerge_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument (FastJet kt algorithm with R=1)
+  ExclusiveKt();
+
+  /// Destructor
+  ~ExclusiveKt()
+  { }
+
+  /// Setting the clustering mode (FASTJET or a KTCLUS IMODE)
+  bool SetMode(Int_t imode);
+
+  /// Setting the R parameter
+  bool SetR(Double_t R);
+
+  /// Accessors to the parameters
+  Int_t mode() const
+  { return imode_; }
+  Double_t R() const
+  { return R_; }
+
+  /// Removing the particles of the previous event
+  void Clear()
+  { size_=0; dmerge_.clear(); }
+
+  /// Adding a particle to cluster
+  void Add(Double_t px, Double_t py, Double_t pz, Double_t e);
+
+  /// Number of particles
+  UInt_t size() const
+  { return size_; }
+
+  /// Clustering the particles down to zero jet (one jet for e+e-)
+  void Cluster();
+
+  /// Distance at which the event goes from njets+1 to njets jets 
+  /// (0 if there are not enough particles)
+  Double_t dmerge(UInt_t njets) const
+  { return (njets<dmerge_.size()) ? dmerge_[njets] : 0.; }
+
+ private :
+
+  /// Computing the kinematic variables of a jet from its 4-momentum
+  void SetKinematics(UInt_t i);
+
+  /// Recombining the jet j into the jet i
+  void Recombine(UInt_t i, UInt_t j);
+
+  /// Distance to the beam, weight of the pair distances and half angles
+  void SetDistances(UInt_t i);
+
+  /// Filling angles_ with the angular distances between the jet i and the
+  /// jets first, first+1, ...
+  void ComputeAngles(UInt_t i, UInt_t first);
+
+  /// Searching the nearest neighbour of the jet i
+  void FindNeighbour(UInt_t i);
+
+  /// Removing the jet i, the last jet taking its place
+  void Remove(UInt_t i);
+
+};
+
+}
+
+#endif
@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/JetClustering/IsolationGrid.h"
+#include "SampleAnalyzer/Service/Physics.h"
+#include "SampleAnalyzer/Service/PDGService.h"
+
+using namespace MA5;
+
+
+/// Initializing the static member
+const Double_t IsolationGrid::EtaMax = 5.;
+
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+IsolationGrid::IsolationGrid()
+{
+  trackPtmin_ = 0.5;
+  etaWidth_=0.; phiWidth_=0.; neta_=0; nphi_=0;
+  std::vector<Double_t> radii;
+  radii.push_back(0.5);
+  radii.push_back(0.4);
+  radii.push_back(0.3);
+  radii.push_back(0.2);
+  SetRadii(radii);
+}
+
+
+// -----------------------------------------------------------------------------
+// SetRadii
+// -----------------------------------------------------------------------------
+bool IsolationGrid::SetRadii(const std::vector<Double_t>& radii)
+{
+  Double_t rmax = 0.;
+  for (unsigned int i=0;i<radii.size();i++)
+  {
+    if (radii[i]<=0.)
+    {
+      ERROR << "the radius of an isolation cone must be positive" << endmsg;
+      return false;
+    }
+    rmax = std::max(rmax,radii[i]);
+  }
+  radii_ = radii;
+  radii2_.resize(radii.size());
+  for (unsigned int i=0;i<radii.size();i++) radii2_[i]=radii[i]*radii[i];
+  if (radii.empty()) return true;
+
+  // Cells at least as large as the largest cone (and not too many of them)
+  const Double_t twopi = 2.*M_PI;
+  Double_t size = std::max(rmax,0.1);
+  neta_ = std::max(1,static_cast<Int_t>(2.*EtaMax/size));
+  nphi_ = std::max(1,static_cast<Int_t>(twopi/size));
+  etaWidth_ = 2.*EtaMax/neta_;
+  phiWidth_ = twopi/nphi_;
+  return true;
+}
+
+
+bool IsolationGrid::SetRadii(const std::string& radii)
+{
+  std::string list = radii;
+  std::replace(list.begin(),list.end(),',',' ');
+  std::stringstream str(list);
+  std::vector<Double_t> values;
+  std::string word;
+  while (str >> word)
+  {
+    if (word=="none") continue;
+    std::stringstream tmp(word);
+    Double_t value=0.;
+    if (!(tmp >> value))
+    {
+      ERROR << "the isolation cone radius '" << word << "' is not a number"
+            << endmsg;
+      return false;
+    }
+    values.push_back(value);
+  }
+  return SetRadii(values);
+}
+
+
+// -----------------------------------------------------------------------------
+// EtaCell / PhiCell
+// -----------------------------------------------------------------------------
+Int_t IsolationGrid::EtaCell(Double_t eta) const
+{
+  Double_t x = (eta+EtaMax)/etaWidth_;
+  if (x<0.) return 0;
+  if (x>=neta_) return neta_-1;
+  return static_cast<Int_t>(x);
+}
+
+Int_t IsolationGrid::PhiCell(Double_t phi) const
+{
+  Int_t cell = static_cast<Int_t>(std::floor((phi+M_PI)/phiWidth_));
+  cell %= nphi_;
+  if (cell<0) cell+=nphi_;
+  return cell;
+}
+
+
+// -----------------------------------------------------------------------------
+// Fill
+// -----------------------------------------------------------------------------
+void IsolationGrid::Fill(const MCEventFormat& event)
+{
+  entries_.clear();
+  if (radii_.empty()) return;
+
+  // Visible final-state particles
+  const std::vector<MCParticleFormat>& particles = event.particles();
+  unsorted_.clear();
+  cells_.clear();
+  offsets_.assign(neta_*nphi_+1,0);
+  for (unsigned int i=0;i<particles.size();i++)
+  {
+    const MCParticleFormat& part = particles[i];
+    if (!PHYSICS->Id->IsFinalState(part)) continue;
+    if (PHYSICS->Id->IsInvisible(part))   continue;
+    const MALorentzVector& p = part.momentum();
+    if (p.Pt()<1e-10) continue;
+
+    Entry entry;
+    entry.eta   = p.Eta();
+    entry.phi   = p.Phi();
+    entry.pt    = p.Pt();
+    entry.et    = p.Et();
+    entry.index = i;
+    entry.track = PDG->IsCharged(part.pdgid()) && entry.pt>trackPtmin_;
+    UInt_t cell = EtaCell(entry.eta)*nphi_+PhiCell(entry.phi);
+    unsorted_.push_back(entry);
+    cells_.push_back(cell);
+    offsets_[cell+1]++;
+  }
+
+  // Counting sort by cell
+  for (unsigned int i=1;i<offsets_.size();i++) offsets_[i]+=offsets_[i-1];
+  entries_.resize(unsorted_.size());
+  positions_.assign(offsets_.begin(),offsets_.end()-1);
+  for (unsigned int i=0;i<unsorted_.size();i++)
+    entries_[positions_[cells_[i]]++] = unsorted_[i];
+}
+
+
+// -----------------------------------------------------------------------------
+// Compute
+// -----------------------------------------------------------------------------
+void IsolationGrid::Compute(Double_t eta, Double_t phi, Int_t self,
+                            std::vector<Cone>& cones) const
+{
+  const UInt_t nradii = radii_.size();
+  cones.resize(nradii);
+  for (unsigned int k=0;k<nradii;k++)
+  { cones[k].sumPT=0.; cones[k].sumET=0.; cones[k].ntracks=0; }
+  if (nradii==0 || entries_.empty()) return;
+
+  // Cells to visit: the cell widths are larger than the largest radius, so
+  // that the neighbouring cells are enough
+  Double_t rmax = std::sqrt(*std::max_element(radii2_.begin(),radii2_.end()));
+  Int_t eta1 = EtaCell(eta-rmax);
+  Int_t eta2 = EtaCell(eta+rmax);
+  Int_t phic = PhiCell(phi);
+  Int_t dphi1 = -1, dphi2 = +1;
+  if (nphi_<3) { dphi1=-phic; dphi2=nphi_-1-phic; }
+
+  for (Int_t ieta=eta1;ieta<=eta2;ieta++)
+  {
+    for (Int_t d=dphi1;d<=dphi2;d++)
+    {
+      Int_t iphi = (phic+d+nphi_)%nphi_;
+      UInt_t cell = ieta*nphi_+iphi;
+      for (UInt_t i=offsets_[cell];i<offsets_[cell+1];i++)
+      {
+        const Entry& entry = entries_[i];
+        if (entry.index==self) continue;
+        Double_t deta = entry.eta-eta;
+        Double_t dphi = std::fabs(entry.phi-phi);
+        if (dphi>M_PI) dphi = 2.*M_PI-dphi;
+        Double_t dr2 = deta*deta+dphi*dphi;
+        for (unsigned int k=0;k<nradii;k++)
+        {
+          if (dr2>radii2_[k]) continue;
+          cones[k].sumET += entry.et;
+          if (!entry.track) continue;
+          cones[k].sumPT += entry.pt;
+          cones[k].ntracks++;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef ISOLATION_GRID_H
+#define ISOLATION_GRID_H
+
+// STL headers
+#include <vector>
+#include <string>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/DataFormat/MCEventFormat.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Isolation cones computed at the generator level. The visible final-state
+/// particles of the event are binned once into an (eta,phi) grid whose 
+/// cells are at least as large as the largest cone. The cones around a 
+/// direction are then obtained by visiting only the neighbouring cells, and
+/// all the radii are filled in the same sweep.
+///   - sumPT   : sum of the pt of the charged particles (tracks) above the
+///               track pt threshold
+///   - ntracks : number of these tracks
+///   - sumET   : sum of the transverse energy of all visible particles
+/// The particle defining the direction is not included in its cones.
+//////////////////////////////////////////////////////////////////////////////
+class IsolationGrid
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ public :
+
+  /// Content of the cones of a given radius
+  struct Cone
+  {
+    Double_t sumPT;
+    Double_t sumET;
+    UInt_t   ntracks;
+  };
+
+ private :
+
+  /// Particle stored in the grid
+  struct Entry
+  {
+    Double_t eta;
+    Double_t phi;
+    Double_t pt;
+    Double_t et;
+    Int_t    index;
+    Bool_t   track;
+  };
+
+  /// Cone radii and their squares
+  std::vector<Double_t> radii_;
+  std::vector<Double_t> radii2_;
+
+  /// Minimum pt of the tracks
+  Double_t trackPtmin_;
+
+  /// Binning: the particles beyond |eta|=EtaMax are put in the edge cells
+  static const Double_t EtaMax;
+  Double_t etaWidth_;
+  Double_t phiWidth_;
+  Int_t    neta_;
+  Int_t    nphi_;
+
+  /// Particles sorted by cell, the ones of the cell i being in 
+  /// [offsets_[i],offsets_[i+1][
+  std::vector<Entry>  entries_;
+  std::vector<UInt_t> offsets_;
+
+  /// Buffers reused from one event to the other
+  std::vector<Entry>  unsorted_;
+  std::vector<UInt_t> cells_;
+  std::vector<UInt_t> positions_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument (cones of 0.5, 0.4, 0.3 and 0.2 as in
+  /// the Delfes format, tracks above 0.5 GeV)
+  IsolationGrid();
+
+  /// Destructor
+  ~IsolationGrid()
+  { }
+
+  /// Setting the cone radii (an empty list disables the isolation)
+  bool SetRadii(const std::vector<Double_t>& radii);
+
+  /// Setting the radii from a list separated by commas or spaces 
+  /// ("none" disables the isolation)
+  bool SetRadii(const std::string& radii);
+
+  /// Setting the minimum pt of the tracks
+  void SetTrackPtmin(Double_t ptmin)
+  { trackPtmin_=ptmin; }
+
+  /// Accessors to the parameters
+  const std::vector<Double_t>& radii() const
+  { return radii_; }
+  Double_t trackPtmin() const
+  { return trackPtmin_; }
+
+  /// Is there any cone to compute ?
+  bool IsEnabled() const
+  { return !radii_.empty(); }
+
+  /// Binning the visible final-state particles of the event
+  void Fill(const MCEventFormat& event);
+
+  /// Content of the cones around the direction (eta,phi), the particle with
+  /// the index 'self' (-1 if none) being excluded. The cones are given in 
+  /// the order of the radii.
+  void Compute(Double_t eta, Double_t phi, Int_t self, 
+               std::vector<Cone>& cones) const;
+
+ private :
+
+  /// Cell indices of a direction
+  Int_t EtaCell(Double_t eta) const;
+  Int_t PhiCell(Double_t phi) const;
+
+};
+
+}
+
+#endif
@@ -105,6 +105,16 @@ namespace MA5
     /// Initialization
     virtual bool Initialize(const std::map<std::string,std::string>& options)=0;
 
+    /// Creating a new instance of the clusterer (multi-threaded mode)
+    /// A null pointer means that the clusterer cannot be replicated
+    virtual JetClustererBase* Clone() const
+    { return 0; }
+
+    /// Forbidding the clusterer to start its own threads (replicas of the
+    /// multi-threaded mode)
+    virtual void DisableThreads()
+    { }
+
     /// Finalization
     virtual void Finalize()
     { TaggerFinalize(); }
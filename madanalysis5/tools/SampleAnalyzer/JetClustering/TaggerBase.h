@@ -31,9 +31,7 @@
 #include "SampleAnalyzer/DataFormat/RecJetFormat.h"
 #include "SampleAnalyzer/Service/Physics.h"
 #include "SampleAnalyzer/Service/PDGService.h"
-
-// ROOT headers
-#include <TRandom.h>
+#include "SampleAnalyzer/JetClustering/DeltaRMatcher.h"
 
 // STL headers
 #include <algorithm>
@@ -63,6 +61,9 @@ class TaggerBase
     /// Applying efficiency
     Bool_t doEfficiency_;
 
+    /// DeltaR matching between the generated particles and the jets
+    DeltaRMatcher matcher_;
+
 //---------------------------------------------------------------------------------
 //                                method members
 //---------------------------------------------------------------------------------
@@ -104,14 +105,15 @@ class TaggerBase
     /// Set a parameter
     virtual void SetParameter(const std::string& key, const std::string& value, std::string header="");
 
-   /// Function for identification
-   Bool_t IsIdentified() const
+   /// Function for identification (drawing from the random stream of the
+   /// event)
+   Bool_t IsIdentified(EventFormat& myEvent) const
    {
      // no efficiency = default
      if (!doEfficiency_) return true;
 
      // applying efficiency
-     if (gRandom->Rndm() < Efficiency_) return true;
+     if (myEvent.random().Rndm() < Efficiency_) return true;
      else return false;
    }
 
@@ -39,7 +39,7 @@ void TauTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
           myEvent.rec()->jets()[i].true_btag_) continue;
 
       // simulating mis-id
-      if (gRandom->Rndm() < misid_ljet_)
+      if (myEvent.random().Rndm() < misid_ljet_)
       {
         RecTauFormat* myTau = myEvent.rec()->GetNewTau();
         Jet2Tau(&myEvent.rec()->jets()[i], myTau, myEvent);
@@ -58,6 +58,7 @@ void TauTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
 void TauTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
 {
   std::vector<RecJetFormat*> Candidates;
+  const MCDecayGraph& graph = myEvent.mc()->decays();
 
   for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
   {
@@ -86,9 +87,10 @@ void TauTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
           break;
         }
 
-	if (particle->mother2()!=0 && particle->mother2()!=particle->mother1()) break;
-
-        particle = particle->mother1();
+        // Going up to the mother if there is only one
+        MCIndexSpan mothers = graph.parents(particle->index());
+        if (graph.HasSeveralParents(particle->index())) break;
+        particle = mothers.empty() ? 0 : &myEvent.mc()->particles()[mothers[0]];
       }
 
       if (tag) break;
@@ -97,35 +99,8 @@ void TauTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
     if (tag) Candidates.push_back(& myEvent.rec()->jets()[i]);
   }
 
-  if (Exclusive_)
-  {
-    UInt_t i = 0;
-    UInt_t n = Candidates.size();
-
-    while (i<n)
-    {
-      UInt_t j = i+1;
-
-      Float_t DeltaR = Candidates[i]->mc()->dr(Candidates[i]);
-
-      while (j<n)
-      {
-        // If two candidates are matching with the same tau, erasing the one with the greater Delta R and reducing n (the size of the vector)
-       	if (Candidates[i]->mc()==Candidates[j]->mc())
-        {
-          Float_t DeltaR2 = Candidates[j]->mc()->dr(Candidates[j]);
-
-          if (DeltaR2<DeltaR) std::swap(Candidates[i], Candidates[j]);
-
-          Candidates.erase(Candidates.begin()+j);
-          n--;
-	}
-	else j++;
-      }
-
-      i++;
-    }
-  }
+  // Keeping only the closest jet to each tau
+  if (Exclusive_) DeltaRMatcher::KeepClosest(Candidates);
 
   sort(Candidates.begin(),Candidates.end());
 
@@ -150,6 +125,7 @@ void TauTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
 void TauTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
 {
   std::vector<RecJetFormat*> Candidates;
+  const MCDecayGraph& graph = myEvent.mc()->decays();
 
   // Jets preselection using method 2
   for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
@@ -178,9 +154,10 @@ void TauTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
           break;
         }
 
-	if (particle->mother2()!=0 && particle->mother2()!=particle->mother1()) break;
-
-        particle = particle->mother1();
+        // Going up to the mother if there is only one
+        MCIndexSpan mothers = graph.parents(particle->index());
+        if (graph.HasSeveralParents(particle->index())) break;
+        particle = mothers.empty() ? 0 : &myEvent.mc()->particles()[mothers[0]];
       }
 
       if (tag) break;
@@ -191,31 +168,35 @@ void TauTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
 
   std::vector<RecJetFormat*> Taus;
 
-  // tau-tagging using method 1
+  // tau-tagging using method 1: the candidates are scanned backwards and
+  // a matched jet is not matched to the next taus
+  matcher_.Clear();
+  for (unsigned int j=0;j<Candidates.size();j++) matcher_.AddColumn(*Candidates[j]);
   for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
   {
     if (fabs(myEvent.mc()->particles()[i].pdgid())!=15) continue;
-
     if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+    matcher_.AddRow(myEvent.mc()->particles()[i]);
+  }
+  matcher_.Compute();
 
-    Double_t DeltaRmax = DeltaRmax_; 
+  for (unsigned int i=0;i<matcher_.nrows();i++)
+  {
+    Double_t DeltaRmax = DeltaRmax_;
     Bool_t tag = false;
 
     for (unsigned int j=Candidates.size();j>0;j--)
     {
-      Float_t DeltaR = myEvent.mc()->particles()[i].dr(Candidates[j-1]);
-
-      if (DeltaR <= DeltaRmax)
+      Float_t DeltaR = matcher_.DeltaR(i,j-1);
+      if (DeltaR > DeltaRmax) continue;
+      if (Exclusive_)
       {
-        if (Exclusive_)
-        {
-          if (tag) Taus.pop_back();
-          tag = true;
-          DeltaRmax = DeltaR;
-        }
-     	Taus.push_back(Candidates[j-1]);
-	Candidates.erase(Candidates.begin()+j-1);
+        if (tag) Taus.pop_back();
+        tag = true;
+        DeltaRmax = DeltaR;
       }
+      Taus.push_back(Candidates[j-1]);
+      matcher_.DisableColumn(j-1);
     }
   }
 
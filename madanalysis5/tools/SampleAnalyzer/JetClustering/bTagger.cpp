@@ -27,72 +27,29 @@ using namespace MA5;
 
 void bTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
 {
-  std::vector<RecJetFormat*> Candidates;
-
-  // Matching b-quarks to jets
-  for (unsigned int i=0;i<myEvent.rec()->MCBquarks_.size();i++)
-  {
-    RecJetFormat* tag = 0;
-    Double_t DeltaRmax = DeltaRmax_;
-
-    // loop on the jets
-    for (unsigned int j=0;j<myEvent.rec()->jets().size();j++)
-    {
-      if (myEvent.rec()->jets()[j].pt()<1e-10) continue;
-      Float_t DeltaR = myEvent.rec()->MCBquarks_[i]->dr(myEvent.rec()->jets()[j]);
-
-      if (DeltaR <= DeltaRmax) 
-      {
-        if (Exclusive_)
-        {
-          tag = &(myEvent.rec()->jets()[j]);
-          DeltaRmax = DeltaR;
-        }
-        else Candidates.push_back(& myEvent.rec()->jets()[j]);
-      }
-    }
-    if (Exclusive_ && tag!=0) Candidates.push_back(tag);
-  }
-
-  // Tagging the b-jet 
-  for (unsigned int i=0;i<Candidates.size();i++)
-  {
-    Candidates[i]->true_btag_ = true;
-  }
-  Candidates.clear();
-
-  // Matching c-quarks to jets
-  for (unsigned int i=0;i<myEvent.rec()->MCCquarks_.size();i++)
+  std::vector<RecJetFormat>& jets = myEvent.rec()->jets();
+  const std::vector<const MCParticleFormat*>& bquarks = myEvent.rec()->MCBquarks_;
+  const std::vector<const MCParticleFormat*>& cquarks = myEvent.rec()->MCCquarks_;
+
+  // DeltaR between the b-quarks, then the c-quarks, and the jets
+  matcher_.Clear();
+  for (unsigned int j=0;j<jets.size();j++)
+    matcher_.AddColumn(jets[j], jets[j].pt()>=1e-10);
+  for (unsigned int i=0;i<bquarks.size();i++) matcher_.AddRow(*bquarks[i]);
+  for (unsigned int i=0;i<cquarks.size();i++) matcher_.AddRow(*cquarks[i]);
+  matcher_.Compute();
+
+  // Tagging the b-jets, then the c-jets
+  std::vector<UInt_t> matched;
+  for (unsigned int i=0;i<matcher_.nrows();i++)
   {
-    RecJetFormat* tag = 0;
-    Double_t DeltaRmax = DeltaRmax_;
-
-    // loop on the jets
-    for (unsigned int j=0;j<myEvent.rec()->jets().size();j++)
+    matcher_.Match(i,DeltaRmax_,Exclusive_,matched);
+    for (unsigned int j=0;j<matched.size();j++)
     {
-      if (myEvent.rec()->jets()[j].pt()<1e-10) continue;
-
-      Float_t DeltaR = 
-          myEvent.rec()->MCCquarks_[i]->dr(myEvent.rec()->jets()[j]);
-
-      if (DeltaR <= DeltaRmax) 
-      {
-        if (Exclusive_)
-        {
-          tag = &(myEvent.rec()->jets()[j]);
-          DeltaRmax = DeltaR;
-        }
-        else Candidates.push_back(& myEvent.rec()->jets()[j]);
-      }
+      RecJetFormat& jet = jets[matched[j]];
+      if (i<bquarks.size()) jet.true_btag_ = true;
+      else if (!jet.true_btag_) jet.true_ctag_ = true;
     }
-    if (Exclusive_ && tag!=0) Candidates.push_back(tag);
-  }
-
-  // Tagging the c-jet 
-  for (unsigned int i=0;i<Candidates.size();i++)
-  {
-    if (Candidates[i]->true_btag_) continue;
-    Candidates[i]->true_ctag_ = true;
   }
 
   // Identification and misidentification
@@ -107,19 +64,19 @@ void bTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
     // identification efficiency
     if (doEfficiency_ && jet->true_btag_)
     {
-      if (gRandom->Rndm()  >= Efficiency_) jet->btag_=false;
+      if (myEvent.random().Rndm() >= Efficiency_) jet->btag_=false;
     }
 
     // mis-identification (c-quark)
     if (doMisefficiency_ && !jet->true_btag_ && jet->true_ctag_)
     {
-      if (gRandom->Rndm() < misid_cjet_) jet->btag_=true;
+      if (myEvent.random().Rndm() < misid_cjet_) jet->btag_=true;
     }
 
     // mis-identification (light quarks)
     else if (doMisefficiency_ && !jet->true_btag_ && !jet->true_ctag_)
     {
-      if (gRandom->Rndm() < misid_ljet_) jet->btag_=true;
+      if (myEvent.random().Rndm() < misid_ljet_) jet->btag_=true;
     }
   }
 
@@ -128,6 +85,7 @@ void bTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
 void bTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
 { 
   std::vector<RecJetFormat*> Candidates;
+  const MCDecayGraph& graph = myEvent.mc()->decays();
 
   for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
   {
@@ -154,9 +112,10 @@ void bTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
           break;
         }
 
-	if (particle->mother2()!=0 && particle->mother2()!=particle->mother1()) break;
-
-        particle = particle->mother1();
+        // Going up to the mother if there is only one
+        MCIndexSpan mothers = graph.parents(particle->index());
+        if (graph.HasSeveralParents(particle->index())) break;
+        particle = mothers.empty() ? 0 : &myEvent.mc()->particles()[mothers[0]];
       }
 
       if (b) break;
@@ -165,34 +124,8 @@ void bTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
     if (b) Candidates.push_back(& myEvent.rec()->jets()[i]);
   }
 
-  if (Exclusive_)
-  {
-    UInt_t i = 0;
-    UInt_t n = Candidates.size();
-
-    while (i<n)
-    {
-      UInt_t j = i+1;
-
-      Float_t DeltaR = Candidates[i]->mc()->dr(Candidates[i]);
-
-      while (j<n)
-      {
-        if (Candidates[i]->mc()==Candidates[j]->mc())
-        {
-          Float_t DeltaR2 = Candidates[j]->mc()->dr(Candidates[j]);
-
-          if (DeltaR2<DeltaR) std::swap(Candidates[i], Candidates[j]);
-
-          Candidates.erase(Candidates.begin()+j);
-          n--;
-        }
-        else j++;
-      }
-
-      i++;
-    }
-  }
+  // Keeping only the closest jet to each B hadron
+  if (Exclusive_) DeltaRMatcher::KeepClosest(Candidates);
 
   for (unsigned int i=0;i<Candidates.size();i++)
   {
@@ -203,6 +136,7 @@ void bTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
 void bTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
 {
   std::vector<RecJetFormat*> Candidates;
+  const MCDecayGraph& graph = myEvent.mc()->decays();
 
   // jet preselection using method 2
   for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
@@ -230,9 +164,10 @@ void bTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
           break;
         }
 
-	if (particle->mother2()!=0 && particle->mother2()!=particle->mother1()) break;
-
-        particle = particle->mother1();
+        // Going up to the mother if there is only one
+        MCIndexSpan mothers = graph.parents(particle->index());
+        if (graph.HasSeveralParents(particle->index())) break;
+        particle = mothers.empty() ? 0 : &myEvent.mc()->particles()[mothers[0]];
       }
 
       if (b) break;
@@ -241,41 +176,25 @@ void bTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
     if (b) Candidates.push_back(& myEvent.rec()->jets()[i]);
   }
 
-  // b-tagging using method 1
+  // b-tagging using method 1: the jets matched to a b-quark are removed 
+  // from the candidates (the most energetic one is tagged in exclusive mode)
+  matcher_.Clear();
+  for (unsigned int j=0;j<Candidates.size();j++) matcher_.AddColumn(*Candidates[j]);
   for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
   {
     if (fabs(myEvent.mc()->particles()[i].pdgid())!=5) continue;
-
     if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+    matcher_.AddRow(myEvent.mc()->particles()[i]);
+  }
+  matcher_.Compute();
 
-    UInt_t k = 0;
-
-    for (unsigned int j=Candidates.size();j>0;j--)
-    {
-      Float_t DeltaR = myEvent.mc()->particles()[i].dr(Candidates[j-1]);
-
-      if (DeltaR <= DeltaRmax_)
-      {
-        k++;
-        std::swap (Candidates[j-1], Candidates[Candidates.size()-k]);
-      }
-    }
-
-    if (Exclusive_)
-    {
-      while (k>1)
-      {
-        if (Candidates[Candidates.size()-1]->e() > Candidates[Candidates.size()-2]->e()) std::swap(Candidates[Candidates.size()-1], Candidates[Candidates.size()-2]);
-        Candidates.pop_back();
-        k--;
-      }
-    }
-
-    for (unsigned int j=0;j<k;j++)
-    {
-      Candidates[Candidates.size()-1]->btag_=true;
-      Candidates.pop_back();
-    }
+  std::vector<UInt_t> remaining(Candidates.size());
+  for (unsigned int j=0;j<remaining.size();j++) remaining[j]=j;
+  std::vector<UInt_t> matched;
+  for (unsigned int i=0;i<matcher_.nrows();i++)
+  {
+    matcher_.MatchAndRemove(i,DeltaRmax_,Exclusive_,Candidates,remaining,matched);
+    for (unsigned int j=0;j<matched.size();j++) Candidates[matched[j]]->btag_=true;
   }
 
   Candidates.clear();
@@ -283,12 +202,13 @@ void bTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
 
 Bool_t bTagger::IsLastBHadron(MCParticleFormat* part, EventFormat& myEvent)
 {
-  for (unsigned int i=0; i<myEvent.mc()->particles().size(); i++)
+  // Daughters having the particle as first mother
+  const MCDecayGraph& graph = myEvent.mc()->decays();
+  MCIndexSpan daughters = graph.children(part->index());
+  for (unsigned int i=0; i<daughters.size(); i++)
   {
-    if (myEvent.mc()->particles()[i].mother1()== part)
-    {
-      if (PHYSICS->Id->IsBHadron(myEvent.mc()->particles()[i].pdgid())) return false;
-    }
+    if (graph.mother1(daughters[i])!=static_cast<Int_t>(part->index())) continue;
+    if (PHYSICS->Id->IsBHadron(myEvent.mc()->particles()[daughters[i]].pdgid())) return false;
   }
   return true;
 }
@@ -28,46 +28,28 @@ using namespace MA5;
 // Matching using dr
 void cTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
 {
-  std::vector<RecJetFormat*> Candidates;
+  std::vector<RecJetFormat>& jets = myEvent.rec()->jets();
 
-  // loop on the particles searching for last c
+  // DeltaR between the last c-quarks and the jets which are not b-tagged
+  matcher_.Clear();
+  for (unsigned int j=0;j<jets.size();j++)
+    matcher_.AddColumn(jets[j], !jets[j].btag());
   for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
   {
     if (PHYSICS->Id->IsInitialState(myEvent.mc()->particles()[i])) continue;
     if (fabs(myEvent.mc()->particles()[i].pdgid())!=4) continue;
     if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+    matcher_.AddRow(myEvent.mc()->particles()[i]);
+  }
+  matcher_.Compute();
 
-    Bool_t tag = false;
-    Double_t DeltaRmax = DeltaRmax_;
-
-    // loop on the jets
-    for (unsigned int j=0;j<myEvent.rec()->jets().size();j++)
-    {
-      if (myEvent.rec()->jets()[j].btag()) continue;
-
-      // Calculating DeltaR
-      Float_t DeltaR = myEvent.mc()->particles()[i].dr(myEvent.rec()->jets()[j]);
-
-      // Adding the jet to the candidates if DeltaR <= DeltaRmax
-      if (DeltaR <= DeltaRmax) 
-      {
-        if (Exclusive_)
-        {
-          if (tag) Candidates.pop_back();
-          tag = true;
-          DeltaRmax = DeltaR;
-        }
-        Candidates.push_back(& myEvent.rec()->jets()[j]);
-      }
-    }
-
-    // Tagging the candidates
-    for (unsigned int i=0;i<Candidates.size();i++)
-    {
-      Candidates[i]->true_ctag_ = true;
-    }
-    
-    Candidates.clear();
+  // Tagging the matched jets
+  std::vector<UInt_t> matched;
+  for (unsigned int i=0;i<matcher_.nrows();i++)
+  {
+    matcher_.Match(i,DeltaRmax_,Exclusive_,matched);
+    for (unsigned int j=0;j<matched.size();j++)
+      jets[matched[j]].true_ctag_ = true;
   }
 }
 
@@ -75,6 +57,7 @@ void cTagger::Method1 (SampleFormat& mySample, EventFormat& myEvent)
 void cTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
 { 
   std::vector<RecJetFormat*> Candidates;
+  const MCDecayGraph& graph = myEvent.mc()->decays();
 
   for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
   {
@@ -103,9 +86,10 @@ void cTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
           break;
         }
 
-        if (particle->mother2()!=0 && particle->mother2()!=particle->mother1()) break;
-
-        particle = particle->mother1();
+        // Going up to the mother if there is only one
+        MCIndexSpan mothers = graph.parents(particle->index());
+        if (graph.HasSeveralParents(particle->index())) break;
+        particle = mothers.empty() ? 0 : &myEvent.mc()->particles()[mothers[0]];
       }
 
       if (c) break;
@@ -114,34 +98,8 @@ void cTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
     if (c) Candidates.push_back(& myEvent.rec()->jets()[i]);
   }
 
-  if (Exclusive_)
-  {
-    UInt_t i = 0;
-    UInt_t n = Candidates.size();
-
-    while (i<n)
-    {
-      UInt_t j = i+1;
-
-      Float_t DeltaR = Candidates[i]->mc()->dr(Candidates[i]);
-
-      while (j<n)
-      {
-        if (Candidates[i]->mc()==Candidates[j]->mc())
-        {
-          Float_t DeltaR2 = Candidates[j]->mc()->dr(Candidates[j]);
-
-          if (DeltaR2<DeltaR) std::swap(Candidates[i], Candidates[j]);
-
-          Candidates.erase(Candidates.begin()+j);
-          n--;
-        }
-        else j++;
-      }
-
-      i++;
-    }
-  }
+  // Keeping only the closest jet to each C hadron
+  if (Exclusive_) DeltaRMatcher::KeepClosest(Candidates);
 
   for (unsigned int i=0;i<Candidates.size();i++)
   {
@@ -154,6 +112,7 @@ void cTagger::Method2 (SampleFormat& mySample, EventFormat& myEvent)
 void cTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
 {
   std::vector<RecJetFormat*> Candidates;
+  const MCDecayGraph& graph = myEvent.mc()->decays();
 
   // jet preselection using method 2
   for (unsigned int i=0;i<myEvent.rec()->jets().size();i++)
@@ -183,9 +142,10 @@ void cTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
           break;
         }
 
-        if (particle->mother2()!=0 && particle->mother2()!=particle->mother1()) break;
-
-        particle = particle->mother1();
+        // Going up to the mother if there is only one
+        MCIndexSpan mothers = graph.parents(particle->index());
+        if (graph.HasSeveralParents(particle->index())) break;
+        particle = mothers.empty() ? 0 : &myEvent.mc()->particles()[mothers[0]];
       }
 
       if (c) break;
@@ -194,41 +154,25 @@ void cTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
     if (c) Candidates.push_back(& myEvent.rec()->jets()[i]);
   }
 
-  // c-tagging using method 1
+  // c-tagging using method 1: the jets matched to a c-quark are removed 
+  // from the candidates (the most energetic one is tagged in exclusive mode)
+  matcher_.Clear();
+  for (unsigned int j=0;j<Candidates.size();j++) matcher_.AddColumn(*Candidates[j]);
   for (unsigned int i=0;i<myEvent.mc()->particles().size();i++)
   {
     if (fabs(myEvent.mc()->particles()[i].pdgid())!=4) continue;
-
     if (!IsLast(&myEvent.mc()->particles()[i], myEvent)) continue;
+    matcher_.AddRow(myEvent.mc()->particles()[i]);
+  }
+  matcher_.Compute();
 
-    UInt_t k = 0;
-
-    for (unsigned int j=Candidates.size();j>0;j--)
-    {
-      Float_t DeltaR = myEvent.mc()->particles()[i].dr(Candidates[j-1]);
-
-      if (DeltaR <= DeltaRmax_)
-      {
-        k++;
-        std::swap (Candidates[j-1], Candidates[Candidates.size()-k]);
-      }
-    }
-
-    if (Exclusive_)
-    {
-      while (k>1)
-      {
-        if (Candidates[Candidates.size()-1]->e() > Candidates[Candidates.size()-2]->e()) std::swap(Candidates[Candidates.size()-1], Candidates[Candidates.size()-2]);
-        Candidates.pop_back();
-        k--;
-      }
-    }
-
-    for (unsigned int j=0;j<k;j++)
-    {
-      Candidates[Candidates.size()-1]->true_ctag_=true;
-      Candidates.pop_back();
-    }
+  std::vector<UInt_t> remaining(Candidates.size());
+  for (unsigned int j=0;j<remaining.size();j++) remaining[j]=j;
+  std::vector<UInt_t> matched;
+  for (unsigned int i=0;i<matcher_.nrows();i++)
+  {
+    matcher_.MatchAndRemove(i,DeltaRmax_,Exclusive_,Candidates,remaining,matched);
+    for (unsigned int j=0;j<matched.size();j++) Candidates[matched[j]]->true_ctag_=true;
   }
 
   Candidates.clear();
@@ -236,12 +180,13 @@ void cTagger::Method3 (SampleFormat& mySample, EventFormat& myEvent)
 
 Bool_t cTagger::IsLastCHadron(MCParticleFormat* part, EventFormat& myEvent)
 {
-  for (unsigned int i=0; i<myEvent.mc()->particles().size(); i++)
+  // Daughters having the particle as first mother
+  const MCDecayGraph& graph = myEvent.mc()->decays();
+  MCIndexSpan daughters = graph.children(part->index());
+  for (unsigned int i=0; i<daughters.size(); i++)
   {
-    if (myEvent.mc()->particles()[i].mother1()== part)
-    {
-      if (PHYSICS->Id->IsCHadron(myEvent.mc()->particles()[i].pdgid())) return false;
-    }
+    if (graph.mother1(daughters[i])!=static_cast<Int_t>(part->index())) continue;
+    if (PHYSICS->Id->IsCHadron(myEvent.mc()->particles()[daughters[i]].pdgid())) return false;
   }
   return true;
 }
@@ -28,6 +28,88 @@
 using namespace MA5;
 
 
+/// Adding the content of another histogram with the same binning
+bool Histo::Merge(const PlotBase& other)
+{
+  // Safety: same type and same binning
+  const Histo* histo = dynamic_cast<const Histo*>(&other);
+  if (histo==0 || histo->nbins_!=nbins_ || 
+      histo->xmin_!=xmin_ || histo->xmax_!=xmax_)
+  {
+    ERROR << "histograms '" << name_ << "' with different binnings "
+          << "cannot be merged" << endmsg;
+    return false;
+  }
+
+  // Statistical counters
+  PlotBase::Merge(other);
+  sum_w_.first    += histo->sum_w_.first;
+  sum_w_.second   += histo->sum_w_.second;
+  sum_ww_.first   += histo->sum_ww_.first;
+  sum_ww_.second  += histo->sum_ww_.second;
+  sum_xw_.first   += histo->sum_xw_.first;
+  sum_xw_.second  += histo->sum_xw_.second;
+  sum_xxw_.first  += histo->sum_xxw_.first;
+  sum_xxw_.second += histo->sum_xxw_.second;
+
+  // Bin contents
+  underflow_.first  += histo->underflow_.first;
+  underflow_.second += histo->underflow_.second;
+  overflow_.first   += histo->overflow_.first;
+  overflow_.second  += histo->overflow_.second;
+  for (unsigned int i=0;i<histo_.size();i++)
+  {
+    histo_[i].first  += histo->histo_[i].first;
+    histo_[i].second += histo->histo_[i].second;
+  }
+  return true;
+}
+
+
+/// Dumping the content of the histogram in a binary stream
+void Histo::Write_BinaryFormat(std::ostream& output) const
+{
+  PlotBase::Write_BinaryFormat(output);
+  BinaryStream::Write(output, nbins_);
+  BinaryStream::Write(output, sum_w_);
+  BinaryStream::Write(output, sum_ww_);
+  BinaryStream::Write(output, sum_xw_);
+  BinaryStream::Write(output, sum_xxw_);
+  BinaryStream::Write(output, underflow_);
+  BinaryStream::Write(output, overflow_);
+  for (unsigned int i=0;i<histo_.size();i++)
+    BinaryStream::Write(output, histo_[i]);
+}
+
+
+/// Restoring the content of the histogram from a binary stream
+bool Histo::Read_BinaryFormat(std::istream& input)
+{
+  if (!PlotBase::Read_BinaryFormat(input)) return false;
+
+  // Safety: same binning
+  UInt_t nbins = 0;
+  if (!BinaryStream::Read(input, nbins)) return false;
+  if (nbins!=histo_.size())
+  {
+    ERROR << "the stored histogram '" << name_ << "' does not have "
+          << "the expected binning" << endmsg;
+    return false;
+  }
+
+  // Reading
+  if (!BinaryStream::Read(input, sum_w_)     ||
+      !BinaryStream::Read(input, sum_ww_)    ||
+      !BinaryStream::Read(input, sum_xw_)    ||
+      !BinaryStream::Read(input, sum_xxw_)   ||
+      !BinaryStream::Read(input, underflow_) ||
+      !BinaryStream::Read(input, overflow_)) return false;
+  for (unsigned int i=0;i<histo_.size();i++)
+    if (!BinaryStream::Read(input, histo_[i])) return false;
+  return true;
+}
+
+
 /// Write the plot in a Text file
 void Histo::Write_TextFormat(std::ostream* output)
 {
@@ -196,6 +196,15 @@ class Histo : public PlotBase
     }
   }
 
+  /// Adding the content of another histogram with the same binning
+  virtual bool Merge(const PlotBase& other);
+
+  /// Dumping the content of the histogram in a binary stream
+  virtual void Write_BinaryFormat(std::ostream& output) const;
+
+  /// Restoring the content of the histogram from a binary stream
+  virtual bool Read_BinaryFormat(std::istream& input);
+
   /// Write the plot in a ROOT file
   virtual void Write_TextFormat(std::ostream* output);
 
@@ -105,6 +105,66 @@ class HistoFrequency : public PlotBase
     }
   }
 
+  /// Adding the content of another frequency histogram
+  virtual bool Merge(const PlotBase& other)
+  {
+    const HistoFrequency<T>* histo = 
+      dynamic_cast<const HistoFrequency<T>*>(&other);
+    if (histo==0)
+    {
+      ERROR << "histograms '" << name_ << "' of different types "
+            << "cannot be merged" << endmsg;
+      return false;
+    }
+    PlotBase::Merge(other);
+    sum_w_.first  += histo->sum_w_.first;
+    sum_w_.second += histo->sum_w_.second;
+    for (const_iterator it=histo->stack_.begin();it!=histo->stack_.end();it++)
+    {
+      iterator found = stack_.find(it->first);
+      if (found==stack_.end()) stack_[it->first]=it->second;
+      else
+      {
+        found->second.first  += it->second.first;
+        found->second.second += it->second.second;
+      }
+    }
+    return true;
+  }
+
+  /// Dumping the content of the histogram in a binary stream
+  virtual void Write_BinaryFormat(std::ostream& output) const
+  {
+    PlotBase::Write_BinaryFormat(output);
+    BinaryStream::Write(output, sum_w_);
+    UInt_t size = stack_.size();
+    BinaryStream::Write(output, size);
+    for (const_iterator it=stack_.begin();it!=stack_.end();it++)
+    {
+      BinaryStream::Write(output, it->first);
+      BinaryStream::Write(output, it->second);
+    }
+  }
+
+  /// Restoring the content of the histogram from a binary stream
+  virtual bool Read_BinaryFormat(std::istream& input)
+  {
+    if (!PlotBase::Read_BinaryFormat(input)) return false;
+    if (!BinaryStream::Read(input, sum_w_)) return false;
+    UInt_t size = 0;
+    if (!BinaryStream::Read(input, size)) return false;
+    stack_.clear();
+    for (unsigned int i=0;i<size;i++)
+    {
+      T obs;
+      std::pair<Double_t,Double_t> value;
+      if (!BinaryStream::Read(input, obs) ||
+          !BinaryStream::Read(input, value)) return false;
+      stack_[obs]=value;
+    }
+    return true;
+  }
+
   /// Write the plot in a ROOT file
   virtual void Write_TextFormat(std::ostream* output)
   {
@@ -36,6 +36,7 @@
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/Service/LogService.h"
+#include "SampleAnalyzer/Core/BinaryStream.h"
 
 namespace MA5
 {
@@ -110,6 +111,34 @@ class PlotBase
     }
   }
 
+  /// Adding the statistics of another plot (merging partial results)
+  virtual bool Merge(const PlotBase& other)
+  {
+    nevents_.first    += other.nevents_.first;
+    nevents_.second   += other.nevents_.second;
+    nentries_.first   += other.nentries_.first;
+    nentries_.second  += other.nentries_.second;
+    nevents_w_.first  += other.nevents_w_.first;
+    nevents_w_.second += other.nevents_w_.second;
+    return true;
+  }
+
+  /// Dumping the statistics of the plot in a binary stream
+  virtual void Write_BinaryFormat(std::ostream& output) const
+  {
+    BinaryStream::Write(output, nevents_);
+    BinaryStream::Write(output, nentries_);
+    BinaryStream::Write(output, nevents_w_);
+  }
+
+  /// Restoring the statistics of the plot from a binary stream
+  virtual bool Read_BinaryFormat(std::istream& input)
+  {
+    return BinaryStream::Read(input, nevents_)  &&
+           BinaryStream::Read(input, nentries_) &&
+           BinaryStream::Read(input, nevents_w_);
+  }
+
   /// Return Number of events
   const std::pair<Long64_t,Long64_t>& GetNEvents()
   { return nevents_; }
@@ -36,6 +36,55 @@
 
 using namespace MA5;
 
+/// Adding the plots of another manager (merging partial results)
+bool PlotManager::Merge(const PlotManager& other)
+{
+  // Safety: the two managers must contain the same plots
+  if (plots_.size()!=other.plots_.size())
+  {
+    ERROR << "plot collections with different numbers of plots "
+          << "cannot be merged" << endmsg;
+    return false;
+  }
+
+  // Merging plot by plot
+  bool ok=true;
+  for (unsigned int i=0;i<plots_.size();i++)
+    if (!plots_[i]->Merge(*other.plots_[i])) ok=false;
+  return ok;
+}
+
+
+/// Dumping the plots in a binary stream
+void PlotManager::Write_BinaryFormat(std::ostream& output) const
+{
+  UInt_t nplots = plots_.size();
+  BinaryStream::Write(output, nplots);
+  for (unsigned int i=0;i<plots_.size();i++)
+    plots_[i]->Write_BinaryFormat(output);
+}
+
+
+/// Restoring the plots from a binary stream
+bool PlotManager::Read_BinaryFormat(std::istream& input)
+{
+  // Safety: the stream must contain the same plots
+  UInt_t nplots = 0;
+  if (!BinaryStream::Read(input, nplots)) return false;
+  if (nplots!=plots_.size())
+  {
+    ERROR << "the stored plot collection does not have the expected "
+          << "number of plots" << endmsg;
+    return false;
+  }
+
+  // Reading plot by plot
+  for (unsigned int i=0;i<plots_.size();i++)
+    if (!plots_[i]->Read_BinaryFormat(input)) return false;
+  return true;
+}
+
+
 /// Write the counters in a Text file
 void PlotManager::Write_TextFormat(SAFWriter& output)
 {
@@ -121,6 +121,15 @@ class PlotManager
     return myhisto;
   }
 
+  /// Adding the plots of another manager (merging partial results)
+  bool Merge(const PlotManager& other);
+
+  /// Dumping the plots in a binary stream
+  void Write_BinaryFormat(std::ostream& output) const;
+
+  /// Restoring the plots from a binary stream
+  bool Read_BinaryFormat(std::istream& input);
+
   /// Write the counters in a Text file
   void Write_TextFormat(SAFWriter& output);
 
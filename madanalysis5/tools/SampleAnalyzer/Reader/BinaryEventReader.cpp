@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/BinaryEventReader.h"
+#include "SampleAnalyzer/DataFormat/BinaryEventFormat.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+// -----------------------------------------------------------------------------
+// Initialize
+// -----------------------------------------------------------------------------
+bool BinaryEventReader::Initialize(const std::string& rawfilename,
+                                   const Configuration& cfg)
+{
+  // Set configuration
+  cfg_=cfg;
+
+  // No RFIO for this format; compressed blocks are inflated by the reader
+  rfio_ = IsRfioMode(rawfilename);
+  if (rfio_)
+  {
+    ERROR << "'-rfio' is not allowed for the MA5 binary event format" << endmsg;
+    return false;
+  }
+  filename_ = CleanFilename(rawfilename);
+
+  // Opening the file
+  input_ = new std::ifstream(filename_.c_str(), 
+                             std::ios::in | std::ios::binary);
+  if (!input_->good())
+  {
+    ERROR << "Opening file " << filename_ << " failed" << endmsg;
+    delete input_; input_=0;
+    return false;
+  }
+
+  cursor_=0; end_=0; remaining_=0; EndOfFile_=false;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadHeader
+// -----------------------------------------------------------------------------
+bool BinaryEventReader::ReadHeader(SampleFormat& mySample)
+{
+  if (input_==0) return false;
+  return BinaryEventFormat::ReadSample(*input_, mySample);
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadEvent
+// -----------------------------------------------------------------------------
+StatusCode::Type BinaryEventReader::ReadEvent(EventFormat& myEvent, 
+                                              SampleFormat& mySample)
+{
+  if (input_==0 || EndOfFile_) return StatusCode::FAILURE;
+
+  // Loading the next block
+  if (remaining_==0)
+  {
+    if (!BinaryEventFormat::ReadBlock(*input_, remaining_, raw_, stored_))
+    {
+      ERROR << "the end of the file " << filename_
+            << " has been reached before the end tag" << endmsg;
+      EndOfFile_=true;
+      return StatusCode::FAILURE;
+    }
+    if (remaining_==0) { EndOfFile_=true; return StatusCode::FAILURE; }
+    cursor_ = raw_.empty() ? 0 : &raw_[0];
+    end_    = cursor_ + raw_.size();
+  }
+
+  // Decoding the event
+  remaining_--;
+  if (!BinaryEventFormat::ReadEvent(cursor_, end_, myEvent))
+  {
+    ERROR << "an event of the file " << filename_ 
+          << " is corrupted" << endmsg;
+    EndOfFile_=true;
+    return StatusCode::FAILURE;
+  }
+  return StatusCode::KEEP;
+}
+
+
+// -----------------------------------------------------------------------------
+// Finalize
+// -----------------------------------------------------------------------------
+bool BinaryEventReader::Finalize()
+{
+  if (input_!=0)
+  {
+    input_->close();
+    delete input_;
+    input_=0;
+  }
+  std::vector<char>().swap(raw_);
+  std::vector<char>().swap(stored_);
+  cursor_=0; end_=0; remaining_=0;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// GetFileSize
+// -----------------------------------------------------------------------------
+Long64_t BinaryEventReader::GetFileSize()
+{
+  if (input_==0) return 0;
+  std::streampos current = input_->tellg();
+  input_->seekg(0,std::ios::end);
+  Long64_t length = input_->tellg();
+  input_->seekg(current,std::ios::beg);
+  return length;
+}
+
+
+// -----------------------------------------------------------------------------
+// GetPosition
+// -----------------------------------------------------------------------------
+Long64_t BinaryEventReader::GetPosition()
+{
+  if (input_==0) return 0;
+  return input_->tellg();
+}
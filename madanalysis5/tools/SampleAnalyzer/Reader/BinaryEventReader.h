@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BINARY_EVENT_READER_h
+#define BINARY_EVENT_READER_h
+
+// STL headers
+#include <fstream>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Reader of the native MA5 binary event format (extensions '.ma5bin' and
+/// '.ma5bin.gz', the latter with zlib-compressed blocks).
+/// The events are decoded from blocks loaded at once: no text parsing and
+/// no reconstruction of the mother-daughter links are needed.
+//////////////////////////////////////////////////////////////////////////////
+class BinaryEventReader : public ReaderBase
+{
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ protected:
+
+  /// Name of the file
+  std::string filename_;
+
+  /// Input file
+  std::ifstream* input_;
+
+  /// Decoded and stored (possibly compressed) content of the current block
+  std::vector<char> raw_;
+  std::vector<char> stored_;
+
+  /// Cursor in the current block
+  const char* cursor_;
+  const char* end_;
+
+  /// Number of events left in the current block
+  UInt_t remaining_;
+
+  /// End tag found
+  bool EndOfFile_;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public:
+
+  /// Constructor without argument
+  BinaryEventReader()
+  { input_=0; cursor_=0; end_=0; remaining_=0; EndOfFile_=false; }
+
+	/// Destructor
+  virtual ~BinaryEventReader()
+  { if (input_!=0) delete input_; }
+
+  /// Initialize
+  virtual bool Initialize(const std::string& rawfilename,
+                          const Configuration& cfg);
+
+  /// Read the header
+  virtual bool ReadHeader(SampleFormat& mySample);
+
+  /// Finalize the header
+  virtual bool FinalizeHeader(SampleFormat& mySample)
+  { return true; }
+
+  /// Read the event
+  virtual StatusCode::Type ReadEvent(EventFormat& myEvent, 
+                                     SampleFormat& mySample);
+
+  /// Finalize the event (everything is already stored in the file)
+  virtual bool FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
+  { FinalizeParticles(myEvent); return true; }
+
+  /// Finalize
+  virtual bool Finalize();
+
+  /// Get the file size
+  virtual Long64_t GetFileSize();
+
+  /// Get the position in file
+  virtual Long64_t GetPosition();
+
+  /// Get the final position in file
+  virtual Long64_t GetFinalPosition()
+  { return GetFileSize(); }
+
+};
+
+}
+
+#endif
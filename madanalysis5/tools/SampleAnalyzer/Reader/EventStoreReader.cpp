@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// STL headers
+#include <cstring>
+#include <sstream>
+
+// POSIX headers
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/EventStoreReader.h"
+#include "SampleAnalyzer/DataFormat/BinaryEventFormat.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+// -----------------------------------------------------------------------------
+// Initialize
+// -----------------------------------------------------------------------------
+bool EventStoreReader::Initialize(const std::string& rawfilename,
+                                  const Configuration& cfg)
+{
+  // Set configuration
+  cfg_=cfg;
+
+  // The file must be mappable: no RFIO
+  rfio_ = IsRfioMode(rawfilename);
+  if (rfio_)
+  {
+    ERROR << "'-rfio' is not allowed for the MA5 event store" << endmsg;
+    return false;
+  }
+  filename_ = CleanFilename(rawfilename);
+  if (data_!=0) Finalize();
+
+  // Mapping the file
+  int fd = open(filename_.c_str(), O_RDONLY);
+  if (fd==-1)
+  {
+    ERROR << "Opening file " << filename_ << " failed" << endmsg;
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd,&info)!=0) info.st_size=0;
+  size_ = static_cast<ULong64_t>(info.st_size);
+  const ULong64_t footer = 2*sizeof(ULong64_t)+
+                           sizeof(BinaryEventFormat::IndexMagic);
+  void* map = MAP_FAILED;
+  if (size_>=footer) map = mmap(0, size_, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map==MAP_FAILED)
+  {
+    ERROR << "the file " << filename_ << " cannot be mapped in memory" 
+          << endmsg;
+    size_=0;
+    return false;
+  }
+  data_ = static_cast<const char*>(map);
+
+  // Footer: offset of the index, number of events and tag. The index must
+  // end at the footer (nevents is bounded first: the products cannot 
+  // overflow) and be aligned, as written by EventStoreWriter, since the 
+  // offsets are read in place (the mapping is aligned on a page).
+  const char* end = data_+size_-footer;
+  std::memcpy(&index_,   end,                   sizeof(ULong64_t));
+  std::memcpy(&nevents_, end+sizeof(ULong64_t), sizeof(ULong64_t));
+  if (std::memcmp(end+2*sizeof(ULong64_t), BinaryEventFormat::IndexMagic,
+                  sizeof(BinaryEventFormat::IndexMagic))!=0 ||
+      nevents_>(size_-footer)/sizeof(ULong64_t) ||
+      index_!=size_-footer-nevents_*sizeof(ULong64_t) ||
+      index_%sizeof(ULong64_t)!=0)
+  {
+    ERROR << "the file " << filename_ << " is not a complete MA5 event store"
+          << endmsg;
+    Finalize();
+    return false;
+  }
+  offsets_ = reinterpret_cast<const ULong64_t*>(data_+index_);
+
+  // By default, all the events are read in order
+  current_=0; last_=nevents_; stride_=1;
+  madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadHeader
+// -----------------------------------------------------------------------------
+bool EventStoreReader::ReadHeader(SampleFormat& mySample)
+{
+  if (data_==0) return false;
+  if (Offset(0)>index_)
+  {
+    ERROR << "the index of the file " << filename_ << " is corrupted" 
+          << endmsg;
+    return false;
+  }
+  std::istringstream input(std::string(data_, Offset(0)));
+  return BinaryEventFormat::ReadSample(input, mySample);
+}
+
+
+// -----------------------------------------------------------------------------
+// SelectEvents
+// -----------------------------------------------------------------------------
+bool EventStoreReader::SelectEvents(ULong64_t first, ULong64_t last, 
+                                    ULong64_t stride)
+{
+  if (data_==0) return false;
+  if (last==0 || last>nevents_) last=nevents_;
+  if (stride==0) stride=1;
+  current_ = (first<last) ? first : last;
+  last_    = last;
+  stride_  = stride;
+
+  // Sampling: the kernel should not read ahead the skipped events
+  if (stride_>1) madvise(const_cast<char*>(data_), size_, MADV_RANDOM);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// ReadEvent
+// -----------------------------------------------------------------------------
+StatusCode::Type EventStoreReader::ReadEvent(EventFormat& myEvent, 
+                                             SampleFormat& mySample)
+{
+  if (data_==0 || current_>=last_) return StatusCode::FAILURE;
+
+  // Decoding the event in place (the offsets are not trusted: the event 
+  // must lie between its offset and the next one, before the index)
+  ULong64_t first = Offset(current_);
+  ULong64_t next  = Offset(current_+1);
+  current_ = (last_-current_>stride_) ? current_+stride_ : last_;
+  const char* begin = data_+first;
+  if (first>next || next>index_ || 
+      !BinaryEventFormat::ReadEvent(begin, data_+next, myEvent))
+  {
+    ERROR << "an event of the file " << filename_ 
+          << " is corrupted" << endmsg;
+    current_=last_;
+    return StatusCode::FAILURE;
+  }
+  return StatusCode::KEEP;
+}
+
+
+// -----------------------------------------------------------------------------
+// Finalize
+// -----------------------------------------------------------------------------
+bool EventStoreReader::Finalize()
+{
+  if (data_!=0) munmap(const_cast<char*>(data_), size_);
+  data_=0; size_=0; offsets_=0; nevents_=0; index_=0;
+  current_=0; last_=0; stride_=1;
+  return true;
+}
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EVENT_STORE_READER_h
+#define EVENT_STORE_READER_h
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Reader of the MA5 event store (extension '.ma5store'). The file is mapped
+/// in memory and the events are decoded in place: the pages are shared 
+/// through the OS page cache by all the processes reading the same file,
+/// and the index of the event offsets gives a direct access to any event.
+//////////////////////////////////////////////////////////////////////////////
+class EventStoreReader : public ReaderBase
+{
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ protected:
+
+  /// Name of the file
+  std::string filename_;
+
+  /// Mapped file
+  const char* data_;
+  ULong64_t size_;
+
+  /// Index of the event offsets (inside the mapped file)
+  const ULong64_t* offsets_;
+  ULong64_t nevents_;
+
+  /// Offset of the index = end of the last event
+  ULong64_t index_;
+
+  /// Selection of the events
+  ULong64_t current_;
+  ULong64_t last_;
+  ULong64_t stride_;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public:
+
+  /// Constructor without argument
+  EventStoreReader()
+  { 
+    data_=0; size_=0; offsets_=0; nevents_=0; index_=0;
+    current_=0; last_=0; stride_=1;
+  }
+
+	/// Destructor
+  virtual ~EventStoreReader()
+  { Finalize(); }
+
+  /// Initialize
+  virtual bool Initialize(const std::string& rawfilename,
+                          const Configuration& cfg);
+
+  /// Read the header
+  virtual bool ReadHeader(SampleFormat& mySample);
+
+  /// Finalize the header
+  virtual bool FinalizeHeader(SampleFormat& mySample)
+  { return true; }
+
+  /// Read the event
+  virtual StatusCode::Type ReadEvent(EventFormat& myEvent, 
+                                     SampleFormat& mySample);
+
+  /// Finalize the event (everything is already stored in the file)
+  virtual bool FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
+  { FinalizeParticles(myEvent); return true; }
+
+  /// Finalize
+  virtual bool Finalize();
+
+  /// Number of events in the file
+  virtual Long64_t GetNumberOfEvents()
+  { return static_cast<Long64_t>(nevents_); }
+
+  /// Random access to the events
+  virtual bool SelectEvents(ULong64_t first, ULong64_t last, ULong64_t stride);
+
+  /// Selected events (before reading them)
+  virtual void GetSelection(ULong64_t& first, ULong64_t& stride) const
+  { first=current_; stride=stride_; }
+
+  /// Get the file size
+  virtual Long64_t GetFileSize()
+  { return static_cast<Long64_t>(size_); }
+
+  /// Get the position in file (beginning of the next event)
+  virtual Long64_t GetPosition()
+  { return static_cast<Long64_t>(Offset(current_)); }
+
+  /// Get the final position in file (end of the last selected event)
+  virtual Long64_t GetFinalPosition()
+  { return static_cast<Long64_t>(Offset(last_)); }
+
+ private:
+
+  /// Offset of the event i (the index for i=nevents)
+  ULong64_t Offset(ULong64_t i) const
+  { return (i<nevents_) ? offsets_[i] : index_; }
+
+};
+
+}
+
+#endif
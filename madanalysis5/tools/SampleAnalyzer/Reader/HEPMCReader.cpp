@@ -23,10 +23,11 @@
 
 
 //STL headers
-#include <sstream>
+#include <algorithm>
 
 //SampleHeader headers
 #include "SampleAnalyzer/Reader/HEPMCReader.h"
+#include "SampleAnalyzer/Reader/TextTokenizer.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
 using namespace MA5;
@@ -46,23 +47,20 @@ bool HEPMCReader::ReadHeader(SampleFormat& mySample)
   warnmother_=true;
 
   // Skipping header line until first event line
-  std::string firstWord;
-  std::string line;
+  TextLine firstWord;
+  TextLine line;
 
   while(firstWord!="E")
   {
     // Getting the next non-empty line
     if (!ReadLine(line)) return false;
 
-    // Splitting the line in words
-    std::stringstream str;
-    str << line;
-
     // Extracting the first word
-    str >> firstWord;
+    firstWord = line.FirstWord();
   }
   
-  savedline_  = line;
+  savedline_.assign(line.data(),line.size());
+  nextEventStart_=buffer_.GetPosition(line);
 
   // Normal end
   return true;
@@ -84,6 +82,7 @@ StatusCode::Type HEPMCReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySa
 {
   // Initializing MC event
   myEvent.InitializeMC();
+  endvertices_.clear();
 
   Bool_t eventOnGoing=false;
 
@@ -93,6 +92,7 @@ StatusCode::Type HEPMCReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySa
     FillEvent(savedline_, myEvent, mySample);
     eventOnGoing=true;
     savedline_="";
+    eventStart_=nextEventStart_;
   }
 
   bool endEvent=false;
@@ -100,7 +100,7 @@ StatusCode::Type HEPMCReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySa
   // Loop over particle
   while(!endEvent)
   {
-    std::string line;
+    TextLine line;
 
     // Getting a line from the file
     if (!ReadLine(line))
@@ -108,18 +108,14 @@ StatusCode::Type HEPMCReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySa
       if (eventOnGoing) return StatusCode::KEEP; else return StatusCode::FAILURE;
     }
 
-    // Splitting the line in words
-    std::stringstream str;
-    str << line;
-
-    // Extracting the first word
-    std::string firstWord;
-    str >> firstWord;
-
-    // Is next event ?
-    if (firstWord=="E")
+    // Is next event ? (possibly belonging to the next shard)
+    if (LineCode(line)=='E')
     {
-      savedline_  = line;
+      if (!IsPastShardEnd(line))
+      {
+        savedline_.assign(line.data(),line.size());
+        nextEventStart_=buffer_.GetPosition(line);
+      }
       return StatusCode::KEEP;
     }
     else
@@ -141,57 +137,51 @@ StatusCode::Type HEPMCReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySa
 // -----------------------------------------------------------------------------
 bool HEPMCReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
 {
+  // Index of the particles by end-vertex barcode
+  std::sort(endvertices_.begin(),endvertices_.end());
+
   // Computing met, mht, ...
   for (unsigned int i=0; i<myEvent.mc()->particles_.size();i++)
   {
     MCParticleFormat& part = myEvent.mc()->particles_[i];
 
-    // Setting mother
+    // Setting mother: particles whose end vertex is the production vertex
+    // (same order as a scan of the whole particle list)
     if (part.extra1_!=part.extra2_)
     {
       unsigned int nmother=0;
-      for (unsigned int j=0; j < myEvent.mc()->particles_.size();j++)
+      std::vector< std::pair<Int_t,UInt_t> >::const_iterator it =
+        std::lower_bound(endvertices_.begin(), endvertices_.end(),
+                         std::make_pair(part.extra1_,static_cast<UInt_t>(0)));
+      for (; it!=endvertices_.end() && it->first==part.extra1_; it++)
       {
+        unsigned int j = it->second;
         if (i==j) continue;
-        if (part.extra1_ == myEvent.mc()->particles_[j].extra2_)
-        {
-          // set daughter
-          myEvent.mc()->particles_[j].daughters_.push_back(&part);
-
-          // set mother
-          nmother++;
-          if      (nmother==1) part.mother1_=&(myEvent.mc()->particles()[j]);
-          else if (nmother==2) part.mother2_=&(myEvent.mc()->particles()[j]);
-          else 
-          { 
-            if (warnmother_) 
-            {
-              WARNING << "Number of mothers greather than 2 : " << nmother << endmsg; 
-              warnmother_=false; 
-            }
+
+        // set daughter
+        myEvent.mc()->decays_.AddEdge(j,i);
+
+        // set mother
+        nmother++;
+        if      (nmother==1) part.mother1_=&(myEvent.mc()->particles()[j]);
+        else if (nmother==2) part.mother2_=&(myEvent.mc()->particles()[j]);
+        else 
+        { 
+          if (warnmother_) 
+          {
+            WARNING << "Number of mothers greather than 2 : " << nmother << endmsg; 
+            warnmother_=false; 
           }
         }
       }
     }
-
-    // MET, MHT, TET, THT
-    if (part.statuscode()==1 && !PHYSICS->Id->IsInvisible(part))
-    {
-      myEvent.mc()->MET_ -= part.momentum();
-      myEvent.mc()->TET_ += part.pt();
-      if (PHYSICS->Id->IsHadronic(part))
-      {
-        myEvent.mc()->MHT_ -= part.momentum();
-        myEvent.mc()->THT_ += part.pt(); 
-      }
-    }
   }
 
-  // Finalize event
-  myEvent.mc()->MET_.momentum().SetPz(0.);
-  myEvent.mc()->MET_.momentum().SetE(myEvent.mc()->MET_.momentum().Pt());
-  myEvent.mc()->MHT_.momentum().SetPz(0.);
-  myEvent.mc()->MHT_.momentum().SetE(myEvent.mc()->MHT_.momentum().Pt());
+  // Decay graph
+  myEvent.mc()->decays_.Build(myEvent.mc()->particles_);
+
+  // Classification and structure-of-arrays copy of the particles
+  FinalizeParticles(myEvent);
 
   // Normal end 
   return true; 
@@ -201,19 +191,17 @@ bool HEPMCReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
 //------------------------------------------------------------------------------
 // FillWeightNames
 //------------------------------------------------------------------------------
-Bool_t HEPMCReader::FillWeightNames(const std::string& line)
+Bool_t HEPMCReader::FillWeightNames(const TextLine& line)
 {
   // Splitting line in words
-  std::stringstream str;
-  str << line ;
+  TextTokenizer str(line);
 
-  // Getting the first word
-  std::string firstWord;
-  str >> firstWord;
+  // Skipping the first word
+  str.Skip();
 
   // Extracting the number of weights
-  int nweights;
-  str >> nweights;
+  Int_t nweights=0;
+  str.Next(nweights);
   if (nweights<0)
   {
     ERROR << "Number of weights is not correct: " 
@@ -226,12 +214,16 @@ Bool_t HEPMCReader::FillWeightNames(const std::string& line)
             << "Only the first one will be used." << endmsg;
   }
 
-  // Storing weight names
-  weightnames_.clear();
+  // Storing weight names (the strings keep their capacity)
   weightnames_.resize(static_cast<unsigned int>(nweights));
 
   // Filling weight names
-  for (unsigned int i=0;i<weightnames_.size();i++) str >> weightnames_[i];
+  TextLine word;
+  for (unsigned int i=0;i<weightnames_.size();i++)
+  {
+    if (!str.NextWord(word)) { weightnames_[i].clear(); continue; }
+    weightnames_[i].assign(word.data(),word.size());
+  }
 
   return true;
 }
@@ -240,7 +232,7 @@ Bool_t HEPMCReader::FillWeightNames(const std::string& line)
 //------------------------------------------------------------------------------
 // FillHeavyIons
 //------------------------------------------------------------------------------
-Bool_t HEPMCReader::FillHeavyIons(const std::string& line)
+Bool_t HEPMCReader::FillHeavyIons(const TextLine& line)
 {
   if (line!="") if (firstHeavyIons_) 
      WARNING << "WARNING: HeavyIons block is not "
@@ -253,50 +245,43 @@ Bool_t HEPMCReader::FillHeavyIons(const std::string& line)
 //------------------------------------------------------------------------------
 // FillEventHeader
 //------------------------------------------------------------------------------
-Bool_t HEPMCReader::FillEvent(const std::string& line,
+Bool_t HEPMCReader::FillEvent(const TextLine& line,
                               EventFormat& myEvent, 
                               SampleFormat& mySample)
 {
-  // Splitting line in words
-  std::stringstream str;
-  str << line ;
-
-  // Getting the first word
-  std::string firstWord;
-  str >> firstWord;
-
-  // Event global info
-  if(firstWord=="E") FillEventInformations(line, myEvent);
+  // Dispatching on the line code
+  switch (LineCode(line))
+  {
+    // Particle Line
+    case 'P': FillEventParticleLine(line,myEvent); break;
 
-  // Weight names
-  else if (firstWord=="N") FillWeightNames(line);
+    // Vertex line
+    case 'V': FillEventVertexLine(line,myEvent); break;
 
-  // Event units
-  else if (firstWord=="U") FillUnits(line);
+    // Event global info
+    case 'E': FillEventInformations(line, myEvent); break;
 
-  // Cross section
-  else if (firstWord=="C") FillCrossSection(line,mySample);
+    // Weight names
+    case 'N': FillWeightNames(line); break;
 
-  // HeavyIon line
-  else if (firstWord=="H") FillHeavyIons(line);
+    // Event units
+    case 'U': FillUnits(line); break;
 
-  // PDF Info
-  else if (firstWord=="F") FillEventPDFInfo(line,mySample,myEvent);
+    // Cross section
+    case 'C': FillCrossSection(line,mySample); break;
 
-  // Vertex line
-  else if (firstWord=="V") FillEventVertexLine(line,myEvent);
+    // HeavyIon line
+    case 'H': FillHeavyIons(line); break;
 
-  // Particle Line
-  else if (firstWord=="P") FillEventParticleLine(line,myEvent);
+    // PDF Info
+    case 'F': FillEventPDFInfo(line,mySample,myEvent); break;
 
-  // End
-  else if (firstWord=="HepMC::IO_GenEvent-END_EVENT_LISTING") return false;
+    // End or other cases
+    default:
+      if (line.FirstWord()=="HepMC::IO_GenEvent-END_EVENT_LISTING") return false;
 
-  // Other cases
-  else
-  {
-    // ignore other cases
-    WARNING << "HEPMC linecode unknown" << endmsg;
+      // ignore other cases
+      WARNING << "HEPMC linecode unknown" << endmsg;
   }
 
   // Normal end
@@ -306,63 +291,48 @@ Bool_t HEPMCReader::FillEvent(const std::string& line,
 // -----------------------------------------------------------------------------
 // FillEventInformations
 // -----------------------------------------------------------------------------
-void HEPMCReader::FillEventInformations(const std::string& line,
+void HEPMCReader::FillEventInformations(const TextLine& line,
                                   EventFormat& myEvent)
 {
-  std::stringstream str;
-  str << line;
-  std::string firstc;
-  int tmp=0;
+  TextTokenizer str(line);
+  Int_t n=0;
 
   // Filling general info
-  str >> firstc;                   // character 'E'
-  str >> tmp;                      // event number
-  str >> tmp;                      // number of multi particle interactions
-  str >> myEvent.mc()->scale_;     // event scale
-  str >> myEvent.mc()->alphaQCD_;  // alpha QCD
-  str >> myEvent.mc()->alphaQED_;  // alpha QED
-  str >> myEvent.mc()->processId_; // signal process id
-  str >> tmp;                      // barcode for signal process vertex
-  str >> tmp;                      // number of vertices in this event
-  str >> tmp;                      // barcode for beam particle 1
-  str >> tmp;                      // barcode for beam particle 2
-
-  // Extracting random state list
-  str >> tmp;
-  if (tmp>0)
-  {
-    std::vector<Long64_t> randoms(static_cast<unsigned int>(tmp));
-    for (unsigned int i=0;i<randoms.size();i++) str >> randoms[i];
-  }
-
-  // Extracting weight lists
-  str >> tmp;
-  if (tmp>0)
-  {
-    std::vector<double> weights(static_cast<unsigned int>(tmp));
-    for (unsigned int i=0;i<weights.size();i++)
-    {
-      if (i==0) str >> myEvent.mc()->weight_;
-      str >> weights[i];
-    }
-  }
-
+  str.Skip();                        // character 'E'
+  str.Skip();                        // event number
+  str.Skip();                        // number of multi particle interactions
+  str.Next(myEvent.mc()->scale_);    // event scale
+  str.Next(myEvent.mc()->alphaQCD_); // alpha QCD
+  str.Next(myEvent.mc()->alphaQED_); // alpha QED
+  str.Next(myEvent.mc()->processId_);// signal process id
+  str.Skip();                        // barcode for signal process vertex
+  str.Skip();                        // number of vertices in this event
+  str.Skip();                        // barcode for beam particle 1
+  str.Skip();                        // barcode for beam particle 2
+
+  // Skipping random state list
+  if (!str.Next(n)) return;
+  for (Int_t i=0;i<n;i++) str.Skip();
+
+  // Extracting the first weight of the list
+  n=0;
+  if (!str.Next(n)) return;
+  if (n>0) str.Next(myEvent.mc()->weight_);
 }
 
 // -----------------------------------------------------------------------------
 // FillUnits
 // -----------------------------------------------------------------------------
-void HEPMCReader::FillUnits(const std::string& line)
+void HEPMCReader::FillUnits(const TextLine& line)
 {
-  std::stringstream str;
-  str << line;
-  std::string tmp;
+  TextTokenizer str(line);
+  TextLine tmp;
   
-  // character 'N'
-  str >> tmp; 
+  // character 'U'
+  str.Skip(); 
 
   // momentum units
-  str >> tmp;
+  str.NextWord(tmp);
   if (tmp=="GEV") energy_unit_=1;
   else if (tmp=="MEV") energy_unit_=0.001;
   else if (tmp=="KEV") energy_unit_=0.000001;
@@ -372,7 +342,8 @@ void HEPMCReader::FillUnits(const std::string& line)
   }
 
   // length units
-  str >> tmp;
+  tmp = TextLine();
+  str.NextWord(tmp);
   if (tmp=="MM") length_unit_=1;
   else if (tmp=="CM") length_unit_=0.1;
   else 
@@ -386,24 +357,22 @@ void HEPMCReader::FillUnits(const std::string& line)
 // -----------------------------------------------------------------------------
 // FillCrossSection
 // -----------------------------------------------------------------------------
-void HEPMCReader::FillCrossSection(const std::string& line, 
+void HEPMCReader::FillCrossSection(const TextLine& line, 
                                    SampleFormat& mySample)
 {
   // Splitting the line in words
-  std::stringstream str;
-  str << line;
+  TextTokenizer str(line);
   
   // First character
-  std::string firstc;
-  str >> firstc;
+  str.Skip();
 
   // xsection mean
   Double_t xsectmp=0;
-  str >> xsectmp;
+  str.Next(xsectmp);
 
   // xsection error
   Double_t xsectmp_err=0;
-  str >> xsectmp_err;
+  str.Next(xsectmp_err);
 
   // saving xsection mean & error
   if (mySample.mc()!=0)
@@ -416,72 +385,68 @@ void HEPMCReader::FillCrossSection(const std::string& line,
 // -----------------------------------------------------------------------------
 // FillEventPDFInfo
 // -----------------------------------------------------------------------------
-void HEPMCReader::FillEventPDFInfo(const std::string& line, 
+void HEPMCReader::FillEventPDFInfo(const TextLine& line, 
                                    SampleFormat& mySample,
                                    EventFormat& myEvent)
 {
-  std::stringstream str;
-  str << line;
-  std::string firstc;
-  str >> firstc;
-  str >> mySample.mc()->beamPDGID_.first;
-  str >> mySample.mc()->beamPDGID_.second;
-  str >> mySample.mc()->beamPDFID_.first;
-  str >> mySample.mc()->beamPDFID_.second;
-  str >> myEvent.mc()->x_.first;
-  str >> myEvent.mc()->x_.second;
-  str >> myEvent.mc()->PDFscale_;
-  str >> myEvent.mc()->xpdf_.first;
-  str >> myEvent.mc()->xpdf_.second;
+  TextTokenizer str(line);
+  str.Skip();
+  str.Next(mySample.mc()->beamPDGID_.first);
+  str.Next(mySample.mc()->beamPDGID_.second);
+  str.Next(mySample.mc()->beamPDFID_.first);
+  str.Next(mySample.mc()->beamPDFID_.second);
+  str.Next(myEvent.mc()->x_.first);
+  str.Next(myEvent.mc()->x_.second);
+  str.Next(myEvent.mc()->PDFscale_);
+  str.Next(myEvent.mc()->xpdf_.first);
+  str.Next(myEvent.mc()->xpdf_.second);
 }
 
 // -----------------------------------------------------------------------------
 // FillEventParticleLine
 // -----------------------------------------------------------------------------
-void HEPMCReader::FillEventParticleLine(const std::string& line,
+void HEPMCReader::FillEventParticleLine(const TextLine& line,
                                         EventFormat& myEvent)
 {
-  std::stringstream str;
-  str << line;
+  TextTokenizer str(line);
 
-  double tmp;    // temporary variable to fill in LorentzVector
+  Double_t px=0., py=0., pz=0., e=0.; // components of the LorentzVector
 
   // Get a new particle
   MCParticleFormat * part = myEvent.mc()->GetNewParticle();
-  char linecode;
-  str >> linecode;
-  UInt_t partnum;
-  str >> partnum;
-  str >> part->pdgid_;
-  str >> tmp; part->momentum_.SetPx(tmp*energy_unit_);
-  str >> tmp; part->momentum_.SetPy(tmp*energy_unit_);
-  str >> tmp; part->momentum_.SetPz(tmp*energy_unit_);
-  str >> tmp; part->momentum_.SetE (tmp*energy_unit_);
-  str >> tmp; 
-  str >> part->statuscode_;
-  str >> tmp; 
-  str >> tmp; 
-  str >> part->extra2_;
+  str.Skip();                 // character 'P'
+  str.Skip();                 // barcode
+  str.Next(part->pdgid_);
+  str.Next(px);
+  str.Next(py);
+  str.Next(pz);
+  str.Next(e);
+  part->momentum_.SetPxPyPzE(px*energy_unit_,py*energy_unit_,
+                             pz*energy_unit_,e*energy_unit_);
+  str.Skip();                 // generated mass
+  str.Next(part->statuscode_);
+  str.Skip();                 // polarization theta
+  str.Skip();                 // polarization phi
+  str.Next(part->extra2_);
   part->extra1_=current_vertex_.barcode_;
+  endvertices_.push_back(std::make_pair(part->extra2_,
+                         static_cast<UInt_t>(myEvent.mc()->particles_.size()-1)));
 }
 
 // -----------------------------------------------------------------------------
 // FillEventVertexLine
 // -----------------------------------------------------------------------------
-void HEPMCReader::FillEventVertexLine(const std::string& line, EventFormat& myEvent)
+void HEPMCReader::FillEventVertexLine(const TextLine& line, EventFormat& myEvent)
 {
-  std::stringstream str;
-  str << line;
-
-  int tmp=0;
-  char linecode;
-  str >> linecode;                  // character 'V'
-  str >> current_vertex_.barcode_;  // barcode
-  str >> tmp;                       // id
-  str >> tmp;                       // x
-  str >> tmp;                       // y
-  str >> tmp;                       // z
-  str >> current_vertex_.ctau_;     // ctau
+  TextTokenizer str(line);
+
+  str.Skip();                         // character 'V'
+  str.Next(current_vertex_.barcode_); // barcode
+  str.Skip();                         // id
+  str.Skip();                         // x
+  str.Skip();                         // y
+  str.Skip();                         // z
+  str.Next(current_vertex_.ctau_);    // ctau
 }
 
 
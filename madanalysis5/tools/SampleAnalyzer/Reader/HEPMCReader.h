@@ -60,6 +60,10 @@ class HEPMCReader : public ReaderTextBase
   
   HEPVertex current_vertex_;
 
+  /// (end-vertex barcode, particle index) of the particles of the event,
+  /// sorted by barcode in FinalizeEvent for finding the mothers
+  std::vector< std::pair<Int_t,UInt_t> > endvertices_;
+
   // -------------------------------------------------------------
   //                       method members
   // -------------------------------------------------------------
@@ -87,19 +91,44 @@ class HEPMCReader : public ReaderTextBase
   
   /// Finalize the event
   virtual bool FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent);
+
+ protected:
+
+  /// Can the file be split into byte ranges ?
+  virtual bool AllowsSharding() const
+  { return true; }
+
+  /// Is the line the first line of an event ?
+  virtual bool IsEventStart(const TextLine& line) const
+  { return LineCode(line)=='E'; }
+
+  /// Restarting the reading from the E line
+  virtual void Resynchronize(const TextLine& line)
+  {
+    savedline_.assign(line.data(),line.size());
+    nextEventStart_ = line.empty() ? -1 : buffer_.GetPosition(line);
+  }
   
  private:
   
-  Bool_t FillEvent(const std::string& line, EventFormat& myEvent, SampleFormat& mySample);
-  void FillEventInformations(const std::string& line, EventFormat& myEvent);
-  void FillCrossSection(const std::string& line, SampleFormat& mySample);
-  void FillUnits(const std::string& line);
-  void FillEventPDFInfo(const std::string& line, SampleFormat& mySample, EventFormat& myEvent);
-  void FillEventParticleLine(const std::string& line, EventFormat& myEvent);
-  void FillEventVertexLine(const std::string& line, EventFormat& myEvent);
+  Bool_t FillEvent(const TextLine& line, EventFormat& myEvent, SampleFormat& mySample);
+  void FillEventInformations(const TextLine& line, EventFormat& myEvent);
+  void FillCrossSection(const TextLine& line, SampleFormat& mySample);
+  void FillUnits(const TextLine& line);
+  void FillEventPDFInfo(const TextLine& line, SampleFormat& mySample, EventFormat& myEvent);
+  void FillEventParticleLine(const TextLine& line, EventFormat& myEvent);
+  void FillEventVertexLine(const TextLine& line, EventFormat& myEvent);
   void SetMother(MCParticleFormat* const part, EventFormat& myEvent);
-  Bool_t FillWeightNames(const std::string& line);
-  Bool_t FillHeavyIons(const std::string& line);
+  Bool_t FillWeightNames(const TextLine& line);
+  Bool_t FillHeavyIons(const TextLine& line);
+
+  /// Code of the line (first word made of one character), 0 otherwise
+  static char LineCode(const TextLine& line)
+  {
+    TextLine word = line.FirstWord();
+    if (word.size()!=1) return 0;
+    return word[0];
+  }
 
 };
 
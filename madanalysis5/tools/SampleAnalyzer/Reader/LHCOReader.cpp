@@ -67,21 +67,17 @@ StatusCode::Type LHCOReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySam
   bool EndOfLoop = false;
   
   // Declarging a new string for line
-  std::string line;
-  std::string tmp;
+  TextLine line;
+  TextLine tmp;
      
   do
   {
-    std::stringstream str;
-    str.str("");
-      
     if (!ReadLine(line))
     {
       EndOfFile_=true;
       return StatusCode::KEEP;
     }
-    str << line;
-    str >> tmp;
+    tmp = line.FirstWord();
 
     if (saved_)
     {
@@ -100,7 +96,7 @@ StatusCode::Type LHCOReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySam
       else 
 	    {
 	      EndOfLoop = true;
-	      savedline_=line;
+	      savedline_.assign(line.data(),line.size());
 	      saved_=true;
 	      continue;
 	    }
@@ -159,7 +155,7 @@ bool LHCOReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
 // -----------------------------------------------------------------------------                                     
 // FillEventInitLine                                     
 // -----------------------------------------------------------------------------     
-void LHCOReader::FillEventInitLine(const std::string& line, EventFormat& myEvent)
+void LHCOReader::FillEventInitLine(const TextLine& line, EventFormat& myEvent)
 {
   std::stringstream str;
   std::string muf;
@@ -169,7 +165,7 @@ void LHCOReader::FillEventInitLine(const std::string& line, EventFormat& myEvent
 // -----------------------------------------------------------------------------                                     
 // FillEventParticleLine                                     
 // -----------------------------------------------------------------------------     
-void LHCOReader::FillEventParticleLine(const std::string& line, EventFormat& myEvent)
+void LHCOReader::FillEventParticleLine(const TextLine& line, EventFormat& myEvent)
 {
   std::stringstream str;
 
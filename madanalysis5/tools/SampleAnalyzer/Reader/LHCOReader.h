@@ -73,8 +73,8 @@ class LHCOReader : public ReaderTextBase
 
  private:
 
-  void FillEventParticleLine(const std::string& line, EventFormat& myEvent);
-  void FillEventInitLine(const std::string& line, EventFormat& myEvent);
+  void FillEventParticleLine(const TextLine& line, EventFormat& myEvent);
+  void FillEventInitLine(const TextLine& line, EventFormat& myEvent);
 };
 
 }
@@ -28,6 +28,7 @@
 
 // SampleHeader headers
 #include "SampleAnalyzer/Reader/LHEReader.h"
+#include "SampleAnalyzer/Reader/TextTokenizer.h"
 #include "SampleAnalyzer/Service/LogService.h"
 
 using namespace MA5;
@@ -41,7 +42,7 @@ bool LHEReader::ReadHeader(SampleFormat& mySample)
   mySample.InitializeMC();
 
   // Declaring a new string for line
-  std::string line;
+  TextLine line;
 
   // Generator tags
   Bool_t tag_calchep = false;
@@ -74,7 +75,7 @@ bool LHEReader::ReadHeader(SampleFormat& mySample)
         if (!ReadLine(line,false)) return false;
         EndOfLoop = (line.find("</header>")!=std::string::npos);
         if (EndOfLoop) continue;
-        else mySample.AddHeader(line);
+        else mySample.AddHeader(line.str());
         if ( (line.find("<MGGenerationInfo>")!=std::string::npos) ||
              (line.find("<mgversion>")!=std::string::npos)        ||
              (line.find("<MG5ProcCard>")!=std::string::npos)         )
@@ -132,6 +133,7 @@ bool LHEReader::ReadHeader(SampleFormat& mySample)
     EndOfLoop = (line.find("<event>")!=std::string::npos);
   }
   while(!EndOfLoop);
+  nextEventStart_=buffer_.GetPosition(line);
 
 
   // Determining sample format 
@@ -207,7 +209,7 @@ StatusCode::Type LHEReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySamp
   myEvent.InitializeMC();
 
   // Declaring a new string for line
-  std::string line;
+  TextLine line;
   bool EndOfLoop=false;
 
   // Read line by line the file until tag <event>
@@ -217,10 +219,15 @@ StatusCode::Type LHEReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySamp
     do 
     { 
       if (!ReadLine(line)) return StatusCode::FAILURE;
-      EndOfLoop = (line.find("<event>")!=std::string::npos);
+      EndOfLoop = HasTag(line,"<event>");
     }
     while(!EndOfLoop);
+
+    // This event belongs to the next shard
+    if (IsPastShardEnd(line)) return StatusCode::FAILURE;
+    eventStart_=buffer_.GetPosition(line);
   }
+  else eventStart_=nextEventStart_;
 
   // Read the particles
   EndOfLoop=false;
@@ -229,18 +236,18 @@ StatusCode::Type LHEReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySamp
   do 
   { 
     if (!ReadLine(line)) return StatusCode::FAILURE;
-    if(line.find("<rwgt>")!=std::string::npos) 
+    if (HasTag(line,"<rwgt>")) 
     {
        bool EndReweighting = false;
        do
        { 
          if (!ReadLine(line)) return StatusCode::FAILURE;
-         EndReweighting = (line.find("</rwgt>")!=std::string::npos);
+         EndReweighting = HasTag(line,"</rwgt>");
        }
        while(!EndReweighting);
        if (!ReadLine(line)) return StatusCode::FAILURE;
     }
-    EndOfLoop = (line.find("</event>")!=std::string::npos);
+    EndOfLoop = HasTag(line,"</event>");
     if (!EndOfLoop)
     {
       if (first) FillEventInitLine(line,myEvent);
@@ -260,35 +267,14 @@ StatusCode::Type LHEReader::ReadEvent(EventFormat& myEvent, SampleFormat& mySamp
 // -----------------------------------------------------------------------------
 bool LHEReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
 {
-  // Traditional LHE or simplified LHE ?
-  Bool_t simplified = (mySample.sampleFormat()==MA5FORMAT::SIMPLIFIED_LHE);
+  // Traditional LHE or simplified LHE ? (in the latter case, the MET is 
+  // the sum of the invisible particles)
+  myEvent.mc()->simplifiedMET_ = 
+    (mySample.sampleFormat()==MA5FORMAT::SIMPLIFIED_LHE);
 
   // Mother pointer assignment
   for (unsigned int i=0; i<myEvent.mc()->particles_.size();i++)
   {
-    MCParticleFormat& part = myEvent.mc()->particles_[i];
-
-    // MET in case of simplified LHE
-    if ( ( part.pdgid()==12 || (part.statuscode()==1 && PHYSICS->Id->IsInvisible(part)) ) && simplified)
-    {
-      myEvent.mc()->MET_ += part.momentum();
-    }
-
-    // MET, MHT, TET, THT
-    if (part.statuscode()==1 && !PHYSICS->Id->IsInvisible(part))
-    {
-      if (!simplified)
-      {
-        myEvent.mc()->MET_ -= part.momentum();
-      }
-      myEvent.mc()->TET_ += part.pt();
-      if (PHYSICS->Id->IsHadronic(part))
-      {
-        myEvent.mc()->MHT_ -= part.momentum();
-        myEvent.mc()->THT_ += part.pt(); 
-      }
-    }
-    
     unsigned int index1=myEvent.mc()->particles_[i].mothup1_;
     unsigned int index2=myEvent.mc()->particles_[i].mothup2_;
     if (index1!=0 && index2!=0)
@@ -313,17 +299,17 @@ bool LHEReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
       }
 
       myEvent.mc()->particles_[i].mother1_ = &myEvent.mc()->particles_[index1-1];
-      myEvent.mc()->particles_[index1-1].daughters_.push_back(&myEvent.mc()->particles_[i]);
+      myEvent.mc()->decays_.AddEdge(index1-1,i);
       myEvent.mc()->particles_[i].mother2_ = &myEvent.mc()->particles_[index2-1];
-      myEvent.mc()->particles_[index2-1].daughters_.push_back(&myEvent.mc()->particles_[i]);
+      myEvent.mc()->decays_.AddEdge(index2-1,i);
     }
   }
 
-  // Finalize event
-  myEvent.mc()->MET_.momentum().SetPz(0.);
-  myEvent.mc()->MET_.momentum().SetE(myEvent.mc()->MET_.momentum().Pt());
-  myEvent.mc()->MHT_.momentum().SetPz(0.);
-  myEvent.mc()->MHT_.momentum().SetE(myEvent.mc()->MHT_.momentum().Pt());
+  // Decay graph
+  myEvent.mc()->decays_.Build(myEvent.mc()->particles_);
+
+  // Classification and structure-of-arrays copy of the particles
+  FinalizeParticles(myEvent);
 
   // Normal end
   return true; 
@@ -333,7 +319,7 @@ bool LHEReader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
 // -----------------------------------------------------------------------------
 // FillHeaderInitLine
 // -----------------------------------------------------------------------------
-void LHEReader::FillHeaderInitLine(const std::string& line, 
+void LHEReader::FillHeaderInitLine(const TextLine& line, 
                                    SampleFormat& mySample)
 {
   std::stringstream str;
@@ -355,84 +341,63 @@ void LHEReader::FillHeaderInitLine(const std::string& line,
 // -----------------------------------------------------------------------------
 // FillHeaderProcessLine
 // -----------------------------------------------------------------------------
-void LHEReader::FillHeaderProcessLine(const std::string& line,
+void LHEReader::FillHeaderProcessLine(const TextLine& line,
                                       SampleFormat& mySample)
 {
-  std::string tmpline=line;
-  size_t posi = 0;
-  while( (posi = tmpline.find("D", posi)) != std::string::npos) 
-    tmpline=tmpline.replace(posi, 1, "E");
-  posi=0;
-  while( (posi = tmpline.find("d", posi)) != std::string::npos) 
-    tmpline=tmpline.replace(posi, 1, "E");
-
-  std::stringstream str;
-  str << tmpline;
+  TextTokenizer str(line);
 
   // Get a new process
   ProcessFormat * proc = mySample.mc()->GetNewProcess();
 
-  str >> proc->xsectionMean_;
-  str >> proc->xsectionError_;
-  str >> proc->weightMax_;
-  str >> proc->processId_;
+  str.Next(proc->xsectionMean_);
+  str.Next(proc->xsectionError_);
+  str.Next(proc->weightMax_);
+  str.Next(proc->processId_);
 }
 
 
 // -----------------------------------------------------------------------------
 // FillEventInitLine
 // -----------------------------------------------------------------------------
-void LHEReader::FillEventInitLine(const std::string& line,
+void LHEReader::FillEventInitLine(const TextLine& line,
                                   EventFormat& myEvent)
 {
-  std::stringstream str;
-  str << line;
-
-  str >> myEvent.mc()->nparts_;
-  str >> myEvent.mc()->processId_;
-  str >> myEvent.mc()->weight_;
-  str >> myEvent.mc()->scale_;
-  str >> myEvent.mc()->alphaQED_;
-  str >> myEvent.mc()->alphaQCD_;
+  TextTokenizer str(line);
+
+  str.Next(myEvent.mc()->nparts_);
+  str.Next(myEvent.mc()->processId_);
+  str.Next(myEvent.mc()->weight_);
+  str.Next(myEvent.mc()->scale_);
+  str.Next(myEvent.mc()->alphaQED_);
+  str.Next(myEvent.mc()->alphaQCD_);
 }
 
 
 // -----------------------------------------------------------------------------
 // FillEventParticleLine
 // -----------------------------------------------------------------------------
-void LHEReader::FillEventParticleLine(const std::string& line,
+void LHEReader::FillEventParticleLine(const TextLine& line,
                                       EventFormat& myEvent)
 {
-  std::string tmpline=line;
-  size_t posi = 0;
-  while( (posi = tmpline.find("D", posi)) != std::string::npos) 
-    tmpline=tmpline.replace(posi, 1, "E");
-  posi=0;
-  while( (posi = tmpline.find("d", posi)) != std::string::npos) 
-    tmpline=tmpline.replace(posi, 1, "E");
+  TextTokenizer str(line);
 
-  std::stringstream str;
-  str << tmpline;
-
-  signed int 	color1;	// color 1 not stored 
-  signed int	color2;	// color 2 not stored
-  double   		tmp;	  // temporary variable to fill in LorentzVector
+  Double_t px=0., py=0., pz=0., e=0.; // components of the LorentzVector
 
   // Get a new particle
   MCParticleFormat * part = myEvent.mc()->GetNewParticle();
 
-  str >> part->pdgid_;
-  str >> part->statuscode_;
-  str >> part->mothup1_;
-  str >> part->mothup2_;
-  str >> color1;
-  str >> color2;
-  str >> tmp; part->momentum_.SetPx(tmp); 
-  str >> tmp; part->momentum_.SetPy(tmp);
-  str >> tmp; part->momentum_.SetPz(tmp);
-  str >> tmp; part->momentum_.SetE(tmp);
-  str >> tmp;
-  str >> part->ctau_;
-  str >> part->spin_;
+  str.Next(part->pdgid_);
+  str.Next(part->statuscode_);
+  str.Next(part->mothup1_);
+  str.Next(part->mothup2_);
+  str.Skip();  // color 1 not stored
+  str.Skip();  // color 2 not stored
+  str.Next(px);
+  str.Next(py);
+  str.Next(pz);
+  str.Next(e);
+  part->momentum_.SetPxPyPzE(px,py,pz,e);
+  str.Skip();  // mass not stored
+  str.Next(part->ctau_);
+  str.Next(part->spin_);
 }
-
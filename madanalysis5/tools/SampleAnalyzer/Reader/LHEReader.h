@@ -79,15 +79,40 @@ class LHEReader : public ReaderTextBase
   virtual bool FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent);
 
 
+  //! Can the file be split into byte ranges ?
+  virtual bool AllowsSharding() const
+  { return true; }
+
+  //! Is the line the first line of an event ?
+  virtual bool IsEventStart(const TextLine& line) const
+  { return HasTag(line,"<event>"); }
+
+  //! Restarting the reading from the <event> line
+  virtual void Resynchronize(const TextLine& line)
+  {
+    firstevent_=!line.empty();
+    nextEventStart_ = firstevent_ ? buffer_.GetPosition(line) : -1;
+  }
+
  private:
 
   //! Fill the header from text line 
-  void FillHeaderProcessLine(const std::string& line, SampleFormat& mySample);
-  void FillHeaderInitLine   (const std::string& line, SampleFormat& mySample);
+  void FillHeaderProcessLine(const TextLine& line, SampleFormat& mySample);
+  void FillHeaderInitLine   (const TextLine& line, SampleFormat& mySample);
 
   //! Fill the event from text line 
-  void FillEventInitLine(const std::string& line, EventFormat& myFormat);
-  void FillEventParticleLine(const std::string& line, EventFormat& myFormat);
+  void FillEventInitLine(const TextLine& line, EventFormat& myFormat);
+  void FillEventParticleLine(const TextLine& line, EventFormat& myFormat);
+
+  //! Does the line contain the tag ? Only lines beginning with '<' are
+  //! scanned, so that the data lines are rejected after one character
+  static bool HasTag(const TextLine& line, const char* tag)
+  {
+    std::string::size_type i=0;
+    while (i<line.size() && (line[i]==' ' || line[i]=='\t')) i++;
+    if (i==line.size() || line[i]!='<') return false;
+    return line.find(tag)!=std::string::npos;
+  }
 
 };
 
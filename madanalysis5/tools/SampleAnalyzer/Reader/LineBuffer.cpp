@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/LineBuffer.h"
+
+using namespace MA5;
+
+
+// -----------------------------------------------------------------------------
+// NextLine
+// -----------------------------------------------------------------------------
+bool LineBuffer::NextLine(TextLine& line)
+{
+  std::string::size_type start = cursor_;
+  while(1)
+  {
+    // Looking for the end of the line in the buffer
+    const char* begin = &buffer_[0]+cursor_;
+    const char* end = static_cast<const char*>(
+                   std::memchr(&buffer_[0]+start,'\n',filled_-start));
+    if (end!=0)
+    {
+      line = TextLine(begin,end);
+      cursor_ = end-&buffer_[0]+1;
+      return true;
+    }
+
+    // The last line of the stream has no end-of-line character
+    if (eof_)
+    {
+      if (cursor_==filled_) return false;
+      line = TextLine(begin,&buffer_[0]+filled_);
+      cursor_ = filled_;
+      return true;
+    }
+
+    // Reading the following characters
+    start = filled_-cursor_;
+    Fill();
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Fill
+// -----------------------------------------------------------------------------
+bool LineBuffer::Fill()
+{
+  // Moving the unread characters at the beginning of the buffer
+  std::string::size_type remaining = filled_-cursor_;
+  if (remaining!=0 && cursor_!=0) 
+    std::memmove(&buffer_[0],&buffer_[0]+cursor_,remaining);
+  offset_ += cursor_;
+  cursor_  = 0;
+  filled_  = remaining;
+
+  // The line is longer than the buffer
+  if (filled_==buffer_.size()) buffer_.resize(2*buffer_.size());
+
+  // Reading a new block
+  if (input_==0) { eof_=true; return false; }
+  input_->read(&buffer_[0]+filled_, buffer_.size()-filled_);
+  std::streamsize n = input_->gcount();
+  filled_ += n;
+  if (n==0 || input_->eof() || input_->fail()) eof_=true;
+  return n!=0;
+}
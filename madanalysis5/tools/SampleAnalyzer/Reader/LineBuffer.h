@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef LINE_BUFFER_H
+#define LINE_BUFFER_H
+
+// STL headers
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+
+// ROOT headers
+#include <Rtypes.h> 
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Slice of a line stored in a LineBuffer (no copy of the characters).
+/// The slice is valid until the next line is read from the buffer.
+//////////////////////////////////////////////////////////////////////////////
+class TextLine
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// First character and end of the line
+  const char* begin_;
+  const char* end_;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  TextLine()
+  { begin_=0; end_=0; }
+
+  /// Constructor with a range of characters
+  TextLine(const char* begin, const char* end)
+  { begin_=begin; end_=end; }
+
+  /// Constructor pointing to the content of a string
+  TextLine(const std::string& line)
+  { begin_=line.data(); end_=begin_+line.size(); }
+
+  /// Accessor to the characters (not null-terminated)
+  const char* data() const
+  { return begin_; }
+
+  /// Number of characters
+  std::string::size_type size() const
+  { return end_-begin_; }
+
+  /// Is the line empty ?
+  bool empty() const
+  { return begin_==end_; }
+
+  /// Accessor to a character
+  const char& operator[] (std::string::size_type i) const
+  { return begin_[i]; }
+
+  /// Copy of the line in a string
+  std::string str() const
+  { return std::string(begin_,end_); }
+
+  /// Shortening the line
+  void resize(std::string::size_type n)
+  { if (n<size()) end_=begin_+n; }
+
+  /// Looking for a character
+  std::string::size_type find(char c) const
+  {
+    const void* found = std::memchr(begin_,c,size());
+    if (found==0) return std::string::npos;
+    return static_cast<const char*>(found)-begin_;
+  }
+
+  /// Looking for a tag (such as "<event>")
+  std::string::size_type find(const char* tag) const
+  {
+    std::string::size_type n = std::strlen(tag);
+    if (n==0) return 0;
+    for (const char* p=begin_; p+n<=end_; p++)
+    {
+      p = static_cast<const char*>(std::memchr(p,tag[0],end_-p));
+      if (p==0 || p+n>end_) break;
+      if (std::memcmp(p,tag,n)==0) return p-begin_;
+    }
+    return std::string::npos;
+  }
+
+  /// Does the line contain only blank characters ?
+  bool IsBlank() const
+  {
+    for (const char* p=begin_; p!=end_; p++)
+      if (*p!=' ' && *p!='\t' && *p!='\r' && *p!='\n' && 
+          *p!='\v' && *p!='\f') return false;
+    return true;
+  }
+
+  /// First word of the line
+  TextLine FirstWord() const
+  {
+    const char* p=begin_;
+    while (p!=end_ && (*p==' ' || *p=='\t' || *p=='\r')) p++;
+    const char* q=p;
+    while (q!=end_ && *q!=' ' && *q!='\t' && *q!='\r') q++;
+    return TextLine(p,q);
+  }
+
+  /// Comparison with a word
+  bool operator==(const char* word) const
+  {
+    std::string::size_type n = std::strlen(word);
+    return n==size() && std::memcmp(begin_,word,n)==0;
+  }
+  bool operator!=(const char* word) const
+  { return !(*this==word); }
+
+};
+
+/// Writing a line in a stream
+inline std::ostream& operator<<(std::ostream& output, const TextLine& line)
+{
+  output.write(line.data(),line.size());
+  return output;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+/// Reading of a text stream by large blocks, handing out the lines as 
+/// slices of the internal buffer. Works with any std::istream (plain 
+/// file or gz_istream).
+//////////////////////////////////////////////////////////////////////////////
+class LineBuffer
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Input stream
+  std::istream* input_;
+
+  /// Block of characters read from the stream
+  std::vector<char> buffer_;
+
+  /// Position of the next line in the buffer, number of read characters
+  std::string::size_type cursor_;
+  std::string::size_type filled_;
+
+  /// Number of characters consumed before the beginning of the buffer
+  Long64_t offset_;
+
+  /// End of the stream reached
+  bool eof_;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor with the size of the blocks
+  LineBuffer(std::string::size_type blocksize=1048576)
+  {
+    buffer_.resize(blocksize);
+    Initialize(0);
+  }
+
+  /// Destructor
+  ~LineBuffer()
+  { }
+
+  /// Attaching a stream (read from its current position, located at the
+  /// given offset in the file)
+  void Initialize(std::istream* input, Long64_t offset=0)
+  {
+    input_=input;
+    cursor_=0; filled_=0; offset_=offset;
+    eof_=false;
+  }
+
+  /// Getting the next line (without the end-of-line character)
+  /// Returns false at the end of the stream
+  bool NextLine(TextLine& line);
+
+  /// Number of characters consumed through the lines
+  Long64_t GetPosition() const
+  { return offset_+cursor_; }
+
+  /// Position in the file of a line extracted from the buffer
+  Long64_t GetPosition(const TextLine& line) const
+  { return offset_+(line.data()-&buffer_[0]); }
+
+  /// Has a line been read ?
+  bool IsUsed() const
+  { return offset_!=0 || filled_!=0; }
+
+ private :
+
+  /// Reading a new block from the stream (keeping the unread characters)
+  bool Fill();
+
+};
+
+}
+
+#endif
@@ -78,6 +78,10 @@ class ROOTReader : public ReaderBase
   /// Finalize
   virtual bool Finalize();
 
+  /// ROOT trees are read in the analysis thread
+  virtual bool AllowsPrefetching() const
+  { return false; }
+
   /// Read the header
   virtual bool ReadHeader(SampleFormat& mySample)
   {
@@ -102,7 +106,11 @@ class ROOTReader : public ReaderBase
 
   /// Finalize the event
   virtual bool FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
-  { return treeReader_->FinalizeEvent(mySample,myEvent); }
+  {
+    if (!treeReader_->FinalizeEvent(mySample,myEvent)) return false;
+    FinalizeParticles(myEvent);
+    return true;
+  }
 
 
   /// Get the file size
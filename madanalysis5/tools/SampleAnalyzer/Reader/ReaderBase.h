@@ -97,6 +97,63 @@ class ReaderBase
   /// Finalize
   virtual bool Finalize()=0;
 
+  /// Can the events be read in a separate thread ?
+  virtual bool AllowsPrefetching() const
+  { return true; }
+
+  /// Number of events in the file (-1 if unknown without reading it)
+  virtual Long64_t GetNumberOfEvents()
+  { return -1; }
+
+  /// Random access: reading only the events first, first+stride, ... 
+  /// before the event last (excluded, 0 = end of file). False is returned 
+  /// by the sequential readers.
+  virtual bool SelectEvents(ULong64_t first, ULong64_t last, ULong64_t stride)
+  { return false; }
+
+  /// Selected events: index in the file of the first one and step between
+  /// two of them (all the events by default)
+  virtual void GetSelection(ULong64_t& first, ULong64_t& stride) const
+  { first=0; stride=1; }
+
+  /// Key of the last event read, which seeds its random stream. It does not
+  /// depend on the selected events nor on the shard. -1 if the reader gives
+  /// no key: the events are then numbered from their selection.
+  virtual Long64_t GetEventKey() const
+  { return -1; }
+
+  /// Sharding: reading only the part index/nshards of the events first,
+  /// first+stride, ... of the file. By default, the selected events are 
+  /// shared when the reader allows random access.
+  virtual bool SelectShard(UInt_t index, UInt_t nshards,
+                           ULong64_t first=0, ULong64_t stride=1)
+  {
+    Long64_t n = GetNumberOfEvents();
+    if (n<0) return false;
+    if (stride==0) stride=1;
+    ULong64_t nevents = static_cast<ULong64_t>(n);
+    ULong64_t nselected = (first<nevents) ? (nevents-first-1)/stride+1 : 0;
+    ULong64_t begin = nselected*index/nshards;
+    ULong64_t end   = nselected*(index+1)/nshards;
+    ULong64_t last  = nevents;
+    if (begin==end) first=nevents;
+    else { last=first+(end-1)*stride+1; first+=begin*stride; }
+    return SelectEvents(first,last,stride);
+  }
+
+  /// Classifying the generated particles, and filling their 
+  /// structure-of-arrays copy when requested by the option --particle_arrays
+  /// (at the end of FinalizeEvent, so that it is done in the prefetching 
+  /// thread). The MET, MHT, TET and THT are computed at the first access,
+  /// unless the option --no_global_sums is used.
+  void FinalizeParticles(EventFormat& myEvent) const
+  {
+    if (myEvent.mc()==0) return;
+    myEvent.mc()->Classify();
+    if (cfg_.IsParticleArrays()) myEvent.mc()->FillArrays();
+    if (cfg_.IsNoGlobalSums()) myEvent.mc()->DisableGlobalSums();
+  }
+
   /// Is the file stored in Rfio ?
   static bool IsRfioMode(const std::string& name)
   {  
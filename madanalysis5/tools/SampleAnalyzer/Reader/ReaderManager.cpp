@@ -30,6 +30,8 @@
 #include "SampleAnalyzer/Reader/STDHEPreader.h"
 #include "SampleAnalyzer/Reader/HEPMCReader.h"
 #include "SampleAnalyzer/Reader/ROOTReader.h"
+#include "SampleAnalyzer/Reader/BinaryEventReader.h"
+#include "SampleAnalyzer/Reader/EventStoreReader.h"
 using namespace MA5;
 
 // -----------------------------------------------------------------------------
@@ -66,6 +68,15 @@ void ReaderManager::BuildTable()
   ROOTReader* root = new ROOTReader();
   Add("root",root);
 
+  BinaryEventReader* ma5bin = new BinaryEventReader();
+  Add("ma5bin",ma5bin);
+#ifdef ZIP_USE
+  Add("ma5bin.gz",ma5bin);
+#endif
+
+  EventStoreReader* ma5store = new EventStoreReader();
+  Add("ma5store",ma5store);
+
 
 }
 
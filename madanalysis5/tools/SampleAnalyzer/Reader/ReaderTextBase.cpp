@@ -119,6 +119,13 @@ bool ReaderTextBase::Initialize(const std::string& rawfilename,
     return false;
   }
 
+  // Lines are extracted from large blocks of the stream
+  buffer_.Initialize(input_);
+  shardEnd_=-1;
+  endOfShard_=false;
+  eventStart_=-1;
+  nextEventStart_=-1;
+
   return test;
 }
 
@@ -150,6 +157,7 @@ bool ReaderTextBase::Finalize()
   }
 
   // Free allocated memory for the file streamer
+  buffer_.Initialize(0);
   if (input_!=0) { delete input_; input_=0; }
 
   // OK!
@@ -160,26 +168,25 @@ bool ReaderTextBase::Finalize()
 // -----------------------------------------------------------------------------
 // ReadLine
 // -----------------------------------------------------------------------------
-bool ReaderTextBase::ReadLine(std::string& line, bool removeComment)
+bool ReaderTextBase::ReadLine(TextLine& line, bool removeComment)
 {
-  bool getnewline=false;
-  while (!getnewline)
+  // The next events belong to another shard
+  if (endOfShard_) return false;
+
+  while (1)
   {
-    // Getting a new line from the file
-    getline(*input_,line,'\n');
-    if (input_->eof() || input_->fail()) return false;
+    // Getting a new line from the buffer
+    if (!buffer_.NextLine(line)) return false;
 
     // Removing possible comments
     if (removeComment)
     {
       std::string::size_type sharp_pos=line.find('#');
-      if (sharp_pos==0) line="";
       if (sharp_pos!=std::string::npos) line.resize(sharp_pos);
     }
 
-    std::stringstream str(line);
-    std::string tmp; str >> tmp;
-    if (tmp!="") getnewline=true; 
+    // Skipping blank lines
+    if (!line.IsBlank()) break;
   }
 
   // Not the end of the file
@@ -187,6 +194,18 @@ bool ReaderTextBase::ReadLine(std::string& line, bool removeComment)
 }
 
 
+// -----------------------------------------------------------------------------
+// ReadLine
+// -----------------------------------------------------------------------------
+bool ReaderTextBase::ReadLine(std::string& line, bool removeComment)
+{
+  TextLine myline;
+  if (!ReadLine(myline,removeComment)) return false;
+  line.assign(myline.data(),myline.size());
+  return true;
+}
+
+
 // -----------------------------------------------------------------------------
 // GetFileSize
 // -----------------------------------------------------------------------------
@@ -210,20 +229,80 @@ Long64_t ReaderTextBase::GetFileSize()
     input_->seekg(0,std::ios::end);
     length = input_->tellg();
     input_->seekg(0,std::ios::beg);
+    buffer_.Initialize(input_);
   }
   return length;  
 }
 
 
 // -----------------------------------------------------------------------------
-// GetFileSize
+// GetFinalPosition
 // -----------------------------------------------------------------------------
 Long64_t ReaderTextBase::GetFinalPosition()
 {
+  if (shardEnd_>=0) return shardEnd_;
   return GetFileSize();
 }
 
 
+// -----------------------------------------------------------------------------
+// SelectShard
+// -----------------------------------------------------------------------------
+bool ReaderTextBase::SelectShard(UInt_t index, UInt_t nshards,
+                                 ULong64_t first, ULong64_t stride)
+{
+  // Only plain files can be read from any position
+  if (!AllowsSharding() || compress_ || rfio_ || input_==0) return false;
+  if (first!=0 || stride>1) return false;
+  if (nshards<2) return true;
+
+  // Byte range of the shard. The events beginning in the header (already 
+  // read) belong to the first shard.
+  Long64_t header = GetPosition();
+  input_->clear();
+  input_->seekg(0,std::ios::end);
+  Long64_t size = input_->tellg();
+  Long64_t begin = size/nshards*index + (size%nshards)*index/nshards;
+  Long64_t end   = size/nshards*(index+1) + (size%nshards)*(index+1)/nshards;
+  if (begin<header) begin=header;
+  if (end<header)   end=header;
+  shardEnd_ = end;
+
+  // First shard: going on from the end of the header
+  if (index==0)
+  {
+    input_->clear();
+    input_->seekg(header,std::ios::beg);
+    buffer_.Initialize(input_,header);
+    return true;
+  }
+
+  // Looking for the first event beginning in the range. The reading starts
+  // one character before the range: the line in progress there belongs to
+  // the previous shard.
+  input_->clear();
+  input_->seekg(begin-1,std::ios::beg);
+  buffer_.Initialize(input_,begin-1);
+
+  // The state left by the header is reset even if the shard contains no 
+  // event
+  TextLine line;
+  if (buffer_.NextLine(line))
+  {
+    while (ReadLine(line))
+    {
+      if (!IsEventStart(line)) continue;
+      if (IsPastShardEnd(line)) break;
+      Resynchronize(line);
+      return true;
+    }
+  }
+  endOfShard_=true;
+  Resynchronize(TextLine());
+  return true;
+}
+
+
 // -----------------------------------------------------------------------------
 // GetPosition
 // -----------------------------------------------------------------------------
@@ -233,5 +312,6 @@ Long64_t ReaderTextBase::GetPosition()
 #ifdef ZIP_USE
   if (compress_) return gzinput_->tellg();
 #endif
+  else if (buffer_.IsUsed()) return buffer_.GetPosition();
   else  return input_->tellg();
 }
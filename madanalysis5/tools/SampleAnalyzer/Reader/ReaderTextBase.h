@@ -34,6 +34,7 @@ class gz_istream;
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/Reader/ReaderBase.h"
+#include "SampleAnalyzer/Reader/LineBuffer.h"
 
 namespace MA5
 {
@@ -55,6 +56,20 @@ class ReaderTextBase : public ReaderBase
   /// Name of the file (without prefix such as file: or rfio:)
   std::string filename_;
 
+  /// Buffer of characters from which the lines are extracted
+  LineBuffer buffer_;
+
+  /// Sharding: position from which the events belong to the next shard
+  /// (-1 if the whole file is read) and end of the shard reached
+  Long64_t shardEnd_;
+  bool endOfShard_;
+
+  /// Position in the file of the first line of the event read, and of the
+  /// first line of the next event when it has already been met (-1 if 
+  /// unknown). The position is the key of the event (see GetEventKey).
+  Long64_t eventStart_;
+  Long64_t nextEventStart_;
+
 
   // -------------------------------------------------------------
   //                       method members
@@ -64,7 +79,8 @@ class ReaderTextBase : public ReaderBase
   /// Constructor without argument
   ReaderTextBase()
   {
-    input_=0;
+    input_=0; shardEnd_=-1; endOfShard_=false;
+    eventStart_=-1; nextEventStart_=-1;
   }
 
 	/// Destructor
@@ -92,9 +108,18 @@ class ReaderTextBase : public ReaderBase
   /// Finalize
   virtual bool Finalize();
 
-  /// Read line text
+  /// Read line text (slice of the internal buffer, valid until next read)
+  bool ReadLine(TextLine& line, bool removeComment=true);
+
+  /// Read line text (copy)
   bool ReadLine(std::string& line, bool removeComment=true);
 
+  /// Sharding: reading only the events beginning in the byte range 
+  /// [index*size/nshards, (index+1)*size/nshards[ of the file. The events
+  /// cannot be selected by first/stride: false is returned in this case.
+  virtual bool SelectShard(UInt_t index, UInt_t nshards,
+                           ULong64_t first=0, ULong64_t stride=1);
+
   /// Get the file size (in octet)
   virtual Long64_t GetFileSize();
 
@@ -104,6 +129,36 @@ class ReaderTextBase : public ReaderBase
   /// Get the position in file
   virtual Long64_t GetPosition();
 
+  /// Key of the last event read: the position of its first line in the 
+  /// file, when the reader records it (-1 otherwise)
+  virtual Long64_t GetEventKey() const
+  { return eventStart_; }
+
+ protected:
+
+  /// Can the file be split into byte ranges ? (the derived class must 
+  /// implement IsEventStart and Resynchronize)
+  virtual bool AllowsSharding() const
+  { return false; }
+
+  /// Is the line the first line of an event ?
+  virtual bool IsEventStart(const TextLine& line) const
+  { return false; }
+
+  /// Restarting the reading from the first line of an event
+  /// (empty line if the shard contains no event)
+  virtual void Resynchronize(const TextLine& line)
+  { }
+
+  /// Does the event beginning with this line belong to the next shard ?
+  /// If so, no more line is read.
+  bool IsPastShardEnd(const TextLine& line)
+  {
+    if (shardEnd_<0 || buffer_.GetPosition(line)<shardEnd_) return false;
+    endOfShard_=true;
+    return true;
+  }
+
 };
 
 }
@@ -697,20 +697,6 @@ bool STDHEPreader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
   // Mother pointer assignment
   for (unsigned int i=0; i<myEvent.mc()->particles_.size();i++)
   {
-    MCParticleFormat& part = myEvent.mc()->particles_[i];
-
-    // MET, MHT, TET, THT
-    if (part.statuscode()==1 && !PHYSICS->Id->IsInvisible(part))
-    {
-      myEvent.mc()->MET_ -= part.momentum();
-      myEvent.mc()->TET_ += part.pt();
-      if (PHYSICS->Id->IsHadronic(part))
-      {
-        myEvent.mc()->MHT_ -= part.momentum();
-        myEvent.mc()->THT_ += part.pt(); 
-      }
-    }
-
     unsigned int index1=myEvent.mc()->particles_[i].mothup1_;
     unsigned int index2=myEvent.mc()->particles_[i].mothup2_;
     if (index1!=0 && index2==0) index2=index1;
@@ -728,7 +714,7 @@ bool STDHEPreader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
       else
       {
         myEvent.mc()->particles_[i].mother1_ = &myEvent.mc()->particles_[index1-1];
-        myEvent.mc()->particles_[index1-1].daughters_.push_back(&myEvent.mc()->particles_[i]);
+        myEvent.mc()->decays_.AddEdge(index1-1,i);
       }
     }
     if (index2!=0)
@@ -745,16 +731,16 @@ bool STDHEPreader::FinalizeEvent(SampleFormat& mySample, EventFormat& myEvent)
       else
       {
         myEvent.mc()->particles_[i].mother2_ = &myEvent.mc()->particles_[index2-1];
-        myEvent.mc()->particles_[index2-1].daughters_.push_back(&myEvent.mc()->particles_[i]);
+        myEvent.mc()->decays_.AddEdge(index2-1,i);
       }
     }
   }
 
-  // Finalize event
-  myEvent.mc()->MET_.momentum().SetPz(0.);
-  myEvent.mc()->MET_.momentum().SetE(myEvent.mc()->MET_.momentum().Pt());
-  myEvent.mc()->MHT_.momentum().SetPz(0.);
-  myEvent.mc()->MHT_.momentum().SetE(myEvent.mc()->MHT_.momentum().Pt());
+  // Decay graph
+  myEvent.mc()->decays_.Build(myEvent.mc()->particles_);
+
+  // Classification and structure-of-arrays copy of the particles
+  FinalizeParticles(myEvent);
 
   // Normal end
   return true;
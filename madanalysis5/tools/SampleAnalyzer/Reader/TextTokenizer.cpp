@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/TextTokenizer.h"
+
+using namespace MA5;
+
+
+/// Powers of ten exactly representable as a double
+static const Double_t ExactPowersOfTen[] =
+  { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+
+// -----------------------------------------------------------------------------
+// NextReal
+// -----------------------------------------------------------------------------
+bool TextTokenizer::NextReal(Double_t& value)
+{
+  SkipBlanks();
+  const char* p = cursor_;
+
+  // Sign
+  bool negative = false;
+  if (p!=end_ && (*p=='-' || *p=='+')) { negative=(*p=='-'); p++; }
+
+  // Mantissa: at most 19 significant digits in an integer
+  ULong64_t mantissa = 0;
+  Int_t     ndigits  = 0;
+  Int_t     exponent = 0;
+  bool      digits   = false;
+  while (p!=end_ && *p>='0' && *p<='9')
+  {
+    digits=true;
+    if (mantissa!=0 || *p!='0') { mantissa = 10*mantissa + (*p-'0'); ndigits++; }
+    p++;
+  }
+  if (p!=end_ && *p=='.')
+  {
+    p++;
+    while (p!=end_ && *p>='0' && *p<='9')
+    {
+      digits=true;
+      if (mantissa!=0 || *p!='0') { mantissa = 10*mantissa + (*p-'0'); ndigits++; }
+      exponent--;
+      p++;
+    }
+  }
+  if (!digits) return NextRealSlow(value);
+
+  // Exponent, in C or Fortran notation
+  if (p!=end_ && (*p=='e' || *p=='E' || *p=='d' || *p=='D'))
+  {
+    p++;
+    bool negexp = false;
+    if (p!=end_ && (*p=='-' || *p=='+')) { negexp=(*p=='-'); p++; }
+    if (p==end_ || *p<'0' || *p>'9') return NextRealSlow(value);
+    Int_t exp = 0;
+    while (p!=end_ && *p>='0' && *p<='9')
+    { if (exp<10000) exp = 10*exp + (*p-'0'); p++; }
+    exponent += negexp ? -exp : exp;
+  }
+  if (p!=end_ && !IsBlank(*p)) return NextRealSlow(value);
+
+  // Exact computation only when the mantissa and the power of ten are both
+  // exactly representable; other cases are delegated to strtod
+  if (ndigits>19 || mantissa>(static_cast<ULong64_t>(1)<<53) || exponent<-22 || exponent>22)
+    return NextRealSlow(value);
+  Double_t result = static_cast<Double_t>(mantissa);
+  if (exponent<0) result /= ExactPowersOfTen[-exponent];
+  else result *= ExactPowersOfTen[exponent];
+
+  cursor_ = p;
+  value = negative ? -result : result;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// NextRealSlow
+// -----------------------------------------------------------------------------
+bool TextTokenizer::NextRealSlow(Double_t& value)
+{
+  // Copying the field with C exponent
+  TextLine word;
+  const char* begin = cursor_;
+  if (!NextWord(word)) return false;
+  std::string tmp = word.str();
+  for (unsigned int i=0;i<tmp.size();i++)
+    if (tmp[i]=='d' || tmp[i]=='D') tmp[i]='E';
+
+  // Conversion
+  char* last = 0;
+  Double_t result = std::strtod(tmp.c_str(),&last);
+  if (last==tmp.c_str()) { cursor_=begin; return false; }
+  value = result;
+  return true;
+}
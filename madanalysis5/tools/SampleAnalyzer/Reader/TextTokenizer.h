@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TEXT_TOKENIZER_H
+#define TEXT_TOKENIZER_H
+
+// STL headers
+#include <string>
+#include <cstdlib>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Reader/LineBuffer.h"
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Splitting of a text line in blank-separated fields, with conversion of
+/// the fields to numbers without any stream or memory allocation.
+/// Floating-point fields may use a Fortran exponent (1.5D+02 or 1.5d+02).
+/// When a field cannot be converted, the output value is left unchanged
+/// and false is returned (as with std::istream).
+//////////////////////////////////////////////////////////////////////////////
+class TextTokenizer
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Current position and end of the line
+  const char* cursor_;
+  const char* end_;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor with the line to split
+  TextTokenizer(const TextLine& line)
+  { cursor_=line.data(); end_=line.data()+line.size(); }
+
+  /// Is there another field ?
+  bool HasNext()
+  { SkipBlanks(); return cursor_!=end_; }
+
+  /// Getting the next field as a word
+  bool NextWord(TextLine& word)
+  {
+    SkipBlanks();
+    if (cursor_==end_) return false;
+    const char* begin = cursor_;
+    while (cursor_!=end_ && !IsBlank(*cursor_)) cursor_++;
+    word = TextLine(begin,cursor_);
+    return true;
+  }
+
+  /// Skipping the next field
+  bool Skip()
+  { TextLine word; return NextWord(word); }
+
+  /// Getting the next field as a number
+  bool Next(Int_t& value)
+  { return NextInteger(value); }
+  bool Next(UInt_t& value)
+  { return NextInteger(value); }
+  bool Next(Short_t& value)
+  { return NextInteger(value); }
+  bool Next(Long64_t& value)
+  { return NextInteger(value); }
+  bool Next(Double_t& value)
+  { return NextReal(value); }
+  bool Next(Float_t& value)
+  {
+    Double_t tmp;
+    if (!NextReal(tmp)) return false;
+    value = static_cast<Float_t>(tmp);
+    return true;
+  }
+
+ private :
+
+  /// Is the character a field separator ?
+  static bool IsBlank(char c)
+  { return c==' ' || c=='\t' || c=='\r' || c=='\n' || c=='\v' || c=='\f'; }
+
+  /// Moving the cursor to the beginning of the next field
+  void SkipBlanks()
+  { while (cursor_!=end_ && IsBlank(*cursor_)) cursor_++; }
+
+  /// Conversion of an integer field
+  template<typename T> bool NextInteger(T& value)
+  {
+    SkipBlanks();
+    const char* p = cursor_;
+    bool negative = false;
+    if (p!=end_ && (*p=='-' || *p=='+')) { negative=(*p=='-'); p++; }
+    if (p==end_ || *p<'0' || *p>'9') return false;
+    Long64_t result = 0;
+    while (p!=end_ && *p>='0' && *p<='9') { result = 10*result + (*p-'0'); p++; }
+    if (p!=end_ && !IsBlank(*p)) return false;
+    cursor_ = p;
+    value = static_cast<T>(negative ? -result : result);
+    return true;
+  }
+
+  /// Conversion of a floating-point field
+  bool NextReal(Double_t& value);
+
+  /// Conversion of a field the fast path does not handle (via strtod)
+  bool NextRealSlow(Double_t& value);
+
+};
+
+}
+
+#endif
@@ -100,6 +100,18 @@ class RegionSelection
   void AddCut(std::string const &CutName)
     { cutflow_.InitCut(CutName); }
 
+  /// Adding the cutflow of another instance of this region
+  bool Merge(const RegionSelection& other)
+    { return cutflow_.Merge(other.cutflow_); }
+
+  /// Dumping the cutflow in a binary stream
+  void Write_BinaryFormat(std::ostream& output) const
+    { cutflow_.Write_BinaryFormat(output); }
+
+  /// Restoring the cutflow from a binary stream
+  bool Read_BinaryFormat(std::istream& input)
+    { return cutflow_.Read_BinaryFormat(input); }
+
   /// Getting ready for a new event
   void InitializeForNewEvent(const double &weight)
   {
@@ -125,3 +125,54 @@ void RegionSelectionManager::WriteHistoDefinition(SAFWriter& output)
 }
 
 
+/// Adding the cutflows and histograms of another manager
+bool RegionSelectionManager::Merge(const RegionSelectionManager& other)
+{
+  // Safety: the two managers must describe the same regions
+  if (regions_.size()!=other.regions_.size())
+  {
+    ERROR << "region selection managers with different numbers of regions "
+          << "cannot be merged" << endmsg;
+    return false;
+  }
+
+  // Merging the cutflows region by region
+  bool ok=true;
+  for (unsigned int i=0; i<regions_.size(); i++)
+    if (!regions_[i]->Merge(*other.regions_[i])) ok=false;
+
+  // Merging the histograms
+  if (!plotmanager_.Merge(other.plotmanager_)) ok=false;
+  return ok;
+}
+
+
+/// Dumping the cutflows and histograms in a binary stream
+void RegionSelectionManager::Write_BinaryFormat(std::ostream& output) const
+{
+  UInt_t nregions = regions_.size();
+  BinaryStream::Write(output, nregions);
+  for (unsigned int i=0; i<regions_.size(); i++)
+    regions_[i]->Write_BinaryFormat(output);
+  plotmanager_.Write_BinaryFormat(output);
+}
+
+
+/// Restoring the cutflows and histograms from a binary stream
+bool RegionSelectionManager::Read_BinaryFormat(std::istream& input)
+{
+  // Safety: the stream must describe the same regions
+  UInt_t nregions = 0;
+  if (!BinaryStream::Read(input, nregions)) return false;
+  if (nregions!=regions_.size())
+  {
+    ERROR << "the stored results do not have the expected number of "
+          << "regions" << endmsg;
+    return false;
+  }
+
+  // Reading the cutflows and the histograms
+  for (unsigned int i=0; i<regions_.size(); i++)
+    if (!regions_[i]->Read_BinaryFormat(input)) return false;
+  return plotmanager_.Read_BinaryFormat(input);
+}
@@ -251,6 +251,15 @@ class RegionSelectionManager
   /// Writing the definition saf file
   void WriteHistoDefinition(SAFWriter& output);
 
+  /// Adding the cutflows and histograms of another manager
+  bool Merge(const RegionSelectionManager& other);
+
+  /// Dumping the cutflows and histograms in a binary stream
+  void Write_BinaryFormat(std::ostream& output) const;
+
+  /// Restoring the cutflows and histograms from a binary stream
+  bool Read_BinaryFormat(std::istream& input);
+
   /// Checking if a given RS is surviging
   bool IsSurviving(const std::string &RSname)
   {
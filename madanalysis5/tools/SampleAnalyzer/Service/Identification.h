@@ -28,6 +28,7 @@
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/Service/MCconfig.h"
+#include "SampleAnalyzer/Service/PDGService.h"
 #include "SampleAnalyzer/DataFormat/MCEventFormat.h"
 
 
@@ -66,15 +67,23 @@ class Identification
     RECconfig& recConfig()
     { return recConfig_; }
 
+  // The particles classified by the reader (MCParticleClasses) carry 
+  // their answers as bits: the status codes are only compared for the 
+  // particles which are not classified.
+
   /// Is Initial State
   Bool_t IsInitialState(const MCParticleFormat& part) const
   {
+    if (part.IsClassified()) 
+      return (part.classes() & MCParticleFormat::INITIAL_STATE)!=0;
     return (part.statuscode()==-1 || (part.statuscode()>=11 && part.statuscode()<=19));
   }
 
   /// Is Final State
   Bool_t IsFinalState(const MCParticleFormat& part) const
   {
+    if (part.IsClassified()) 
+      return (part.classes() & MCParticleFormat::FINAL_STATE)!=0;
     return (part.statuscode()==finalstate_);
   }
 
@@ -87,22 +96,28 @@ class Identification
   /// Is Initial State
   Bool_t IsInitialState(const MCParticleFormat* part) const
   {
+    if (part->IsClassified()) 
+      return (part->classes() & MCParticleFormat::FIRST_STATUS)!=0;
     return (part->statuscode()==initialstate_);
   }
 
   /// Is Final State
   Bool_t IsFinalState(const MCParticleFormat* part) const
   {
-    return (part->statuscode()==finalstate_);
+    return IsFinalState(*part);
   }
 
   /// Is Inter State
   Bool_t IsInterState(const MCParticleFormat* part) const
   {
+    if (part->IsClassified()) 
+      return (part->classes() & (MCParticleFormat::FINAL_STATE |
+                                 MCParticleFormat::FIRST_STATUS))==0;
     return (part->statuscode()!=finalstate_ && part->statuscode()!=initialstate_);
   }
 
-  /// Set Initial State
+  /// Set Initial State (status code of the unclassified particles; not to
+  /// be called by the threads of the event loop, which share the service)
   void SetInitialState(const MCEventFormat* myEvent)
   {
     if (myEvent==0) return; 
@@ -110,7 +125,7 @@ class Identification
     initialstate_=myEvent->particles()[0].statuscode(); 
   }
 
-  /// Set Final State
+  /// Set Final State (same remark)
   void SetFinalState(const MCEventFormat* myEvent)
   {
     if (myEvent==0) return; 
@@ -146,15 +161,15 @@ class Identification
   /// Is hadronic ?
   inline bool IsHadronic(const MCParticleFormat& part) const
   {
-    std::set<Int_t>::iterator found = mcConfig_.hadronic_ids_.find(part.pdgid());
-    if (found==mcConfig_.hadronic_ids_.end()) return false; else return true;
+    if (part.IsClassified()) 
+      return (part.classes() & MCParticleFormat::HADRONIC)!=0;
+    return IsHadronic(part.pdgid());
   }
 
   /// Is hadronic ?
   inline bool IsHadronic(Int_t pdgid) const
   {
-    std::set<Int_t>::iterator found = mcConfig_.hadronic_ids_.find(pdgid);
-    if (found==mcConfig_.hadronic_ids_.end()) return false; else return true;
+    return PDG->Properties().Is(pdgid,PdgPropertyTable::HADRONIC);
   }
 
   /// Is hadronic ?
@@ -167,8 +182,9 @@ class Identification
   /// Is invisible ?
   inline bool IsInvisible(const MCParticleFormat& part) const
   {
-    std::set<Int_t>::iterator found = mcConfig_.invisible_ids_.find(part.pdgid());
-    if (found==mcConfig_.invisible_ids_.end()) return false; else return true;
+    if (part.IsClassified()) 
+      return (part.classes() & MCParticleFormat::INVISIBLE)!=0;
+    return PDG->Properties().Is(part.pdgid(),PdgPropertyTable::INVISIBLE);
   }
 
   /// Is invisible ?
@@ -181,12 +197,7 @@ class Identification
   ///Is B Hadron ?
   Bool_t IsBHadron(Int_t pdg)
   {
-    UInt_t apdg = std::abs(pdg);
-    Bool_t btag;
-    return btag = ( (apdg >=500 && apdg <= 599) ||
-                    (apdg>=5000 && apdg <= 5999) ||
-                    (apdg>=10500 && apdg <= 10599 ) ||
-                    ( apdg>=20500 && apdg <=20599 ) );
+    return PDG->Properties().Is(pdg,PdgPropertyTable::BHADRON);
   }
 
   ///Is B Hadron ?
@@ -205,12 +216,7 @@ class Identification
   ///Is C Hadron ?
   Bool_t IsCHadron(Int_t pdg)
   {
-    UInt_t apdg = std::abs(pdg);
-    Bool_t ctag;
-    return ctag = ( (apdg >=400 && apdg <= 499) ||
-                    (apdg>=4000 && apdg <= 4999) ||
-                    (apdg>=10400 && apdg <= 10499 ) ||
-                    ( apdg>=20400 && apdg <=20499 ) );
+    return PDG->Properties().Is(pdg,PdgPropertyTable::CHADRON);
   }
 
   ///Is C Hadron ?
@@ -29,31 +29,57 @@ using namespace MA5;
 
 /// Initializing the static member 
 LoopService* LoopService::Service_ = 0;
-const UInt_t LoopService::NcallThreshold_ = 100000;
 
 
-// -----------------------------------------------------------------------------
-// IrrelevantPhoton
-// -----------------------------------------------------------------------------
-Bool_t LoopService::IrrelevantPhoton_core(const MCParticleFormat* part, 
-                                          const SampleFormat& mySample)
+namespace
 {
-  // Safety
-  if (ReachThreshold()) return false;
 
-  // Reach the initial State ? -> end
-  if (part->mother1()==0) return false;
+/// Flags used during the classification
+enum { HADRON_DONE=4, TAU_DONE=8, VISITED=16 };
+
+/// Rule deciding the answer when reaching a mother: 1 (true), 0 (false) 
+/// or -1 if the answer is given by the mother itself
+typedef Int_t (*AncestryRule)(const MCDecayGraph& graph, UInt_t mother,
+                              bool herwig);
+
+/// Patch for Herwig: clusters and hadronization 
+Bool_t IsHerwigCluster(const MCParticleFormat& mum)
+{
+  return mum.statuscode()==103 || 
+         mum.statuscode()==110 ||
+         mum.statuscode()==120;
+}
+
+/// Rule for a particle coming from a hadron decay
+Int_t HadronRule(const MCDecayGraph& graph, UInt_t mother, bool herwig)
+{
+  const MCParticleFormat& mum = graph.particles()[mother];
 
   // Patch for Herwig
-  if (mySample.sampleGenerator()==MA5GEN::HERWIG6) 
-    if (part->mother1()->statuscode()==103 || 
-        part->mother1()->statuscode()==110 ||
-        part->mother1()->statuscode()==120) return false;
+  if (herwig && IsHerwigCluster(mum)) return 0;
 
-  // Checking mother
-  UInt_t absid = std::abs(part->mother1()->pdgid());
+  // Checking if mother is hadron
+  Bool_t had = PHYSICS->Id->IsHadronic(mum.pdgid()) && mum.pdgid()!=21;
+
+  // First case : initial parton
+  if (had && graph.mother1(mother)<0) return 0;
+
+  // Second case: hadron
+  else if (had) return 1;
+
+  return -1;
+}
+
+/// Rule for a particle coming from a tau decay
+Int_t TauRule(const MCDecayGraph& graph, UInt_t mother, bool herwig)
+{
+  const MCParticleFormat& mum = graph.particles()[mother];
 
-  if (absid==15) return true;
+  // Patch for Herwig
+  if (herwig && IsHerwigCluster(mum)) return 0;
+
+  // Checking mother
+  if (std::abs(mum.pdgid())==15) return 1;
 
   // BENJ: this is special for HERWIG
   /*  else if(part->mother1()->mother1()!=0)
@@ -63,44 +89,78 @@ Bool_t LoopService::IrrelevantPhoton_core(const MCParticleFormat* part,
       }*/
   // BENJ: end of herwig fix
 
-  else return IrrelevantPhoton_core(part->mother1(),mySample);
+  return -1;
+}
 
-  // Default
-  return false;
+/// Classifying all the particles with a rule. The first mothers are 
+/// followed until the rule gives an answer, a particle already classified 
+/// or a loop is reached; all the particles of the walk share the answer, 
+/// so that each chain is walked once per event.
+void Classify(const MCDecayGraph& graph, UChar_t* flags, AncestryRule rule,
+              bool herwig, bool orphan, UChar_t bit, UChar_t done)
+{
+  for (UInt_t i=0;i<graph.size();i++)
+  {
+    if ((flags[i] & done)!=0) continue;
+
+    // Walking up
+    bool result = false;
+    UInt_t nsteps = 0;
+    UInt_t index = i;
+    while (true)
+    {
+      flags[index] |= VISITED;
+      nsteps++;
+
+      // Reach the initial state ? -> end
+      Int_t mother = graph.mother1(index);
+      if (mother<0) { result=orphan; break; }
+
+      // Checking the mother
+      Int_t decision = rule(graph,mother,herwig);
+      if (decision>=0) { result=(decision==1); break; }
+
+      // Mother already classified
+      if ((flags[mother] & done)!=0) { result=((flags[mother] & bit)!=0); break; }
+
+      // Infinite loop
+      if ((flags[mother] & VISITED)!=0) 
+      {
+        WARNING << "loop detected in the mother-daughter relations" << endmsg;
+        result=false;
+        break;
+      }
+
+      index = mother;
+    }
+
+    // Storing the answer
+    index = i;
+    for (UInt_t k=0;k<nsteps;k++)
+    {
+      flags[index] = static_cast<UChar_t>((flags[index] & ~VISITED) | done);
+      if (result) flags[index] |= bit;
+      index = graph.mother1(index);
+    }
+  }
 }
 
+}
 
 
 // -----------------------------------------------------------------------------
-// ComingFromHadronDecay
+// ComputeAncestry
 // -----------------------------------------------------------------------------
-Bool_t LoopService::ComingFromHadronDecay_core(const MCParticleFormat* part, 
-                                                const SampleFormat& mySample)
+const UChar_t* LoopService::ComputeAncestry(const MCDecayGraph& graph,
+                                            const SampleFormat& mySample)
 {
-  // Safety
-  if (ReachThreshold()) return false;
-
-  // Weird case ? Safety: removing this case
-  if (part->mother1()==0) return true;
-  //  std::cout << "part id=" << part->pdgid() << "\tstatus=" << part->statuscode() << "\tmother=" << part->mother1()->pdgid() << std::endl;
-
-  // Patch for Herwig
-  if (mySample.sampleGenerator()==MA5GEN::HERWIG6)
-    if (part->mother1()->statuscode()==103 || 
-        part->mother1()->statuscode()==110 ||
-        part->mother1()->statuscode()==120) return false;
-
-  // Weird case
-  //  if (part->mother1()==part) { std::cout << "exit" << std::endl; exit(0); }
-
-  // Checking if mother is hadron
-  Bool_t had = PHYSICS->Id->IsHadronic(part->mother1()->pdgid()) && part->mother1()->pdgid()!=21;
-
-  // First case : initial parton
-  if (had && part->mother1()->mother1()==0) return false;
-
-  // Second case: hadron
-  else if (had) return true;
-
-  else return ComingFromHadronDecay(part->mother1(),mySample);
+  UChar_t* flags = graph.SetAncestry(mySample.sampleGenerator());
+  if (flags==0) return 0;
+  bool herwig = (mySample.sampleGenerator()==MA5GEN::HERWIG6);
+
+  // A particle without mother is considered as coming from a hadron decay
+  // (weird case, removed by the safety) and not coming from a tau
+  Classify(graph, flags, HadronRule, herwig, true,  FROM_HADRON, HADRON_DONE);
+  Classify(graph, flags, TauRule,    herwig, false, FROM_TAU,    TAU_DONE);
+  return flags;
 }
@@ -46,8 +46,10 @@ namespace MA5
 {
 
 //////////////////////////////////////////////////////////////////////////////
-/// The class LoopService contains static methods used for converting
-/// all types into string type.
+/// The class LoopService classifies the generated particles according to
+/// their ancestry (coming from a hadron decay, from a tau decay). The whole
+/// event is classified at the first request, in a single pass over the 
+/// decay graph, and the answers are cached in the graph.
 ///
 /// LoopService is a singleton-pattern-based class : only one instance.
 /// Getting the only one instance : LoopService::GetInstance()
@@ -62,11 +64,10 @@ class LoopService
   /// Pointer to the unique instance of LoopService
   static LoopService* Service_;
 
-  /// Threshold to the number of calls
-  static const UInt_t NcallThreshold_;
+ public :
 
-  /// Current number of calls
-  UInt_t Ncalls_;
+  /// Ancestry flags of a particle
+  enum { FROM_HADRON=1, FROM_TAU=2 };
 
   // -------------------------------------------------------------
   //                       method members
@@ -81,10 +82,6 @@ class LoopService
   ~LoopService()
   {}
 
-  /// (Re)initialzing the streamer
-  void Initialize()
-  { Ncalls_=0; }
-
  public:
 
   /// Getting the unique instance of LoopService
@@ -101,47 +98,43 @@ class LoopService
     Service_=0;
   }
 
-  /// Determing if a photon coming from signal
+  /// Determing if a photon coming from signal (i.e. from a tau)
   Bool_t IrrelevantPhoton(const MCParticleFormat* part, 
                           const SampleFormat& mySample)
   {
-    Ncalls_=0;
-    return IrrelevantPhoton_core(part,mySample);
+    const UChar_t* flags = GetAncestry(part,mySample);
+    if (flags==0) return false;
+    return (flags[part->index()] & FROM_TAU)!=0;
   }
 
   /// Determing if a particle coming from hadron decay
   Bool_t ComingFromHadronDecay(const MCParticleFormat* part, 
                                const SampleFormat& mySample)
   {
-    Ncalls_=0;
-    return ComingFromHadronDecay_core(part,mySample);
+    const UChar_t* flags = GetAncestry(part,mySample);
+    if (flags==0) return true;
+    return (flags[part->index()] & FROM_HADRON)!=0;
   }
 
+  /// Ancestry flags of all the particles of the event of a particle (0 if
+  /// the decay graph of the event is not built). They are computed at the
+  /// first call for an event and cached in the decay graph.
+  const UChar_t* GetAncestry(const MCParticleFormat* part, 
+                             const SampleFormat& mySample)
+  {
+    const MCDecayGraph* graph = part->decayGraph();
+    if (graph==0) return 0;
+    const UChar_t* flags = graph->ancestry(mySample.sampleGenerator());
+    if (flags==0) flags = ComputeAncestry(*graph,mySample);
+    return flags;
+  }
 
- private:
-
-  /// Determing if a photon coming from signal
-  Bool_t IrrelevantPhoton_core(const MCParticleFormat* part, 
-                               const SampleFormat& mySample);
 
-  /// Determing if a particle coming from hadron decay
-  Bool_t ComingFromHadronDecay_core(const MCParticleFormat* part, 
-                                    const SampleFormat& mySample);
+ private:
 
-  /// Threshold
-  Bool_t ReachThreshold()
-  {
-    if (Ncalls_ > NcallThreshold_)
-    {
-      WARNING << "Number of calls exceed: infinite loops detected" << endmsg;
-      return true;
-    }
-    else
-    {
-      Ncalls_++;
-      return false;
-    }
-  }
+  /// Computing the ancestry flags of all the particles of an event
+  static const UChar_t* ComputeAncestry(const MCDecayGraph& graph,
+                                        const SampleFormat& mySample);
 
 };
 
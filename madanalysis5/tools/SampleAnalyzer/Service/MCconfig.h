@@ -29,6 +29,9 @@
 #include <set>
 #include <string>
 
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Service/PDGService.h"
+
 // ROOT headers
 #include "TRint.h"
 
@@ -71,18 +74,22 @@ struct MCconfig
   {
     invisible_ids_.clear();
     hadronic_ids_.clear();
+    PDG->Properties().ClearFlags(PdgPropertyTable::HADRONIC |
+                                 PdgPropertyTable::INVISIBLE);
   } 
 
-  /// Add hadronic id
+  /// Add hadronic id (also flagged in the PDG property table)
   void AddHadronicId(Int_t id)
   {
     hadronic_ids_.insert(id);
+    PDG->Properties().SetFlags(id,PdgPropertyTable::HADRONIC);
   } 
 
-  /// Add invisible id
+  /// Add invisible id (also flagged in the PDG property table)
   void AddInvisibleId(Int_t id)
   {
     invisible_ids_.insert(id);
+    PDG->Properties().SetFlags(id,PdgPropertyTable::INVISIBLE);
   } 
 
 };
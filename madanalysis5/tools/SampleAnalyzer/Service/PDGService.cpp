@@ -22,7 +22,91 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
+// STL headers
+#include <fstream>
+#include <sstream>
+
+// SampleAnalyzer headers
 #include "SampleAnalyzer/Service/PDGService.h"
+#include "SampleAnalyzer/DataFormat/PdgPropertyData.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
 using namespace MA5;
 
 PDGService* PDGService::service_ = 0;
+
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+PDGService::PDGService()
+{
+  Table_ = new PdgTable;
+  for (UInt_t i=0;i<PdgPropertyDataSize;i++)
+  {
+    const PdgRecord& record = PdgPropertyData[i];
+    PdgDataFormat particle(record.pdgid,record.name,record.mass,
+                           record.charge,record.width,record.ctau/1000.);
+    Table_->Insert(record.pdgid,particle);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// LoadTable
+// -----------------------------------------------------------------------------
+bool PDGService::LoadTable(const std::string& filename)
+{
+  std::ifstream table(filename.c_str());
+  if (!table.good()) 
+  {
+    ERROR << "impossible to open the particle table '" << filename << "'" 
+          << endmsg;
+    return false;
+  }
+
+  std::string temp_string;
+  std::istringstream curstring;
+
+  // first three lines of the file are useless
+  getline(table,temp_string);
+  getline(table,temp_string);
+  getline(table,temp_string);
+
+  UInt_t n=0;
+  while (getline(table,temp_string)) 
+  {
+    curstring.clear(); // needed when using several times istringstream::str(string)
+    curstring.str(temp_string);
+    Int_t ID;
+    std::string name;
+    Int_t charge;
+    Float_t mass; 
+    Float_t width; 
+    Double_t lifetime;
+
+    // ID name   chg       mass    total width   lifetime
+    //  1 d      -1      0.33000     0.00000   0.00000E+00
+    //  in the table, the charge is in units of e+/3
+    //  the total width is in GeV
+    //  the lifetime is ctau in mm
+
+    curstring >> ID >> name >> charge >> mass >> width >> lifetime;
+    if (curstring.fail())
+    {
+      if (temp_string.find_first_not_of(" \t\r")==std::string::npos) continue;
+      WARNING << "the line '" << temp_string << "' of the particle table '"
+              << filename << "' is skipped" << endmsg;
+      continue;
+    }
+
+    PdgDataFormat particle(ID,name,mass,charge,width,lifetime/1000.);
+    Table_->Insert(ID,particle);
+    Properties_.SetCharge(ID,charge);
+    n++;
+  }
+
+  INFO << "        -> " << n << " particles read from '" << filename << "'" 
+       << endmsg;
+  return true;
+}
@@ -26,14 +26,11 @@
 #define PDGSERVICE_h
 
 // STL headers
-#include <set>
 #include <string>
-#include <iostream>
-#include <fstream>
-#include <cstdlib>
 
 // SampleAnalyzer headers
 #include "SampleAnalyzer/DataFormat/PdgTable.h"
+#include "SampleAnalyzer/DataFormat/PdgPropertyTable.h"
 #include "SampleAnalyzer/DataFormat/MCParticleFormat.h"
 
 #define PDG PDGService::GetInstance()
@@ -50,7 +47,7 @@ class PDGService
  protected:
 
   PdgTable* Table_;  
-  std::set<Int_t> NeutralTable_;  
+  PdgPropertyTable Properties_;
   static PDGService* service_;
 
   // -------------------------------------------------------------
@@ -72,12 +69,16 @@ class PDGService
     service_=0;
   }
 
+  /// Compact table of the particle properties
+  const PdgPropertyTable& Properties() const
+  { return Properties_; }
+  PdgPropertyTable& Properties()
+  { return Properties_; }
+
   /// Is charged ?
-  Bool_t IsCharged (Int_t pdgid)
+  Bool_t IsCharged (Int_t pdgid) const
   {
-    std::set<Int_t>::const_iterator it = NeutralTable_.find(pdgid);
-    if(it==NeutralTable_.end()) return true;
-    else return false; 
+    return Properties_.Is(pdgid,PdgPropertyTable::CHARGED);
   }
 
   /// Get charge
@@ -99,58 +100,15 @@ class PDGService
     return GetCharge(part->pdgid());
   }
 
+  /// Overriding the embedded particle table with a file in the format of
+  /// particle.tbl (the particles of the file are added or replaced)
+  bool LoadTable(const std::string& filename);
+
  private:
 
-  /// Constructor
-  PDGService()  
-  {
-    Table_ = new PdgTable;
-    NeutralTable_.clear();
-
-
-    std::string temp_string;
-    std::istringstream curstring;
-
-    std::string ma5dir = std::getenv("MA5_BASE");
-    std::ifstream table ((ma5dir+"/tools/SampleAnalyzer/particle.tbl").c_str());
-
-    if(!table.good()) 
-    {
-      //ERROR <<"PDG Table not found! exit." << endmsg;
-      //exit(1);
-      return;
-    }
-
-    // first three lines of the file are useless
-    getline(table,temp_string);
-    getline(table,temp_string);
-    getline(table,temp_string);
-
-    while (getline(table,temp_string)) 
-    {
-      curstring.clear(); // needed when using several times istringstream::str(string)
-      curstring.str(temp_string);
-      Int_t ID;
-      std::string name;
-      Int_t charge;
-      Float_t mass; 
-      Float_t width; 
-      Float_t lifetime;
-
-      // ID name   chg       mass    total width   lifetime
-      //  1 d      -1      0.33000     0.00000   0.00000E+00
-      //  in the table, the charge is in units of e+/3
-      //  the total width is in GeV
-      //  the lifetime is ctau in mm
-
-      curstring >> ID >> name >> charge >> mass >> width >> lifetime;
-
-      PdgDataFormat particle(ID,name,mass,charge,width,lifetime/1000.);
-
-      Table_->Insert(ID,particle);
-      if (charge==0) NeutralTable_.insert(ID);
-    }
-  }
+  /// Constructor: filling the table from the particle.tbl embedded in 
+  /// the library (no file is read)
+  PDGService();
 
   /// Destructor
   ~PDGService()
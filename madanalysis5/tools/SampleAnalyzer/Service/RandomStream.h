@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef RANDOM_STREAM_h
+#define RANDOM_STREAM_h
+
+// ROOT headers
+#include <Rtypes.h>
+
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Counter-based random stream. The n-th number of the stream is obtained by
+/// hashing (key,n) with the SplitMix64 finalizer, so that a stream does not
+/// depend on the numbers drawn by the other ones. Each event owns the stream
+/// keyed by the seed, the index of its file and its number in the file: the
+/// random decisions taken for an event are the same whatever the number of 
+/// threads, the sharding and the order in which the events are analyzed.
+//////////////////////////////////////////////////////////////////////////////
+class RandomStream
+{
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ private :
+
+  /// Key of the stream
+  ULong64_t key_;
+
+  /// Number of values drawn
+  ULong64_t counter_;
+
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public :
+
+  /// Constructor without argument
+  RandomStream()
+  { key_=0; counter_=0; }
+
+  /// Destructor
+  ~RandomStream()
+  { }
+
+  /// Stream of the event 'number' of the file 'file'
+  void Initialize(ULong64_t seed, ULong64_t file, ULong64_t number)
+  {
+    key_     = Mix(seed ^ Mix(file ^ Mix(number)));
+    counter_ = 0;
+  }
+
+  /// Next 64-bit value
+  ULong64_t Integer()
+  {
+    counter_++;
+    return Mix(key_ + counter_*0x9E3779B97F4A7C15ULL);
+  }
+
+  /// Next value uniformly distributed in ]0,1[ (53 bits)
+  Double_t Rndm()
+  { return ((Integer()>>11)+0.5)*(1./9007199254740992.); }
+
+ private :
+
+  /// SplitMix64 finalizer (a bijection of the 64-bit integers)
+  static ULong64_t Mix(ULong64_t z)
+  {
+    z = (z ^ (z>>30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z>>27)) * 0x94D049BB133111EBULL;
+    return z ^ (z>>31);
+  }
+
+};
+
+}
+
+#endif
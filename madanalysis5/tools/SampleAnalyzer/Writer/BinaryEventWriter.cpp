@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Writer/BinaryEventWriter.h"
+#include "SampleAnalyzer/DataFormat/BinaryEventFormat.h"
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+const UInt_t BinaryEventWriter::BlockSize = 1048576;
+
+// -----------------------------------------------------------------------------
+// Initialize
+// -----------------------------------------------------------------------------
+bool BinaryEventWriter::Initialize(const Configuration* cfg,
+                                   const std::string& rawfilename)
+{
+  // No RFIO for this format
+  if (ReaderBase::IsRfioMode(rawfilename))
+  {
+    ERROR << "'-rfio' is not allowed for the MA5 binary event format" << endmsg;
+    return false;
+  }
+  std::string filename = ReaderBase::CleanFilename(rawfilename);
+
+  // '.ma5bin.gz' : the blocks are compressed (the file is not a gzip stream)
+  compress_ = ReaderBase::IsCompressedMode(filename);
+  if (compress_)
+  {
+#ifndef ZIP_USE
+    ERROR << "'zip file' is not allowed. Please set the ZIP_USE"
+          << " variable in the Makefile to 1 and recompile the program if"
+          << " you would like to use this option." << endmsg;
+    return false;
+#endif
+  }
+
+  // Opening the file
+  output_ = new std::ofstream(filename.c_str(), 
+                              std::ios::out | std::ios::binary);
+  if (!output_->good())
+  {
+    ERROR << "Opening file " << filename << " failed" << endmsg;
+    delete output_; output_=0;
+    return false;
+  }
+
+  block_.clear();
+  block_.reserve(BlockSize+BlockSize/4);
+  nevents_    = 0;
+  FirstEvent_ = true;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteHeader
+// -----------------------------------------------------------------------------
+bool BinaryEventWriter::WriteHeader(const SampleFormat& mySample)
+{
+  if (output_==0) return false;
+  BinaryEventFormat::WriteSample(*output_, mySample);
+  return output_->good();
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteEvent
+// -----------------------------------------------------------------------------
+bool BinaryEventWriter::WriteEvent(const EventFormat& myEvent, 
+                                   const SampleFormat& mySample)
+{
+  if (output_==0) return false;
+
+  // Header
+  if (FirstEvent_)
+  {
+    FirstEvent_=false;
+    if (!WriteHeader(mySample)) return false;
+  }
+
+  // Encoding the event
+  BinaryEventFormat::WriteEvent(block_, myEvent);
+  nevents_++;
+
+  // Flushing the block if it is full
+  if (block_.size()>=BlockSize) return FlushBlock();
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteFoot
+// -----------------------------------------------------------------------------
+bool BinaryEventWriter::WriteFoot(const SampleFormat& mySample)
+{
+  if (output_==0) return false;
+
+  // Empty sample: the header is written anyway
+  if (FirstEvent_)
+  {
+    FirstEvent_=false;
+    if (!WriteHeader(mySample)) return false;
+  }
+
+  // Last events and end tag (empty block)
+  if (!FlushBlock()) return false;
+  return BinaryEventFormat::WriteBlock(*output_, 0, block_);
+}
+
+
+// -----------------------------------------------------------------------------
+// Finalize
+// -----------------------------------------------------------------------------
+bool BinaryEventWriter::Finalize()
+{
+  if (output_==0) return true;
+  output_->close();
+  delete output_;
+  output_=0;
+  block_.clear();
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// FlushBlock
+// -----------------------------------------------------------------------------
+bool BinaryEventWriter::FlushBlock()
+{
+  if (nevents_==0) return true;
+  if (!BinaryEventFormat::WriteBlock(*output_, nevents_, block_, compress_))
+  {
+    ERROR << "writing a block of events failed" << endmsg;
+    return false;
+  }
+  block_.clear();
+  nevents_=0;
+  return true;
+}
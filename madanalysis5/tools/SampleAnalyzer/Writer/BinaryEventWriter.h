@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BINARY_EVENT_WRITER_h
+#define BINARY_EVENT_WRITER_h
+
+// STL headers
+#include <fstream>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Writer/WriterBase.h"
+
+namespace MA5
+{
+
+//////////////////////////////////////////////////////////////////////////////
+/// Writer of the native MA5 binary event format (extensions '.ma5bin' and
+/// '.ma5bin.gz', the latter with zlib-compressed blocks).
+/// The events are encoded in memory and flushed by blocks of about 1 Mo.
+//////////////////////////////////////////////////////////////////////////////
+class BinaryEventWriter : public WriterBase
+{
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ protected:
+
+  /// Output file
+  std::ofstream* output_;
+
+  /// Encoded events of the current block
+  std::vector<char> block_;
+
+  /// Number of events in the current block
+  UInt_t nevents_;
+
+  /// Size from which the block is flushed
+  static const UInt_t BlockSize;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public:
+
+  /// Constructor without argument
+  BinaryEventWriter() : WriterBase()
+  { output_=0; nevents_=0; }
+
+	/// Destructor
+  virtual ~BinaryEventWriter()
+  { if (output_!=0) delete output_; }
+
+  /// Initialize
+  virtual bool Initialize(const Configuration* cfg,
+                          const std::string& filename);
+
+  /// Write the sample
+  virtual bool WriteHeader(const SampleFormat& mySample);
+
+  /// Write the event
+  virtual bool WriteEvent(const EventFormat& myEvent, 
+                          const SampleFormat& mySample);
+
+  /// Write the end of the file
+  virtual bool WriteFoot(const SampleFormat& mySample);
+
+  /// Finalize
+  virtual bool Finalize();
+
+ private:
+
+  /// Writing the current block
+  bool FlushBlock();
+
+};
+
+}
+
+#endif
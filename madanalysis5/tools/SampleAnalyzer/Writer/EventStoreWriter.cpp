@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Writer/EventStoreWriter.h"
+#include "SampleAnalyzer/DataFormat/BinaryEventFormat.h"
+#include "SampleAnalyzer/Core/BinaryStream.h"
+#include "SampleAnalyzer/Reader/ReaderBase.h"
+#include "SampleAnalyzer/Service/LogService.h"
+
+using namespace MA5;
+
+/// Size from which the pending events are written
+static const UInt_t FlushSize = 1048576;
+
+// -----------------------------------------------------------------------------
+// Initialize
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::Initialize(const Configuration* cfg,
+                                  const std::string& rawfilename)
+{
+  // The file must be mappable: no RFIO and no compression
+  if (ReaderBase::IsRfioMode(rawfilename))
+  {
+    ERROR << "'-rfio' is not allowed for the MA5 event store" << endmsg;
+    return false;
+  }
+  std::string filename = ReaderBase::CleanFilename(rawfilename);
+
+  // Opening the file
+  output_ = new std::ofstream(filename.c_str(), 
+                              std::ios::out | std::ios::binary);
+  if (!output_->good())
+  {
+    ERROR << "Opening file " << filename << " failed" << endmsg;
+    delete output_; output_=0;
+    return false;
+  }
+
+  buffer_.clear();
+  buffer_.reserve(FlushSize+FlushSize/4);
+  offsets_.clear();
+  written_    = 0;
+  FirstEvent_ = true;
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteHeader
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::WriteHeader(const SampleFormat& mySample)
+{
+  if (output_==0) return false;
+  BinaryEventFormat::WriteSample(*output_, mySample);
+  written_ = static_cast<ULong64_t>(output_->tellp());
+  return output_->good();
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteEvent
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::WriteEvent(const EventFormat& myEvent, 
+                                  const SampleFormat& mySample)
+{
+  if (output_==0) return false;
+
+  // Header
+  if (FirstEvent_)
+  {
+    FirstEvent_=false;
+    if (!WriteHeader(mySample)) return false;
+  }
+
+  // Encoding the event
+  offsets_.push_back(written_+buffer_.size());
+  BinaryEventFormat::WriteEvent(buffer_, myEvent);
+
+  // Writing the pending events
+  if (buffer_.size()>=FlushSize) return Flush();
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// WriteFoot
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::WriteFoot(const SampleFormat& mySample)
+{
+  if (output_==0) return false;
+
+  // Empty sample: the header is written anyway
+  if (FirstEvent_)
+  {
+    FirstEvent_=false;
+    if (!WriteHeader(mySample)) return false;
+  }
+  if (!Flush()) return false;
+
+  // Padding: the index is aligned in the mapped file
+  while (written_%sizeof(ULong64_t)!=0)
+  {
+    output_->put('\0');
+    written_++;
+  }
+
+  // Index of the events
+  ULong64_t index = written_;
+  ULong64_t nevents = offsets_.size();
+  if (!offsets_.empty())
+    output_->write(reinterpret_cast<const char*>(&offsets_[0]),
+                   offsets_.size()*sizeof(ULong64_t));
+
+  // Footer
+  BinaryStream::Write(*output_, index);
+  BinaryStream::Write(*output_, nevents);
+  output_->write(BinaryEventFormat::IndexMagic,
+                 sizeof(BinaryEventFormat::IndexMagic));
+  return output_->good();
+}
+
+
+// -----------------------------------------------------------------------------
+// Finalize
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::Finalize()
+{
+  if (output_==0) return true;
+  output_->close();
+  delete output_;
+  output_=0;
+  std::vector<char>().swap(buffer_);
+  std::vector<ULong64_t>().swap(offsets_);
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Flush
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::Flush()
+{
+  if (buffer_.empty()) return true;
+  output_->write(&buffer_[0], buffer_.size());
+  if (!output_->good())
+  {
+    ERROR << "writing the events in the MA5 event store failed" << endmsg;
+    return false;
+  }
+  written_ += buffer_.size();
+  buffer_.clear();
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Convert
+// -----------------------------------------------------------------------------
+bool EventStoreWriter::Convert(ReaderBase* reader, const std::string& input,
+                               const std::string& output)
+{
+  if (reader==0)
+  {
+    ERROR << "the format of the file " << input << " is not supported" 
+          << endmsg;
+    return false;
+  }
+
+  // Opening the files
+  Configuration cfg;
+  SampleFormat mySample;
+  EventFormat myEvent;
+  EventStoreWriter writer;
+  if (!reader->Initialize(input,cfg)) return false;
+  if (!reader->ReadHeader(mySample) || !writer.Initialize(&cfg,output))
+  {
+    reader->Finalize();
+    return false;
+  }
+  reader->FinalizeHeader(mySample);
+
+  // Copying the events
+  bool ok = true;
+  ULong64_t nevents = 0;
+  while (ok)
+  {
+    StatusCode::Type test = reader->ReadEvent(myEvent, mySample);
+    if (test==StatusCode::FAILURE) break;
+    if (test!=StatusCode::KEEP) continue;
+    if (!reader->FinalizeEvent(mySample,myEvent)) continue;
+    ok = writer.WriteEvent(myEvent,mySample);
+    nevents++;
+  }
+
+  // Closing the files
+  if (ok) ok = writer.WriteFoot(mySample);
+  writer.Finalize();
+  reader->Finalize();
+  if (ok) INFO << "        => " << nevents << " events copied into " 
+               << output << endmsg;
+  return ok;
+}
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+//  
+//  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+//  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+//  
+//  This file is part of MadAnalysis 5.
+//  Official website: <https://launchpad.net/madanalysis5>
+//  
+//  MadAnalysis 5 is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//  
+//  MadAnalysis 5 is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+//  GNU General Public License for more details.
+//  
+//  You should have received a copy of the GNU General Public License
+//  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+//  
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EVENT_STORE_WRITER_h
+#define EVENT_STORE_WRITER_h
+
+// STL headers
+#include <fstream>
+#include <vector>
+
+// SampleAnalyzer headers
+#include "SampleAnalyzer/Writer/WriterBase.h"
+
+namespace MA5
+{
+
+class ReaderBase;
+
+//////////////////////////////////////////////////////////////////////////////
+/// Writer of the MA5 event store (extension '.ma5store'): the sample 
+/// description, the uncompressed events one after the other, then an index
+/// of the event offsets (8-byte aligned) and a footer
+///   [ULong64_t offset of the index][ULong64_t number of events][IndexMagic]
+/// allowing the reader to map the file and to access any event directly.
+//////////////////////////////////////////////////////////////////////////////
+class EventStoreWriter : public WriterBase
+{
+
+  // -------------------------------------------------------------
+  //                        data members
+  // -------------------------------------------------------------
+ protected:
+
+  /// Output file
+  std::ofstream* output_;
+
+  /// Encoded events not yet written
+  std::vector<char> buffer_;
+
+  /// Offset of each event in the file
+  std::vector<ULong64_t> offsets_;
+
+  /// Number of bytes already written in the file
+  ULong64_t written_;
+
+  // -------------------------------------------------------------
+  //                       method members
+  // -------------------------------------------------------------
+ public:
+
+  /// Constructor without argument
+  EventStoreWriter() : WriterBase()
+  { output_=0; written_=0; }
+
+	/// Destructor
+  virtual ~EventStoreWriter()
+  { if (output_!=0) delete output_; }
+
+  /// Initialize
+  virtual bool Initialize(const Configuration* cfg,
+                          const std::string& filename);
+
+  /// Write the sample
+  virtual bool WriteHeader(const SampleFormat& mySample);
+
+  /// Write the event
+  virtual bool WriteEvent(const EventFormat& myEvent, 
+                          const SampleFormat& mySample);
+
+  /// Write the index and the footer
+  virtual bool WriteFoot(const SampleFormat& mySample);
+
+  /// Finalize
+  virtual bool Finalize();
+
+  /// Converter: copying all the events of a file read by any reader
+  static bool Convert(ReaderBase* reader, const std::string& input,
+                      const std::string& output);
+
+ private:
+
+  /// Writing the pending events
+  bool Flush();
+
+};
+
+}
+
+#endif
@@ -82,11 +82,15 @@ UInt_t FindDeeply(const MCParticleFormat* part,
             const std::vector<const MCParticleFormat*>& collection)
 {
   if (part==0) return 0;
-  bool test=false;
-  const MCParticleFormat* thepart = part;
+  const MCDecayGraph* graph = part->decayGraph();
+  if (graph==0) return 0;
+
+  // Going up the first mothers until a particle from the hard process
+  const MCParticleFormat* thepart = 0;
+  Int_t index = part->index();
   unsigned int counter=0;
 
-  while(!test)
+  while(thepart==0)
   {
     counter++;
     if (counter>=100000)
@@ -94,22 +98,15 @@ UInt_t FindDeeply(const MCParticleFormat* part,
       WARNING << "Number of calls exceed: infinite loop is detected" << endmsg;
       break;
     }
-    if (thepart->mother1()==0) 
-    {
-      test=true;
-      thepart=0;
-    }
-    else if (thepart->mother1()->statuscode()==3 || 
-            (  thepart->mother1()->statuscode()>=11 &&
-               thepart->mother1()->statuscode()<=29)  )
-    {
-      test=true;
-      thepart=thepart->mother1();
-    }
-    else
+    Int_t mother = graph->mother1(index);
+    if (mother<0) break;
+    const MCParticleFormat* mum = graph->particles()+mother;
+    if (mum->statuscode()==3 || 
+       (mum->statuscode()>=11 && mum->statuscode()<=29) )
     {
-      thepart=thepart->mother1();
+      thepart=mum;
     }
+    index=mother;
   }
   if (thepart==0) return 0;
   for (unsigned int i=0;i<collection.size();i++)
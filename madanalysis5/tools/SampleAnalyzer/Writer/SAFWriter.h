@@ -76,6 +76,14 @@ class SAFWriter : public WriterTextBase
   /// Getting stream
   std::ostream* GetStream()
   { return output_; }
+
+  /// Writing into a memory buffer which is never saved (replicas of the 
+  /// analyses, whose results are merged into the original ones)
+  void InitializeBuffer()
+  {
+    if (output_!=0) delete output_;
+    output_ = new std::ostringstream;
+  }
  
 };
 
@@ -27,6 +27,8 @@
 #include "SampleAnalyzer/Writer/WriterManager.h"
 #include "SampleAnalyzer/Writer/LHEWriter.h"
 #include "SampleAnalyzer/Writer/LHCOWriter.h"
+#include "SampleAnalyzer/Writer/BinaryEventWriter.h"
+#include "SampleAnalyzer/Writer/EventStoreWriter.h"
 
 using namespace MA5;
 
@@ -49,6 +51,17 @@ void WriterManager::BuildTable()
   Add("lhco.gz",lhco);
 #endif
 
+  // Adding MA5 binary writer
+  BinaryEventWriter* ma5bin = new BinaryEventWriter();
+  Add("ma5bin",ma5bin);
+#ifdef ZIP_USE
+  Add("ma5bin.gz",ma5bin);
+#endif
+
+  // Adding MA5 event store writer
+  EventStoreWriter* ma5store = new EventStoreWriter();
+  Add("ma5store",ma5store);
+
 }
 
 
@@ -0,0 +1,205 @@
+#!/usr/bin/env python
+
+################################################################################
+#  
+#  Copyright (C) 2012-2013 Eric Conte, Benjamin Fuks
+#  The MadAnalysis development team, email: <ma5team@iphc.cnrs.fr>
+#  
+#  This file is part of MadAnalysis 5.
+#  Official website: <https://launchpad.net/madanalysis5>
+#  
+#  MadAnalysis 5 is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#  
+#  MadAnalysis 5 is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+#  GNU General Public License for more details.
+#  
+#  You should have received a copy of the GNU General Public License
+#  along with MadAnalysis 5. If not, see <http://www.gnu.org/licenses/>
+#  
+################################################################################
+
+
+# Validation of a single-precision build (installation option single_precision)
+# against the double-precision build: the same job is run with the two builds
+# and the SAF outputs of the two runs are compared here. Each cutflow counter
+# and histogram bin is compared, and the relative differences larger than the
+# tolerance are reported.
+#
+# Syntax: ./comparePrecision.py <reference output dir> <tested output dir> 
+#                               [tolerance, default 1e-3]
+#
+# The exit code is 0 if all the values agree within the tolerance.
+
+from __future__ import print_function
+import os
+import sys
+
+
+class SAFValues:
+
+    def __init__(self,filename):
+        self.filename = filename
+        self.keys     = []
+        self.values   = {}
+        self.labels   = {}
+
+    def Read(self):
+        try:
+            input = open(self.filename)
+        except:
+            print("Error: impossible to open the file '"+self.filename+"'")
+            return False
+
+        # Blocks currently open, and counter of the blocks at each level
+        blocks = []
+        counts = {}
+        name   = ''
+        nline  = 0
+        for rawline in input:
+            line = rawline.strip()
+            if line.startswith('</') and line.endswith('>'):
+                if len(blocks)!=0:
+                    blocks.pop()
+                continue
+            if line.startswith('<') and line.endswith('>'):
+                path = '/'.join(blocks+[line[1:-1]])
+                counts[path] = counts.get(path,0)+1
+                blocks.append(line[1:-1])
+                if len(blocks)==1:
+                    name = ''
+                nline = 0
+                continue
+
+            # Name of the histogram or of the counter
+            if line.startswith('"'):
+                if name=='':
+                    name = line.split('"')[1]
+                continue
+
+            # Numerical values of the line
+            comment = ''
+            if '#' in line:
+                comment = line.split('#',1)[1].strip()
+                line    = line.split('#',1)[0]
+            numbers = []
+            for word in line.split():
+                try:
+                    numbers.append(float(word))
+                except ValueError:
+                    numbers = []
+                    break
+            if len(numbers)==0 or len(blocks)==0:
+                continue
+            nline += 1
+            path = '/'.join(blocks)
+            key  = (path,counts[path],nline)
+            self.keys.append(key)
+            self.values[key] = numbers
+            self.labels[key] = (name,comment)
+
+        input.close()
+        return True
+
+
+class PrecisionComparison:
+
+    def __init__(self,refdir,testdir,tolerance):
+        self.refdir    = os.path.normpath(refdir)
+        self.testdir   = os.path.normpath(testdir)
+        self.tolerance = tolerance
+        self.nfiles    = 0
+        self.nvalues   = 0
+        self.nfailed   = 0
+        self.maxdiff   = 0.
+
+    def GetSAFFiles(self,path):
+        files = []
+        for root, dirs, names in os.walk(path):
+            for name in names:
+                if name.endswith('.saf'):
+                    files.append(os.path.relpath(os.path.join(root,name),path))
+        files.sort()
+        return files
+
+    @staticmethod
+    def RelativeDifference(ref,test):
+        scale = max(abs(ref),abs(test))
+        if scale==0.:
+            return 0.
+        return abs(ref-test)/scale
+
+    def CompareFile(self,filename):
+        ref  = SAFValues(os.path.join(self.refdir,filename))
+        test = SAFValues(os.path.join(self.testdir,filename))
+        if not ref.Read() or not test.Read():
+            return False
+        if ref.keys!=test.keys:
+            print("Error: '"+filename+"' has a different structure in the two outputs")
+            self.nfailed += 1
+            return False
+        self.nfiles += 1
+
+        for key in ref.keys:
+            refvalues  = ref.values[key]
+            testvalues = test.values[key]
+            if len(refvalues)!=len(testvalues):
+                print("Error: '"+filename+"' has a different structure in the two outputs")
+                self.nfailed += 1
+                return False
+            for i in range(len(refvalues)):
+                self.nvalues += 1
+                diff = PrecisionComparison.RelativeDifference(refvalues[i],testvalues[i])
+                self.maxdiff = max(self.maxdiff,diff)
+                if diff<=self.tolerance:
+                    continue
+                self.nfailed += 1
+                name, comment = ref.labels[key]
+                print(filename+": "+key[0]+" '"+name+"' ("+comment+") : "+\
+                      repr(refvalues[i])+" -> "+repr(testvalues[i])+\
+                      " [relative difference = %.3g]" % diff)
+        return True
+
+    def Run(self):
+        reffiles  = self.GetSAFFiles(self.refdir)
+        testfiles = self.GetSAFFiles(self.testdir)
+        if len(reffiles)==0:
+            print("Error: no SAF file found in '"+self.refdir+"'")
+            return False
+        for filename in reffiles:
+            if filename not in testfiles:
+                print("Error: '"+filename+"' is missing in '"+self.testdir+"'")
+                self.nfailed += 1
+                continue
+            self.CompareFile(filename)
+
+        print(str(self.nfiles)+" SAF file(s), "+str(self.nvalues)+\
+              " value(s) compared, largest relative difference = %.3g" % self.maxdiff)
+        if self.nfailed!=0:
+            print(str(self.nfailed)+" value(s) beyond the tolerance of "+\
+                  str(self.tolerance))
+            return False
+        print("All values agree within the tolerance of "+str(self.tolerance))
+        return True
+
+
+# Reading arguments
+if len(sys.argv) not in [3,4]:
+    print("Error: number of argument incorrect")
+    print("Syntax: ./comparePrecision.py <reference output dir> <tested output dir> [tolerance]")
+    sys.exit(2)
+tolerance = 1e-3
+if len(sys.argv)==4:
+    try:
+        tolerance = float(sys.argv[3])
+    except ValueError:
+        print("Error: the tolerance '"+sys.argv[3]+"' is not a number")
+        sys.exit(2)
+
+comparison = PrecisionComparison(sys.argv[1],sys.argv[2],tolerance)
+if not comparison.Run():
+    sys.exit(1)